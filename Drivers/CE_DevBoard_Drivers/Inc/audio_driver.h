@@ -0,0 +1,78 @@
+/**
+ * @file audio_driver.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a driver for streaming PCM samples to a PWM output on PA8 (TIM1 CH1)
+ */
+
+# ifndef AUDIO_DRIVER_H
+# define AUDIO_DRIVER_H
+
+# include <stdint.h>
+
+# define AUDIO_PWM_PERIOD 256 // PWM steps, 8-bit output
+# define AUDIO_PWM_REPEAT 4 // PWM periods per sample
+# define AUDIO_RATE (16000000 / (AUDIO_PWM_PERIOD * AUDIO_PWM_REPEAT)) // Hz
+# define AUDIO_BLOCK_SIZE 64 // samples per DMA transfer
+# define AUDIO_FIFO_BLOCKS 8 // blocks rendered ahead of the DMA
+
+/**
+ * Audio FIFO Counters
+ * underruns - blocks of silence played because no rendered block was ready
+ * low_water - the fewest rendered blocks that were waiting when the DMA took one
+ */
+typedef struct {
+    uint32_t underruns;
+    uint32_t low_water;
+} audio_stats;
+
+/**
+ * Audio render callback
+ * Called from audio_pump to render the next block into the FIFO
+ * @param block - the block of signed 16-bit samples to fill
+ * @param n - the number of samples in the block
+ */
+typedef void (*audio_callback)(int16_t *block, int n);
+
+/**
+ * Initializes TIM1, DMA2 stream 5, and PA8 for PWM audio output
+ * @param render - the callback that renders each block of samples
+ */
+void audio_init(audio_callback render);
+
+/**
+ * Starts streaming samples
+ */
+void audio_start(void);
+
+/**
+ * Renders blocks into the FIFO until it is full
+ * Call from the idle loop, the DMA interrupt never renders
+ */
+void audio_pump(void);
+
+/**
+ * Measures how long until the DMA runs out of rendered samples
+ * @return the number of samples left to play before an underrun, or UINT32_MAX while stopped
+ */
+uint32_t audio_deadline(void);
+
+/**
+ * Reads the FIFO counters since streaming started
+ * @param stats - the counters to fill
+ */
+void audio_get_stats(audio_stats *stats);
+
+/**
+ * Stops streaming samples and idles the output at the midpoint
+ */
+void audio_stop(void);
+
+/**
+ * Checks whether the driver is streaming
+ * @return one if the driver is streaming, zero otherwise
+ */
+int audio_busy(void);
+
+# endif
@@ -0,0 +1,78 @@
+/**
+ * @file bitbang_driver.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a driver for playing square wave voices on PC0-PC11 from a single TIM6 interrupt
+ *
+ * Every tick the TIM6 interrupt steps one phase accumulator per voice and writes the sign bit of
+ * each one to its pin with a single BSRR store, so voice i plays on PCi. Every BB_CONTROL_TICKS
+ * ticks it also calls the control callback given to bb_init, which is how the music player times
+ * its notes. The cost of a tick is a fixed interrupt overhead plus a few cycles per voice.
+ * bb_max_voices times dds_step with the cycle counter at run time, and the music player's bit-bang
+ * backend sizes itself with it.
+ *
+ * For planning, voices that fit in half of the core at BB_OVERHEAD_CYCLES + 8 cycles per voice,
+ * counted from the unrolled Thumb-2 loop of dds_step rather than measured (capped at BB_MAX_VOICES
+ * by the free pins):
+ *
+ *   tick rate    16 MHz core    84 MHz core    180 MHz core
+ *   20 kHz       12             12             12
+ *   50 kHz       12             12             12
+ *   100 kHz      5              12             12
+ *   200 kHz      0              12             12
+ *
+ * Square edges land on the nearest tick, so the tick rate trades CPU time for edge jitter.
+ */
+
+# ifndef BITBANG_DRIVER_H
+# define BITBANG_DRIVER_H
+
+# include <stdint.h>
+
+# define BB_MAX_VOICES 12 // PC0-PC11, PC13 is the user button
+# define BB_TIM_FREQ 16000000 // Hz
+# define BB_TICK_RATE 40000 // Hz
+# define BB_OVERHEAD_CYCLES 40 // interrupt entry, exit, and flag clear
+# define BB_CONTROL_TICKS (BB_TICK_RATE / 1000) // ticks per control callback, one per ms
+
+/**
+ * Initializes TIM6 and the voice pins
+ * @param voices - the number of voices to play, at most BB_MAX_VOICES
+ * @param control - called from the interrupt once every BB_CONTROL_TICKS ticks, or zero for none
+ */
+void bb_init(int voices, void (*control)(void));
+
+/**
+ * Sets the frequency of a voice without resetting its phase
+ * @param voice - the voice to set
+ * @param frequency - the frequency in Q16.16 Hz, or zero to silence the voice
+ */
+void bb_set(int voice, uint32_t frequency);
+
+/**
+ * Starts ticking the voices
+ */
+void bb_start(void);
+
+/**
+ * Stops ticking the voices and drives every voice pin low
+ */
+void bb_stop(void);
+
+/**
+ * Checks whether the voices are ticking
+ * @return one if the voices are ticking, zero otherwise
+ */
+int bb_busy(void);
+
+/**
+ * Estimates how many voices fit in a share of the core at a tick rate
+ * @param rate - the tick rate in Hz
+ * @param core_hz - the core clock in Hz
+ * @param percent - the share of the core the interrupt may use
+ * @return the number of voices, capped at BB_MAX_VOICES
+ */
+int bb_max_voices(uint32_t rate, uint32_t core_hz, int percent);
+
+# endif
@@ -8,11 +8,8 @@
 
 #ifndef PIEZO_DRIVER_H
 #define PIEZO_DRIVER_H
-#endif
 
-# ifndef MUSIC_H
 # include "music_player_types.h"
-# endif
 
 /**
  * Piezo Buzzers
@@ -41,9 +38,25 @@ void piezo_stop(piezo_buzzer buzzer);
  */
 void piezo_set(piezo_buzzer buzzer, int duration, int frequency);
 
+/**
+ * Changes the tone period of a buzzer without restarting it
+ * @param buzzer - the buzzer being modified
+ * @param period - the tone timer period, as returned by piezo_period
+ */
+void piezo_set_period(piezo_buzzer buzzer, int period);
+
+/**
+ * Converts a frequency to a tone timer period
+ * @param frequency - the frequency in Hz
+ * @return the tone timer period, or zero for a rest
+ */
+int piezo_period(int frequency);
+
 /**
  * Checks the busy flag of a buzzer
  * @param buzzer - the buzzer to check
  * @return the value of the buzzers busy flag
  */
-int piezo_busy(piezo_buzzer buzzer);
\ No newline at end of file
+int piezo_busy(piezo_buzzer buzzer);
+
+# endif
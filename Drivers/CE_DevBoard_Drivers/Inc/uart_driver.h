@@ -0,0 +1,48 @@
+/**
+ * @file uart_driver.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a driver for receiving a byte stream on USART2 (PA3) into a circular DMA ring
+ */
+
+# ifndef UART_DRIVER_H
+# define UART_DRIVER_H
+
+# include <stdint.h>
+
+# define UART_CLOCK 8000000 // Hz, APB1
+# define UART_RING_SIZE 4096 // bytes, must be a power of two
+
+/**
+ * Initializes USART2 and DMA1 stream 5 to receive into the ring, discarding anything unread
+ * @param baud - the baud rate
+ */
+void uart_init(uint32_t baud);
+
+/**
+ * Stops receiving
+ */
+void uart_stop(void);
+
+/**
+ * Counts the bytes received but not yet read
+ * If the DMA has lapped the reader, the overwritten bytes are skipped and counted as an overrun
+ * @return the number of bytes ready to read
+ */
+uint32_t uart_available(void);
+
+/**
+ * Reads the next received byte
+ * Only call once uart_available has reported the byte is ready
+ * @return the byte
+ */
+uint8_t uart_read(void);
+
+/**
+ * Counts the times the DMA has lapped the reader since uart_init
+ * @return the number of overruns
+ */
+uint32_t uart_overruns(void);
+
+# endif
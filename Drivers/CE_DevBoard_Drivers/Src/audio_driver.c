@@ -0,0 +1,257 @@
+/**
+ * @file audio_driver.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a driver for streaming PCM samples to a PWM output on PA8 (TIM1 CH1)
+ */
+
+# include <stm32f446xx.h>
+# include "audio_driver.h"
+
+# define AUDIO_MIDPOINT (AUDIO_PWM_PERIOD / 2)
+# define AUDIO_DMA_CHANNEL 6 // TIM1_UP on DMA2 stream 5
+# define AUDIO_GPIO_AF 1 // TIM1_CH1 on PA8
+# define AUDIO_IRQ_PRIORITY 1
+
+/**
+ * The FIFO of rendered PWM duty cycle blocks, filled by audio_pump and drained by the DMA
+ * Blocks in [audio_tail, audio_next) belong to the DMA and blocks in [audio_next, audio_head)
+ * are rendered and waiting, with each counter only ever increasing
+ */
+static uint16_t audio_fifo[AUDIO_FIFO_BLOCKS][AUDIO_BLOCK_SIZE];
+static volatile uint32_t audio_head = 0;
+static volatile uint32_t audio_next = 0;
+static volatile uint32_t audio_tail = 0;
+
+/**
+ * The block the DMA plays when the FIFO runs dry
+ */
+static uint16_t audio_silence[AUDIO_BLOCK_SIZE];
+
+/**
+ * Whether each DMA memory target holds a FIFO block (rather than silence)
+ */
+static int audio_loaded[2];
+
+/**
+ * The block the render callback fills before it is converted into the FIFO
+ */
+static int16_t audio_block[AUDIO_BLOCK_SIZE];
+
+static audio_stats audio_counters;
+static audio_callback audio_render = 0;
+static int AUDIO_BUSY = 0;
+
+/**
+ * Renders a block and converts it into PWM duty cycles
+ * @param duty - the block of duty cycles to fill
+ */
+static void audio_fill(uint16_t *duty) {
+
+    // render silence if there is no callback
+    if (audio_render) {
+        audio_render(audio_block, AUDIO_BLOCK_SIZE);
+    } else {
+        for (int i = 0; i < AUDIO_BLOCK_SIZE; i++) audio_block[i] = 0;
+    }
+
+    // convert signed 16-bit samples to unsigned 8-bit duty cycles
+    for (int i = 0; i < AUDIO_BLOCK_SIZE; i++) {
+        duty[i] = (uint16_t) ((audio_block[i] + 32768) >> 8);
+    }
+}
+
+/**
+ * Hands the next rendered block, or silence if there is none, to an idle DMA memory target
+ * @param target - the memory target to load, zero or one
+ */
+static void audio_load(int target) {
+
+    uint32_t next = audio_next;
+    uint16_t *block = audio_silence;
+
+    // count an underrun rather than waiting for a block that is not ready
+    if (next != audio_head) {
+        block = audio_fifo[next % AUDIO_FIFO_BLOCKS];
+        audio_next = next + 1;
+        audio_loaded[target] = 1;
+    } else {
+        audio_counters.underruns++;
+        audio_loaded[target] = 0;
+    }
+
+    if (target) DMA2_Stream5->M1AR = (uint32_t) block;
+    else DMA2_Stream5->M0AR = (uint32_t) block;
+
+    // track the lowest the FIFO has run
+    uint32_t ready = audio_head - audio_next;
+    if (ready < audio_counters.low_water) audio_counters.low_water = ready;
+}
+
+/**
+ * Initializes TIM1, DMA2 stream 5, and PA8 for PWM audio output
+ * @param render - the callback that renders each block of samples
+ */
+void audio_init(audio_callback render) {
+
+    // enable GPIOA, DMA2, and TIM1 clocks
+    RCC->AHB1ENR |= RCC_AHB1ENR_GPIOAEN | RCC_AHB1ENR_DMA2EN;
+    RCC->APB2ENR |= RCC_APB2ENR_TIM1EN;
+
+    audio_stop();
+    audio_render = render;
+
+    // route PA8 to TIM1 CH1
+    GPIOA->MODER = (GPIOA->MODER & ~GPIO_MODER_MODER8) | GPIO_MODER_MODER8_1;
+    GPIOA->OSPEEDR |= GPIO_OSPEEDER_OSPEEDR8;
+    GPIOA->AFR[1] = (GPIOA->AFR[1] & ~GPIO_AFRH_AFSEL8) | (AUDIO_GPIO_AF << GPIO_AFRH_AFSEL8_Pos);
+
+    // PWM mode 1 on CH1 with one update (and DMA request) every AUDIO_PWM_REPEAT periods
+    TIM1->PSC = 0;
+    TIM1->ARR = AUDIO_PWM_PERIOD - 1;
+    TIM1->RCR = AUDIO_PWM_REPEAT - 1;
+    TIM1->CCR1 = AUDIO_MIDPOINT;
+    TIM1->CCMR1 = (TIM1->CCMR1 & ~(TIM_CCMR1_OC1M | TIM_CCMR1_CC1S))
+                  | TIM_CCMR1_OC1M_2 | TIM_CCMR1_OC1M_1 | TIM_CCMR1_OC1PE;
+    TIM1->CCER |= TIM_CCER_CC1E;
+    TIM1->BDTR |= TIM_BDTR_MOE;
+    TIM1->CR1 |= TIM_CR1_ARPE;
+    TIM1->EGR = TIM_EGR_UG;
+
+    // silence is the midpoint duty cycle
+    for (int i = 0; i < AUDIO_BLOCK_SIZE; i++) audio_silence[i] = AUDIO_MIDPOINT;
+
+    // double buffered half-word transfers of one block to CCR1, interrupting at each block so
+    // the idle memory target can be pointed at the next block
+    DMA2_Stream5->CR = (AUDIO_DMA_CHANNEL << DMA_SxCR_CHSEL_Pos)
+                       | DMA_SxCR_PL_1
+                       | DMA_SxCR_MSIZE_0
+                       | DMA_SxCR_PSIZE_0
+                       | DMA_SxCR_MINC
+                       | DMA_SxCR_DBM
+                       | DMA_SxCR_DIR_0
+                       | DMA_SxCR_TCIE;
+    DMA2_Stream5->PAR = (uint32_t) &(TIM1->CCR1);
+    DMA2_Stream5->M0AR = (uint32_t) audio_silence;
+    DMA2_Stream5->M1AR = (uint32_t) audio_silence;
+    DMA2_Stream5->NDTR = AUDIO_BLOCK_SIZE;
+
+    NVIC_SetPriority(DMA2_Stream5_IRQn, AUDIO_IRQ_PRIORITY);
+    NVIC_EnableIRQ(DMA2_Stream5_IRQn);
+}
+
+/**
+ * Starts streaming samples
+ */
+void audio_start(void) {
+
+    if (AUDIO_BUSY) return;
+
+    // empty the FIFO and fill it completely so playback starts with the most headroom
+    audio_head = 0;
+    audio_next = 0;
+    audio_tail = 0;
+    audio_counters.underruns = 0;
+    audio_counters.low_water = AUDIO_FIFO_BLOCKS;
+    AUDIO_BUSY = 1;
+    audio_pump();
+
+    // load both memory targets, starting from the first
+    DMA2_Stream5->CR &= ~DMA_SxCR_CT;
+    audio_load(0);
+    audio_load(1);
+
+    // clear stale stream 5 flags then enable the stream before its request source
+    DMA2->HIFCR = DMA_HIFCR_CTCIF5 | DMA_HIFCR_CHTIF5 | DMA_HIFCR_CTEIF5
+                  | DMA_HIFCR_CDMEIF5 | DMA_HIFCR_CFEIF5;
+    DMA2_Stream5->NDTR = AUDIO_BLOCK_SIZE;
+    DMA2_Stream5->CR |= DMA_SxCR_EN;
+
+    // request a transfer on every TIM1 update and start counting
+    TIM1->DIER |= TIM_DIER_UDE;
+    TIM1->CR1 |= TIM_CR1_CEN;
+}
+
+/**
+ * Renders blocks into the FIFO until it is full
+ * Call from the idle loop, the DMA interrupt never renders
+ */
+void audio_pump(void) {
+
+    if (!AUDIO_BUSY) return;
+
+    // the interrupt only moves the tail forward, so the free space can only grow under us
+    while (audio_head - audio_tail < AUDIO_FIFO_BLOCKS) {
+        audio_fill(audio_fifo[audio_head % AUDIO_FIFO_BLOCKS]);
+        audio_head = audio_head + 1;
+    }
+}
+
+/**
+ * Measures how long until the DMA runs out of rendered samples
+ * @return the number of samples left to play before an underrun, or UINT32_MAX while stopped
+ */
+uint32_t audio_deadline(void) {
+
+    // nothing is being played, so nothing can underrun
+    if (!(DMA2_Stream5->CR & DMA_SxCR_EN)) return UINT32_MAX;
+
+    // the rest of the playing block, the block queued behind it, and the rendered blocks waiting
+    int idle = (DMA2_Stream5->CR & DMA_SxCR_CT) ? 0 : 1;
+    uint32_t samples = DMA2_Stream5->NDTR;
+    if (audio_loaded[idle]) samples += AUDIO_BLOCK_SIZE;
+    samples += (audio_head - audio_next) * AUDIO_BLOCK_SIZE;
+
+    return samples;
+}
+
+/**
+ * Reads the FIFO counters since streaming started
+ * @param stats - the counters to fill
+ */
+void audio_get_stats(audio_stats *stats) {
+    *stats = audio_counters;
+}
+
+/**
+ * Stops streaming samples and idles the output at the midpoint
+ */
+void audio_stop(void) {
+
+    // stop the DMA requests and the stream
+    TIM1->DIER &= ~(TIM_DIER_UDE);
+    DMA2_Stream5->CR &= ~(DMA_SxCR_EN);
+    while (DMA2_Stream5->CR & DMA_SxCR_EN);
+
+    // hold the output at the midpoint so it does not click
+    TIM1->CCR1 = AUDIO_MIDPOINT;
+
+    AUDIO_BUSY = 0;
+}
+
+/**
+ * Checks whether the driver is streaming
+ * @return one if the driver is streaming, zero otherwise
+ */
+int audio_busy(void) {
+    return AUDIO_BUSY;
+}
+
+/**
+ * DMA2 Stream 5 Interrupt Request Handler
+ */
+void DMA2_Stream5_IRQHandler(void) {
+
+    // a block finished playing and the DMA moved on to the other memory target
+    if (DMA2->HISR & DMA_HISR_TCIF5) {
+        DMA2->HIFCR = DMA_HIFCR_CTCIF5;
+
+        int idle = (DMA2_Stream5->CR & DMA_SxCR_CT) ? 0 : 1;
+
+        // return the finished block to the FIFO, then queue the next one behind the playing one
+        if (audio_loaded[idle]) audio_tail = audio_tail + 1;
+        audio_load(idle);
+    }
+
+}
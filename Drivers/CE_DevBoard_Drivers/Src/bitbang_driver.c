@@ -0,0 +1,156 @@
+/**
+ * @file bitbang_driver.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a driver for playing square wave voices on PC0-PC11 from a single TIM6 interrupt
+ */
+
+# include <stm32f446xx.h>
+# include "bitbang_driver.h"
+# include "dds.h"
+
+# define BB_IRQ_PRIORITY 2
+
+/**
+ * The oscillators of the voices, voice i drives PCi
+ */
+static dds_bank bb_bank;
+
+/**
+ * The pins owned by the voices
+ */
+static uint32_t bb_mask = 0;
+
+static int BB_BUSY = 0;
+
+/**
+ * The control callback, and the ticks left until it is next called
+ */
+static void (*bb_control)(void) = 0;
+static int bb_control_count = BB_CONTROL_TICKS;
+
+/**
+ * Initializes TIM6 and the voice pins
+ * @param voices - the number of voices to play, at most BB_MAX_VOICES
+ * @param control - called from the interrupt once every BB_CONTROL_TICKS ticks, or zero for none
+ */
+void bb_init(int voices, void (*control)(void)) {
+
+    if (voices > BB_MAX_VOICES) voices = BB_MAX_VOICES;
+    if (voices < 0) voices = 0;
+
+    // enable GPIOC and TIM6 clocks
+    RCC->AHB1ENR |= RCC_AHB1ENR_GPIOCEN;
+    RCC->APB1ENR |= RCC_APB1ENR_TIM6EN;
+
+    bb_stop();
+    dds_init(&bb_bank, voices);
+    bb_mask = (1u << voices) - 1;
+    bb_control = control;
+    bb_control_count = BB_CONTROL_TICKS;
+
+    // drive the voice pins as push-pull outputs, starting low
+    GPIOC->BSRR = bb_mask << 16;
+    for (int i = 0; i < voices; i++) {
+        GPIOC->MODER = (GPIOC->MODER & ~(GPIO_MODER_MODER0 << (2 * i))) | (GPIO_MODER_MODER0_0 << (2 * i));
+        GPIOC->OTYPER &= ~(GPIO_OTYPER_OT0 << i);
+    }
+
+    // one update interrupt per tick
+    TIM6->PSC = 0;
+    TIM6->ARR = (BB_TIM_FREQ / BB_TICK_RATE) - 1;
+    TIM6->EGR = TIM_EGR_UG;
+    TIM6->SR = 0;
+    TIM6->DIER |= TIM_DIER_UIE;
+
+    NVIC_SetPriority(TIM6_DAC_IRQn, BB_IRQ_PRIORITY);
+    NVIC_EnableIRQ(TIM6_DAC_IRQn);
+}
+
+/**
+ * Sets the frequency of a voice without resetting its phase
+ * @param voice - the voice to set
+ * @param frequency - the frequency in Q16.16 Hz, or zero to silence the voice
+ */
+void bb_set(int voice, uint32_t frequency) {
+
+    // ignore voices that do not exist
+    if (voice < 0 || voice >= bb_bank.voices) return;
+
+    // a silent voice parks its phase in the low half so its pin stays low
+    if (frequency == 0) {
+        bb_bank.osc[voice].inc = 0;
+        bb_bank.osc[voice].phase = 0;
+        return;
+    }
+
+    dds_set(&bb_bank.osc[voice], frequency, BB_TICK_RATE);
+}
+
+/**
+ * Starts ticking the voices
+ */
+void bb_start(void) {
+    TIM6->CR1 |= TIM_CR1_CEN;
+    BB_BUSY = 1;
+}
+
+/**
+ * Stops ticking the voices and drives every voice pin low
+ */
+void bb_stop(void) {
+    TIM6->CR1 &= ~TIM_CR1_CEN;
+    GPIOC->BSRR = bb_mask << 16;
+    BB_BUSY = 0;
+}
+
+/**
+ * Checks whether the voices are ticking
+ * @return one if the voices are ticking, zero otherwise
+ */
+int bb_busy(void) {
+    return BB_BUSY;
+}
+
+/**
+ * Estimates how many voices fit in a share of the core at a tick rate
+ * @param rate - the tick rate in Hz
+ * @param core_hz - the core clock in Hz
+ * @param percent - the share of the core the interrupt may use
+ * @return the number of voices, capped at BB_MAX_VOICES
+ */
+int bb_max_voices(uint32_t rate, uint32_t core_hz, int percent) {
+
+    if (rate == 0) return 0;
+
+    // dds_step at a 1 Hz rate reports the oscillator steps per second each MHz of core can run
+    uint64_t steps_per_mhz = (uint64_t) dds_voices_per_mhz(1);
+
+    // cycles each tick may spend, less the fixed interrupt overhead
+    int64_t budget = ((int64_t) core_hz * percent) / (100 * (int64_t) rate) - BB_OVERHEAD_CYCLES;
+    if (budget <= 0) return 0;
+
+    // voices = budget cycles / cycles per voice, where cycles per voice = 10^6 / steps_per_mhz
+    uint64_t voices = ((uint64_t) budget * steps_per_mhz) / 1000000;
+
+    return voices < BB_MAX_VOICES ? (int) voices : BB_MAX_VOICES;
+}
+
+/**
+ * TIM6 Interrupt Request Handler
+ */
+void TIM6_DAC_IRQHandler(void) {
+
+    TIM6->SR = ~TIM_SR_UIF;
+
+    // set the pins of the voices in the high half of their cycle and reset the rest in one store
+    uint32_t gate = dds_step(&bb_bank) & bb_mask;
+    GPIOC->BSRR = gate | ((~gate & bb_mask) << 16);
+
+    // run the control callback at its slower rate
+    if (bb_control && --bb_control_count == 0) {
+        bb_control_count = BB_CONTROL_TICKS;
+        bb_control();
+    }
+}
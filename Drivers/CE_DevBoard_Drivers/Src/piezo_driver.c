@@ -10,8 +10,9 @@
 # include "piezo_driver.h"
 
 # define TIM2_FREQ 1000 // Hz
-# define TIM3_FREQ 40000 // Hz
-# define TIM4_FREQ 40000 // Hz
+# define TIM3_FREQ 4000000 // Hz
+# define TIM4_FREQ 4000000 // Hz
+# define TIM_MAX_PERIOD 0xFFFF
 # define TIM2_FREQ 1000 // Hz
 
 static int BUZZER0_BUSY = 0;
@@ -131,8 +132,9 @@ void piezo_set(piezo_buzzer buzzer, int duration, int frequency) {
             TIM3->CNT = 0;
             // clear capture/compare interrupt flag on TIM2
             TIM2->SR &= ~(TIM_SR_CC1IF);
-            // set TIM3 frequency
-            TIM3->ARR = TIM3_FREQ / (frequency * 2);
+            // set TIM3 frequency and load it immediately
+            TIM3->ARR = piezo_period(frequency);
+            TIM3->EGR = TIM_EGR_UG;
             // set TIM2 duration
             TIM2->ARR = duration;
             break;
@@ -143,8 +145,9 @@ void piezo_set(piezo_buzzer buzzer, int duration, int frequency) {
             TIM5->CNT = 0;
             // clear capture/compare interrupt flag on TIM5
             TIM5->SR &= ~(TIM_SR_CC1IF);
-            // set TIM4 frequency
-            TIM4->ARR = TIM4_FREQ / (frequency * 2);
+            // set TIM4 frequency and load it immediately
+            TIM4->ARR = piezo_period(frequency);
+            TIM4->EGR = TIM_EGR_UG;
             // set TIM5 duration
             TIM5->ARR = duration;
             break;
@@ -158,9 +161,11 @@ void piezo_set(piezo_buzzer buzzer, int duration, int frequency) {
             // clear capture/compare interrupt flag on TIM2 and TIM5
             TIM2->SR &= ~(TIM_SR_CC1IF);
             TIM5->SR &= ~(TIM_SR_CC1IF);
-            // set TIM3 and TIM4 frequency
-            TIM3->ARR = TIM3_FREQ / (frequency * 2);
-            TIM4->ARR = TIM4_FREQ / (frequency * 2);
+            // set TIM3 and TIM4 frequency and load them immediately
+            TIM3->ARR = piezo_period(frequency);
+            TIM4->ARR = piezo_period(frequency);
+            TIM3->EGR = TIM_EGR_UG;
+            TIM4->EGR = TIM_EGR_UG;
             // set TIM2 and TIM5 duration
             TIM2->ARR = duration;
             TIM5->ARR = duration;
@@ -174,6 +179,60 @@ void piezo_set(piezo_buzzer buzzer, int duration, int frequency) {
 
 }
 
+/**
+ * Changes the tone period of a buzzer without restarting it
+ * The new period is preloaded and takes effect at the end of the current half-cycle,
+ * so it can be updated while the buzzer is playing without glitching the output
+ * @param buzzer - the buzzer being modified
+ * @param period - the tone timer period, as returned by piezo_period
+ */
+void piezo_set_period(piezo_buzzer buzzer, int period) {
+
+    // clamp the period to the range of the tone timers
+    if (period > TIM_MAX_PERIOD) period = TIM_MAX_PERIOD;
+    if (period < 0) period = 0;
+
+    // switch on buzzer to set the preloaded period
+    switch (buzzer) {
+
+        case BUZZER0:
+            TIM3->ARR = period;
+            break;
+
+        case BUZZER1:
+            TIM4->ARR = period;
+            break;
+
+        case ALL:
+            TIM3->ARR = period;
+            TIM4->ARR = period;
+            break;
+
+        default:
+            // do nothing if we receive an invalid value
+            break;
+
+    }
+
+}
+
+/**
+ * Converts a frequency to a tone timer period
+ * @param frequency - the frequency in Hz
+ * @return the tone timer period, or zero for a rest
+ */
+int piezo_period(int frequency) {
+
+    // a zero frequency is a rest
+    if (frequency <= 0) return 0;
+
+    // the tone timer toggles the output, so it runs at twice the frequency
+    int period = TIM3_FREQ / (frequency * 2);
+
+    // clamp the period to the range of the tone timers
+    return period > TIM_MAX_PERIOD ? TIM_MAX_PERIOD : period;
+}
+
 /**
  * Checks the busy flag of a buzzer
  * @param buzzer - the buzzer to check
@@ -0,0 +1,155 @@
+/**
+ * @file uart_driver.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a driver for receiving a byte stream on USART2 (PA3) into a circular DMA ring
+ */
+
+# include <stm32f446xx.h>
+# include "uart_driver.h"
+
+# define UART_DMA_CHANNEL 4 // USART2_RX on DMA1 stream 5
+# define UART_GPIO_AF 7 // USART2 on PA2 and PA3
+# define UART_IRQ_PRIORITY 1
+# define UART_RING_MASK (UART_RING_SIZE - 1)
+
+/**
+ * The ring the DMA writes received bytes into
+ */
+static uint8_t uart_ring[UART_RING_SIZE];
+
+/**
+ * Bytes the DMA has written and the reader has consumed, each only ever increasing
+ * The DMA position inside the ring supplies the low bits of the written count between laps
+ */
+static volatile uint32_t uart_laps = 0;
+static uint32_t uart_consumed = 0;
+static uint32_t uart_overrun_count = 0;
+
+/**
+ * Counts every byte the DMA has written
+ * @return the total number of bytes received
+ */
+static uint32_t uart_written(void) {
+
+    uint32_t laps;
+    uint32_t position;
+    uint32_t pending;
+
+    // read again if the interrupt counted a lap while the position was being read
+    do {
+        laps = uart_laps;
+        position = UART_RING_SIZE - DMA1_Stream5->NDTR;
+        pending = (DMA1->HISR & DMA_HISR_TCIF5) && position < UART_RING_SIZE / 2;
+    } while (laps != uart_laps);
+
+    // count a lap that has wrapped but that the interrupt has not counted yet
+    return (laps + pending) * UART_RING_SIZE + position;
+}
+
+/**
+ * Initializes USART2 and DMA1 stream 5 to receive into the ring, discarding anything unread
+ * @param baud - the baud rate
+ */
+void uart_init(uint32_t baud) {
+
+    // enable GPIOA, DMA1, and USART2 clocks
+    RCC->AHB1ENR |= RCC_AHB1ENR_GPIOAEN | RCC_AHB1ENR_DMA1EN;
+    RCC->APB1ENR |= RCC_APB1ENR_USART2EN;
+
+    uart_stop();
+
+    // route PA3 to USART2 RX with a pull-up so an unplugged line idles high
+    GPIOA->MODER = (GPIOA->MODER & ~GPIO_MODER_MODER3) | GPIO_MODER_MODER3_1;
+    GPIOA->PUPDR = (GPIOA->PUPDR & ~GPIO_PUPDR_PUPD3) | GPIO_PUPDR_PUPD3_0;
+    GPIOA->AFR[0] = (GPIOA->AFR[0] & ~GPIO_AFRL_AFSEL3) | (UART_GPIO_AF << GPIO_AFRL_AFSEL3_Pos);
+
+    // 8N1 receive only at 16x oversampling, with every received byte requesting a DMA transfer
+    USART2->BRR = (UART_CLOCK + baud / 2) / baud;
+    USART2->CR2 = 0;
+    USART2->CR3 = USART_CR3_DMAR;
+    USART2->CR1 = USART_CR1_RE;
+
+    // circular byte transfers from the data register into the ring, interrupting at each lap
+    DMA1_Stream5->CR = (UART_DMA_CHANNEL << DMA_SxCR_CHSEL_Pos)
+                       | DMA_SxCR_PL_0
+                       | DMA_SxCR_MINC
+                       | DMA_SxCR_CIRC
+                       | DMA_SxCR_TCIE;
+    DMA1_Stream5->PAR = (uint32_t) &(USART2->DR);
+    DMA1_Stream5->M0AR = (uint32_t) uart_ring;
+    DMA1_Stream5->NDTR = UART_RING_SIZE;
+
+    uart_laps = 0;
+    uart_consumed = 0;
+    uart_overrun_count = 0;
+
+    // clear stale stream 5 flags then enable the stream before the USART
+    DMA1->HIFCR = DMA_HIFCR_CTCIF5 | DMA_HIFCR_CHTIF5 | DMA_HIFCR_CTEIF5
+                  | DMA_HIFCR_CDMEIF5 | DMA_HIFCR_CFEIF5;
+    DMA1_Stream5->CR |= DMA_SxCR_EN;
+
+    NVIC_SetPriority(DMA1_Stream5_IRQn, UART_IRQ_PRIORITY);
+    NVIC_EnableIRQ(DMA1_Stream5_IRQn);
+
+    USART2->CR1 |= USART_CR1_UE;
+}
+
+/**
+ * Stops receiving
+ */
+void uart_stop(void) {
+
+    USART2->CR1 &= ~(USART_CR1_UE);
+    DMA1_Stream5->CR &= ~(DMA_SxCR_EN);
+    while (DMA1_Stream5->CR & DMA_SxCR_EN);
+}
+
+/**
+ * Counts the bytes received but not yet read
+ * If the DMA has lapped the reader, the overwritten bytes are skipped and counted as an overrun
+ * @return the number of bytes ready to read
+ */
+uint32_t uart_available(void) {
+
+    uint32_t written = uart_written();
+
+    // the reader fell a whole ring behind, so resume half a ring back from the newest byte
+    if (written - uart_consumed > UART_RING_SIZE) {
+        uart_consumed = written - UART_RING_SIZE / 2;
+        uart_overrun_count++;
+    }
+
+    return written - uart_consumed;
+}
+
+/**
+ * Reads the next received byte
+ * Only call once uart_available has reported the byte is ready
+ * @return the byte
+ */
+uint8_t uart_read(void) {
+    return uart_ring[uart_consumed++ & UART_RING_MASK];
+}
+
+/**
+ * Counts the times the DMA has lapped the reader since uart_init
+ * @return the number of overruns
+ */
+uint32_t uart_overruns(void) {
+    return uart_overrun_count;
+}
+
+/**
+ * DMA1 Stream 5 Interrupt Request Handler
+ */
+void DMA1_Stream5_IRQHandler(void) {
+
+    // the DMA wrapped back to the start of the ring
+    if (DMA1->HISR & DMA_HISR_TCIF5) {
+        DMA1->HIFCR = DMA_HIFCR_CTCIF5;
+        uart_laps = uart_laps + 1;
+    }
+
+}
@@ -0,0 +1,102 @@
+/**
+ * @file abc.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a resumable parser that reads tunes in ABC notation one note at a time
+ *
+ * An ABC tune is a header of fields, one per line, ending with the key, then the tune itself:
+ *     X:1
+ *     T:The Kesh
+ *     M:6/8
+ *     L:1/8
+ *     Q:3/8=120
+ *     K:G
+ *     |:GAG GAB|ABA ABd|edd gdd|edB dBA:|
+ * The parser reads the unit length (L:), tempo (Q:), meter (M:), and key (K:) fields, in the header
+ * or inline, and notes with accidentals, octave marks, and length multipliers, along with rests,
+ * ties, broken rhythm, tuplets, repeats with first and second endings, and the first two notes of
+ * each chord, which play on the main and dual parts. Decorations, chord symbols, grace notes, and
+ * lyrics are skipped, as are all voices but the first.
+ *
+ * Like the RTTTL parser, it only keeps its place in the text, which must stay where it is, and a
+ * few fields, so a tune is converted as it plays in the fixed space of one abc_parser. Lengths are
+ * given in ticks, rounded to the nearest tick for the few that do not divide a whole note, and a
+ * tempo field is carried by the next note read, so the player's tempo map times the tune. A tune ends
+ * at a blank line, at the next X: field, or at the end of the text, and the next tune of a
+ * collection can be opened from where the last one ended.
+ */
+
+# ifndef ABC_H
+# define ABC_H
+
+# include <stdint.h>
+# include "music_player_types.h"
+# include "tempo_map.h"
+
+# define ABC_OCTAVES 10 // octaves of bar accidentals kept, from C0 up
+# define ABC_NO_ACCIDENTAL (-128)
+# define ABC_DEFAULT_TEMPO 120 // quarter notes per minute
+
+/**
+ * ABC Parser
+ * next - where the parser is in the text, and where the next tune starts once a tune has ended
+ * repeat - where the section that the next end of repeat sign goes back to starts
+ * title - the tune's title, which is not null terminated in the text
+ * unit - the unit note length, as a fraction of a whole note
+ * beat - the length of the tempo's beat, as a fraction of a whole note, and the beats per minute
+ * key - the accidental of each letter from C to B in the key, in semitones
+ * bar - the accidental of each note in the bar so far, or ABC_NO_ACCIDENTAL
+ * retimed - whether the tempo has changed since the last note was read
+ * second - whether the current repeated section is being played for the second time
+ * tuplet - p notes in the time of q, and how many notes of the tuplet are left
+ * broken - the multiplier the previous note's broken rhythm left for the next note
+ * voice - the first voice, which is the one played, or null if the tune has no voices
+ * errors - the number of malformed notes skipped so far
+ */
+typedef struct {
+    const char *next;
+    const char *repeat;
+    const char *title;
+    int title_length;
+    int unit_num;
+    int unit_den;
+    int meter_num;
+    int meter_den;
+    int beat_num;
+    int beat_den;
+    int bpm;
+    int8_t key[7];
+    int8_t bar[ABC_OCTAVES * 7];
+    int8_t retimed;
+    int8_t second;
+    int8_t muted;
+    int8_t ended;
+    int tuplet_p;
+    int tuplet_q;
+    int tuplet_left;
+    int broken_num;
+    int broken_den;
+    const char *voice;
+    int voice_length;
+    int errors;
+} abc_parser;
+
+/**
+ * Opens the first ABC tune in some text, reading its header
+ * The text must stay in place until the last note has been read
+ * @param p - the parser to open the tune with
+ * @param text - the null terminated text, such as a collection of tunes or where the last one ended
+ * @return one if a tune with a key was found, zero otherwise
+ */
+int abc_open(abc_parser *p, const char *text);
+
+/**
+ * Reads the next note of a tune, skipping any malformed notes
+ * @param p - the parser reading the tune
+ * @param n - the note to fill
+ * @return one if a note was read, zero at the end of the tune
+ */
+int abc_next(abc_parser *p, mp_note *n);
+
+# endif
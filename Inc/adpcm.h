@@ -0,0 +1,81 @@
+/**
+ * @file adpcm.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief one-shot playback of IMA-ADPCM clips stored in flash
+ */
+
+# ifndef ADPCM_H
+# define ADPCM_H
+
+# include <stdint.h>
+
+/**
+ * Each block starts with a 4-byte header (first sample as little-endian int16, step index, pad)
+ * followed by two 4-bit codes per byte, low nibble first, so blocks can be decoded independently
+ */
+# define ADPCM_BLOCK_SAMPLES 257
+# define ADPCM_HEADER_BYTES 4
+# define ADPCM_BLOCK_BYTES (ADPCM_HEADER_BYTES + (ADPCM_BLOCK_SAMPLES - 1) / 2)
+
+/**
+ * ADPCM Clip
+ * Clips are recorded at AUDIO_RATE and encoded by Tools/adpcm_encode.c
+ */
+typedef struct {
+    const uint8_t *data;
+    uint32_t samples;
+} adpcm_clip;
+
+/**
+ * ADPCM Player
+ */
+typedef struct {
+    const adpcm_clip *clip;
+    uint32_t position;
+    int32_t predictor;
+    int32_t index;
+} adpcm_player;
+
+/**
+ * ADPCM Stream Decoder
+ * Decodes a headerless stream of codes, such as one received over a serial link
+ */
+typedef struct {
+    int32_t predictor;
+    int32_t index;
+} adpcm_decoder;
+
+/**
+ * Starts playing a clip from its beginning
+ * @param p - the player to start
+ * @param clip - the clip to play
+ */
+void adpcm_start(adpcm_player *p, const adpcm_clip *clip);
+
+/**
+ * Decodes the next samples of a clip, adding them onto a mix
+ * @param p - the player to render
+ * @param mix - the mix to add the samples to
+ * @param n - the number of samples to render
+ * @param amplitude - the amplitude in Q15
+ * @return one if the clip has samples left, zero once it has finished
+ */
+int adpcm_render(adpcm_player *p, int32_t *mix, int n, int32_t amplitude);
+
+/**
+ * Resets a stream decoder to silence with the smallest step
+ * @param d - the decoder to reset
+ */
+void adpcm_reset(adpcm_decoder *d);
+
+/**
+ * Decodes one code of a stream
+ * @param d - the decoder to advance
+ * @param code - the 4-bit code to decode
+ * @return the decoded sample
+ */
+int16_t adpcm_decode(adpcm_decoder *d, int code);
+
+# endif
@@ -0,0 +1,92 @@
+/**
+ * @file biquad.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a cascaded direct form I biquad filter for tone shaping the sample output
+ *
+ * Cost: about 17 core cycles per sample per section, counted from the Thumb-2 inner loop of
+ * biquad_process_limited at Cortex-M4 timings with zero flash wait states (one multiply, two dual
+ * multiply-accumulates, a saturate, two packs, and the sample load and store, plus the loop branch).
+ * The two section BIQUAD_PIEZO_TONE takes about 34 cycles of the 1024 in a sample period at 16 MHz.
+ * biquad_cycles_per_sample measures the same figure on the target.
+ */
+
+# ifndef BIQUAD_H
+# define BIQUAD_H
+
+# include <stdint.h>
+
+# define BIQUAD_MAX_SECTIONS 4
+# define BIQUAD_COEF_SHIFT 14
+
+/**
+ * Packs two Q14 values into the halves of a word for the dual multiply-accumulate
+ */
+# define BIQUAD_PACK(lo, hi) ((uint32_t) (uint16_t) (int16_t) (lo) | ((uint32_t) (uint16_t) (int16_t) (hi) << 16))
+
+/**
+ * Builds the coefficients of a section from Q14 values, with the feedback terms already negated
+ * as Tools/biquad_design.c prints them: y = b0 x + b1 x1 + b2 x2 + na1 y1 + na2 y2
+ */
+# define BIQUAD_COEFS(b0, b1, b2, na1, na2) {(b0), BIQUAD_PACK((b1), (b2)), BIQUAD_PACK((na1), (na2))}
+
+/**
+ * Biquad Section Coefficients
+ */
+typedef struct {
+    int32_t b0;
+    uint32_t b12;
+    uint32_t a12;
+} biquad_coefs;
+
+/**
+ * Biquad Cascade
+ * The state of each section holds its previous two inputs and outputs packed into halfwords
+ */
+typedef struct {
+    int sections;
+    const biquad_coefs *coefs;
+    uint32_t x12[BIQUAD_MAX_SECTIONS];
+    uint32_t y12[BIQUAD_MAX_SECTIONS];
+} biquad_cascade;
+
+/**
+ * Preset cascades, generated into Src/biquad_presets.c by Tools/biquad_design.c
+ */
+extern const biquad_coefs BIQUAD_LOWPASS[1];
+extern const biquad_coefs BIQUAD_PIEZO_TONE[2];
+
+/**
+ * Initializes a cascade with cleared state
+ * @param f - the cascade to initialize
+ * @param coefs - the coefficients of each section
+ * @param sections - the number of sections, at most BIQUAD_MAX_SECTIONS, or zero to bypass
+ */
+void biquad_init(biquad_cascade *f, const biquad_coefs *coefs, int sections);
+
+/**
+ * Filters a block of samples in place through every section of a cascade
+ * @param f - the cascade to filter through
+ * @param block - the samples to filter
+ * @param n - the number of samples
+ */
+void biquad_process(biquad_cascade *f, int16_t *block, int n);
+
+/**
+ * Filters a block of samples in place through only the leading sections of a cascade
+ * The skipped sections have their history cleared so they restart cleanly once they are used again
+ * @param f - the cascade to filter through
+ * @param block - the samples to filter
+ * @param n - the number of samples
+ * @param sections - the number of leading sections to run
+ */
+void biquad_process_limited(biquad_cascade *f, int16_t *block, int n, int sections);
+
+/**
+ * Benchmarks biquad_process using the cycle counter
+ * @return the number of core cycles one section takes per sample
+ */
+int biquad_cycles_per_sample(void);
+
+# endif
@@ -0,0 +1,31 @@
+/**
+ * @file cycle_counter.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a thin wrapper around the DWT cycle counter for benchmarking
+ */
+
+# ifndef CYCLE_COUNTER_H
+# define CYCLE_COUNTER_H
+
+# include <stm32f446xx.h>
+
+/**
+ * Enables the DWT cycle counter
+ */
+static inline void cyc_init(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+ * Reads the DWT cycle counter
+ * @return the number of core cycles since the counter was enabled, modulo 2^32
+ */
+static inline uint32_t cyc_now(void) {
+    return DWT->CYCCNT;
+}
+
+# endif
@@ -0,0 +1,85 @@
+/**
+ * @file dds.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a bank of direct digital synthesis oscillators with 32-bit phase accumulators
+ */
+
+# ifndef DDS_H
+# define DDS_H
+
+# include <stdint.h>
+
+# define DDS_MAX_VOICES 16
+
+/**
+ * Converts a frequency in Hz to the Q16.16 format used by the oscillators
+ */
+# define DDS_HZ(f) ((uint32_t) ((f) * 65536))
+
+/**
+ * DDS Oscillator
+ * One full cycle of the waveform is one wrap of the 32-bit phase, so the frequency
+ * resolution is rate / 2^32 Hz (about 4 uHz at the audio rate)
+ */
+typedef struct {
+    uint32_t phase;
+    uint32_t inc;
+} dds_osc;
+
+/**
+ * DDS Oscillator Bank
+ */
+typedef struct {
+    int voices;
+    dds_osc osc[DDS_MAX_VOICES];
+} dds_bank;
+
+/**
+ * Initializes an oscillator bank with every oscillator stopped
+ * @param bank - the bank to initialize
+ * @param voices - the number of oscillators in use, at most DDS_MAX_VOICES
+ */
+void dds_init(dds_bank *bank, int voices);
+
+/**
+ * Computes the phase increment of a frequency
+ * @param frequency - the frequency in Q16.16 Hz
+ * @param rate - the rate the oscillator is stepped at in Hz
+ * @return the phase increment per step
+ */
+uint32_t dds_increment(uint32_t frequency, uint32_t rate);
+
+/**
+ * Sets the frequency of an oscillator without resetting its phase
+ * @param osc - the oscillator to modify
+ * @param frequency - the frequency in Q16.16 Hz
+ * @param rate - the rate the oscillator is stepped at in Hz
+ */
+void dds_set(dds_osc *osc, uint32_t frequency, uint32_t rate);
+
+/**
+ * Advances every oscillator of a bank by one step
+ * @param bank - the bank to advance
+ * @return the square wave output of each oscillator, one bit per oscillator
+ */
+uint32_t dds_step(dds_bank *bank);
+
+/**
+ * Renders an oscillator as a naive square wave, adding it onto a mix
+ * @param osc - the oscillator to render
+ * @param mix - the mix to add the samples to
+ * @param n - the number of samples to render
+ * @param amplitude - the amplitude of the square wave
+ */
+void dds_render_square(dds_osc *osc, int32_t *mix, int n, int32_t amplitude);
+
+/**
+ * Benchmarks dds_step with a full bank using the cycle counter
+ * @param rate - the rate the bank would be stepped at in Hz
+ * @return the number of oscillators that fit in 1 MHz of core time at that rate
+ */
+int dds_voices_per_mhz(uint32_t rate);
+
+# endif
@@ -0,0 +1,27 @@
+/**
+ * @file demo_song.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief the demo song, resolved into packed notes while the firmware builds
+ */
+
+# ifndef DEMO_SONG_H
+# define DEMO_SONG_H
+
+# ifdef __cplusplus
+extern "C" {
+# endif
+
+# include "song_bank.h"
+
+/**
+ * The demo song, to queue with mp_feed_resolved
+ */
+extern const sb_song SONG_DEMO;
+
+# ifdef __cplusplus
+}
+# endif
+
+# endif
@@ -0,0 +1,18 @@
+/**
+ * @file drum_samples.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief drum clips for the sample backend, generated into Src/drum_samples.c by Tools/adpcm_encode.c
+ */
+
+# ifndef DRUM_SAMPLES_H
+# define DRUM_SAMPLES_H
+
+# include "adpcm.h"
+
+extern const adpcm_clip DRUM_KICK;
+extern const adpcm_clip DRUM_SNARE;
+extern const adpcm_clip DRUM_HAT;
+
+# endif
@@ -0,0 +1,56 @@
+/**
+ * @file echo.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a feedback delay send effect on the mixer output
+ *
+ * Memory: one statically allocated line of ECHO_MAX_SAMPLES 16-bit samples (ECHO_BUFFER_BYTES,
+ * 15.6 KB at the default 500 ms), whether or not the effect is enabled.
+ * Cost: two Q15 multiply-accumulates, one saturate, and one load/store pair per sample, processed
+ * in contiguous runs so the circular wrap is checked once per run rather than once per sample.
+ * That is about 17 core cycles per sample, or about 1100 cycles per AUDIO_BLOCK_SIZE block, counted
+ * from the Thumb-2 inner loop at Cortex-M4 timings with zero flash wait states, under 2% of the
+ * 65536 cycles a block lasts at 16 MHz. echo_cycles_per_block measures the same figure on the
+ * target. When disabled the effect costs one flag test per block.
+ */
+
+# ifndef ECHO_H
+# define ECHO_H
+
+# include <stdint.h>
+# include "audio_driver.h"
+
+# define ECHO_MAX_DELAY_MS 500
+# define ECHO_MAX_SAMPLES ((ECHO_MAX_DELAY_MS * AUDIO_RATE) / 1000)
+# define ECHO_BUFFER_BYTES (ECHO_MAX_SAMPLES * sizeof(int16_t))
+
+/**
+ * Enables the echo with new settings, clearing the delay line
+ * @param delay_ms - the echo time in ms, at most ECHO_MAX_DELAY_MS
+ * @param feedback - the fraction of each echo fed back into the line in Q15
+ * @param send - the fraction of the mix sent into the line in Q15
+ * @param wet - the level the echoes are added back to the mix at in Q15
+ */
+void echo_enable(int delay_ms, int32_t feedback, int32_t send, int32_t wet);
+
+/**
+ * Bypasses the echo
+ */
+void echo_disable(void);
+
+/**
+ * Adds echoes onto a block of the mix in place
+ * @param mix - the mix to process
+ * @param n - the number of samples in the mix
+ */
+void echo_process(int32_t *mix, int n);
+
+/**
+ * Benchmarks echo_process using the cycle counter
+ * Runs one block through the live delay line, so call it while audio is stopped
+ * @return the number of core cycles one AUDIO_BLOCK_SIZE block takes with the echo enabled
+ */
+int echo_cycles_per_block(void);
+
+# endif
@@ -0,0 +1,79 @@
+/**
+ * @file fm_voice.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a two-operator FM voice using fixed-point phase accumulators and a Q15 sine table
+ *
+ * Cost: about 22 core cycles per sample per voice, counted from the Thumb-2 inner loop of
+ * fm_render at Cortex-M4 timings with zero flash wait states (two table lookups, two multiplies, and
+ * the mix load and store, plus the loop branch and an envelope step every FM_ENV_PERIOD samples). At
+ * 16 MHz a sample period is 1024 cycles, so each FM voice takes a little over 2% of the core.
+ * fm_cycles_per_sample measures the same figure on the target.
+ */
+
+# ifndef FM_VOICE_H
+# define FM_VOICE_H
+
+# include <stdint.h>
+# include "dds.h"
+
+# define FM_ENV_PERIOD 16 // samples per modulation index envelope step
+# define FM_INDEX(radians) ((int32_t) ((radians) * 4096 / 6.283185307)) // radians to Q12 cycles
+
+/**
+ * FM Patch
+ * ratio - modulator frequency over carrier frequency in Q8
+ * index_peak - modulation index at the start of the note, from FM_INDEX
+ * index_sustain - modulation index the envelope decays towards, from FM_INDEX
+ * decay - fraction of the distance to the sustain index kept each envelope step in Q15
+ */
+typedef struct {
+    uint32_t ratio;
+    int32_t index_peak;
+    int32_t index_sustain;
+    int32_t decay;
+} fm_patch;
+
+/**
+ * FM Voice
+ * The carrier is the oscillator the voice is rendered with, so only the modulator lives here
+ */
+typedef struct {
+    const fm_patch *patch;
+    uint32_t mod_phase;
+    uint32_t mod_inc;
+    int32_t index;
+    int env_count;
+} fm_voice;
+
+/**
+ * The patch MP_INSTR_FM notes play with, a bright electric piano
+ */
+extern const fm_patch FM_PATCH_EPIANO;
+
+/**
+ * Starts a note on an FM voice
+ * @param v - the voice to start
+ * @param patch - the patch to play the note with
+ * @param carrier - the oscillator the note is rendered with, already set to the note frequency
+ */
+void fm_start(fm_voice *v, const fm_patch *patch, const dds_osc *carrier);
+
+/**
+ * Renders an FM voice, adding it onto a mix
+ * @param v - the voice to render
+ * @param carrier - the oscillator the voice was started with
+ * @param mix - the mix to add the samples to
+ * @param n - the number of samples to render
+ * @param amplitude - the amplitude in Q15
+ */
+void fm_render(fm_voice *v, dds_osc *carrier, int32_t *mix, int n, int32_t amplitude);
+
+/**
+ * Benchmarks fm_render using the cycle counter
+ * @return the number of core cycles one voice takes per sample
+ */
+int fm_cycles_per_sample(void);
+
+# endif
@@ -0,0 +1,103 @@
+/**
+ * @file mixer.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a sample-rate voice mixer for the PWM audio backend
+ */
+
+# ifndef MIXER_H
+# define MIXER_H
+
+# include <stdint.h>
+# include "music_player_types.h"
+# include "biquad.h"
+# include "sfx.h"
+
+# define MIXER_VOICES 4
+# define MIXER_VOICE_GAIN (32767 / MIXER_VOICES)
+# define MIXER_CULL_VOICES 2 // voices kept by MIXER_TIER_CULL
+
+/**
+ * Mixer Quality Tiers
+ * The mixer steps down a tier when it falls behind the DMA and back up once it has headroom,
+ * and each tier keeps the savings of the tiers above it
+ */
+typedef enum {
+    MIXER_TIER_FULL,    // full quality
+    MIXER_TIER_NEAREST, // wavetables play without interpolation
+    MIXER_TIER_LEAN_FX, // the tone filter runs only its first section
+    MIXER_TIER_CULL     // only the loudest MIXER_CULL_VOICES voices keep playing
+} mixer_tier;
+
+/**
+ * Mixer Quality Counters
+ * tier - the active quality tier
+ * transitions - the number of times the tier has changed since mixer_init
+ */
+typedef struct {
+    mixer_tier tier;
+    uint32_t transitions;
+} mixer_quality;
+
+/**
+ * Initializes the mixer with every voice silent
+ */
+void mixer_init(void);
+
+/**
+ * Sets the tone shaping filter on the mixer output
+ * @param coefs - the coefficients of each filter section, such as BIQUAD_PIEZO_TONE
+ * @param sections - the number of sections, or zero to bypass the filter
+ */
+void mixer_set_tone(const biquad_coefs *coefs, int sections);
+
+/**
+ * Starts a note on a mixer voice
+ * @param voice - the voice to play the note on
+ * @param instrument - the instrument to play the note with
+ * @param frequency - the frequency of the note in Q16.16 Hz, or zero for a rest
+ */
+void mixer_note_on(int voice, mp_instrument instrument, uint32_t frequency);
+
+/**
+ * Starts a sound effect on a mixer voice, which frees itself when the effect ends
+ * @param voice - the voice to play the effect on
+ * @param params - the effect to play
+ */
+void mixer_sfx_on(int voice, const sfx_params *params);
+
+/**
+ * Silences a mixer voice
+ * @param voice - the voice to silence
+ */
+void mixer_note_off(int voice);
+
+/**
+ * Checks whether a mixer voice is sounding
+ * @param voice - the voice to check
+ * @return one if the voice is sounding, zero otherwise
+ */
+int mixer_active(int voice);
+
+/**
+ * Estimates how loud a mixer voice is
+ * @param voice - the voice to check
+ * @return the estimated peak amplitude of the voice, or zero if it is silent
+ */
+int mixer_level(int voice);
+
+/**
+ * Reads the active quality tier and how often it has changed
+ * @param quality - the counters to fill
+ */
+void mixer_get_quality(mixer_quality *quality);
+
+/**
+ * Renders and mixes every sounding voice
+ * @param out - the buffer to render the signed 16-bit samples into
+ * @param n - the number of samples to render
+ */
+void mixer_render(int16_t *out, int n);
+
+# endif
@@ -8,20 +8,65 @@
 
 # ifndef MUSIC_PLAYER_H
 # define MUSIC_PLAYER_H
-# endif
 
 # include "note_buffer.h"
+# include "voice_alloc.h"
+# include "rtttl.h"
+# include "smf.h"
+# include "song_bank.h"
+# include "song_codec.h"
+# include "sequencer.h"
+# include "abc.h"
+# include "tempo_map.h"
 
 /**
  * Initializes the internal note buffer
  */
 void mp_init(void);
 
+/**
+ * Selects the output the music player plays through
+ * Takes effect at the next call to mp_init
+ * @param backend - the output backend
+ */
+void mp_set_backend(mp_backend backend);
+
+/**
+ * Selects which sounding voice the sample backend steals when a note starts and every
+ * mixer voice is busy
+ * Takes effect at the next call to mp_init
+ * @param policy - the voice stealing policy
+ */
+void mp_set_steal_policy(va_policy policy);
+
+/**
+ * Sets the tempo that notes with durations in ticks play at
+ * Takes effect at the next note, and starts the song over at the start of the tempo map
+ * @param tempo - the tempo in quarter notes per minute
+ */
+void mp_set_tempo(int tempo);
+
+/**
+ * Sets the tempo map that notes with durations in ticks play by, such as one read from a song
+ * Takes effect at the next note, and starts the song over at the start of the map
+ * @param tempo - the tempo in quarter notes per minute until the first change
+ * @param changes - the tempo changes, in order of their ticks, which must stay in place
+ * @param count - the number of changes
+ */
+void mp_set_tempo_map(int tempo, const tm_change *changes, int count);
+
 /**
  * Starts playing the notes currently queued in the internal note buffer
  */
 void mp_play(void);
 
+/**
+ * Plays a MIDI file through the sample backend in place of the note queue
+ * Call after mp_init with the sample backend selected, from the same context as audio_pump
+ * @param p - the reader of the file, opened with smf_open, which must stay in place while it plays
+ */
+void mp_play_smf(smf_player *p);
+
 /**
  * Stops playing notes
  */
@@ -39,6 +84,75 @@ void mp_add_note(mp_note * n);
  */
 void mp_add_song(mp_song * s);
 
+/**
+ * Queues the notes of an RTTTL song as space frees up in the note queue, never holding more
+ * of the song than the queue does
+ * Call repeatedly, such as from the idle loop, until it returns zero
+ * @param p - the parser reading the song, opened with rtttl_open
+ * @return one while the song has notes left to queue, zero once they have all been queued
+ */
+int mp_feed_rtttl(rtttl_parser *p);
+
+/**
+ * Queues the notes of a packed song from a song bank as space frees up in the note queue, reading
+ * them in place from flash
+ * Call repeatedly, such as from the idle loop, until it returns zero
+ * @param r - the reader of the song, opened with sb_open
+ * @return one while the song has notes left to queue, zero once they have all been queued
+ */
+int mp_feed_song(sb_reader *r);
+
+/**
+ * Queues the notes of a packed song that song_dsl.hpp resolved while the firmware built, as space
+ * frees up in the note queue, without converting them again
+ * Call repeatedly, such as from the idle loop, until it returns zero
+ * @param r - the reader of the song, opened with sb_open
+ * @return one while the song has notes left to queue, zero once they have all been queued
+ */
+int mp_feed_resolved(sb_reader *r);
+
+/**
+ * Queues the notes of a compressed song from a song bank as space frees up in the note queue,
+ * decoding them in place from flash
+ * Call repeatedly, such as from the idle loop, until it returns zero
+ * @param d - the decoder of the song, opened with sc_open
+ * @return one while the song has notes left to queue, zero once they have all been queued
+ */
+int mp_feed_compressed(sc_decoder *d);
+
+/**
+ * Queues the notes of a sequence from a song bank as space frees up in the note queue, running
+ * its patterns and loops in place from flash
+ * Call repeatedly, such as from the idle loop, until it returns zero, which a looping song never does
+ * @param vm - the sequencer playing the song, opened with seq_open
+ * @return one while the song has notes left to queue, zero once they have all been queued
+ */
+int mp_feed_sequence(seq_vm *vm);
+
+/**
+ * Queues the notes of an ABC tune as space frees up in the note queue, reading the text in place
+ * Call repeatedly, such as from the idle loop, until it returns zero
+ * @param p - the parser of the tune, opened with abc_open
+ * @return one while the tune has notes left to queue, zero once they have all been queued
+ */
+int mp_feed_abc(abc_parser *p);
+
+/**
+ * Starts playing a song from the linked song banks by its id, found through the bank's index in
+ * constant time, at the tempo the index gives for it
+ * MIDI files play through the sample backend, so it must be selected for them
+ * @param id - the id of the song
+ * @return one if the song started, zero if there is no such song or it cannot be played
+ */
+int mp_play_library(int id);
+
+/**
+ * Queues more of the song mp_play_library started as space frees up in the note queue
+ * Call repeatedly, such as from the idle loop, until it returns zero
+ * @return one while the song has notes left to queue, zero once they have all been queued
+ */
+int mp_feed_library(void);
+
 /**
  * Clears all notes from the note queue
  */
@@ -46,7 +160,10 @@ void mp_clear(void);
 
 /**
  * Converts a non-keys note to a keys note
+ * Drums take their preset length, in ticks if their part is in ticks and in ms otherwise
  * @param n - the note to convert
  * @return the converted note
  */
-void mp_conv_to_keys(mp_note * n);
\ No newline at end of file
+void mp_conv_to_keys(mp_note * n);
+
+# endif
@@ -7,7 +7,8 @@
 
 # ifndef MUSIC_H
 # define MUSIC_H
-# endif
+
+# include "tempo_map.h"
 
 # define MAX_SONG_LENGTH 256
 
@@ -33,26 +34,69 @@
 
 /**
  * Music Player Preset Instrument Durations
+ * A drum written in ticks takes the length in ticks, so it keeps to the song's tempo and moves the
+ * tempo map on, and a drum written in ms takes the length in ms at MP_TEMPO
  */
 # define MP_INSTR_HAT_DURATION MP_NOTE_SIXTEENTH
 # define MP_INSTR_KICK_DURATION MP_NOTE_EIGTH
 # define MP_INSTR_SNARE_DURATION MP_NOTE_EIGTH
+# define MP_INSTR_HAT_TICKS TM_SIXTEENTH
+# define MP_INSTR_KICK_TICKS TM_EIGHTH
+# define MP_INSTR_SNARE_TICKS TM_EIGHTH
 
 /**
  * Music Player Instruments
  */
 typedef enum {
+    MP_INSTR_FM,
     MP_INSTR_HAT,
     MP_INSTR_KEYS,
     MP_INSTR_KICK,
     MP_INSTR_NONE,
+    MP_INSTR_PLUCK,
     MP_INSTR_REST,
+    MP_INSTR_SAW,
+    MP_INSTR_SFX,
     MP_INSTR_SNARE,
     MP_INSTR_END
 } mp_instrument;
 
+/**
+ * Music Player Output Backends
+ */
+typedef enum {
+    MP_BACKEND_PIEZO,
+    MP_BACKEND_PCM,
+    MP_BACKEND_BITBANG
+} mp_backend;
+
+/**
+ * Music Player Pitch Effects
+ */
+typedef enum {
+    MP_FX_NONE,
+    MP_FX_VIBRATO,
+    MP_FX_PORTA_LINEAR,
+    MP_FX_PORTA_EXP,
+    MP_FX_BEND
+} mp_fx_type;
+
+/**
+ * Music Player Pitch Effect
+ * depth - vibrato depth or bend amount in sixteenths of a semitone
+ * rate - vibrato rate in tenths of a hertz or bend time in milliseconds
+ */
+typedef struct {
+    mp_fx_type type;
+    int depth;
+    int rate;
+} mp_fx;
+
 /**
  * Music Player Note
+ * frequency - a number of Hz, a MIDI note made with TN_PITCH in tuning.h, or a sound effect preset
+ * tempo - the tempo in quarter notes per minute that durations in ticks play at from this note on,
+ * or zero to keep the tempo
  */
 typedef struct {
 
@@ -66,6 +110,13 @@ typedef struct {
     int dual_duration;
     int dual_frequency;
 
+    // pitch effects
+    mp_fx fx;
+    mp_fx dual_fx;
+
+    // tempo change
+    int tempo;
+
 } mp_note;
 
 /**
@@ -73,4 +124,6 @@ typedef struct {
  */
 typedef struct {
     mp_note *notes;
-} mp_song;
\ No newline at end of file
+} mp_song;
+
+# endif
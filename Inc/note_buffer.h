@@ -8,8 +8,8 @@
 
 # ifndef NOTEBUFFER_H
 # define NOTEBUFFER_H
-# endif
 
+# include <stddef.h>
 # include "music_player_types.h"
 
 # define NOTE_BUFFER_SIZE 256
@@ -49,6 +49,13 @@ void nb_push(note_buffer *nb, mp_note n);
  */
 mp_note nb_pull(note_buffer *nb);
 
+/**
+ * Returns the next element of the note buffer without pulling it
+ * @param nb - the note buffer to peek into
+ * @return a pointer to the next note, or NULL if the buffer is empty
+ */
+mp_note * nb_peek(note_buffer *nb);
+
 /**
  * Clears all values from the note buffer
  * @param nb - the note buffer to clear
@@ -68,3 +75,5 @@ int nb_isempty(note_buffer *nb);
  * @return One if the note buffer is full, zero otherwise
  */
 int nb_isfull(note_buffer *nb);
+
+# endif
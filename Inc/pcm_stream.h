@@ -0,0 +1,65 @@
+/**
+ * @file pcm_stream.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief plays PCM streamed over USART2, resampling to track the sender's clock
+ *
+ * The sender streams mono audio at AUDIO_RATE, as either unsigned 8-bit samples or a headerless
+ * IMA-ADPCM code stream (low nibble first), with Tools/pcm_send.c. The DMA ring of the UART is the
+ * jitter buffer. Playback starts once STREAM_TARGET_FILL samples are buffered, and the playback
+ * rate is then trimmed so the fill stays at that target however far the two clocks drift apart.
+ */
+
+# ifndef PCM_STREAM_H
+# define PCM_STREAM_H
+
+# include <stdint.h>
+
+# define STREAM_BAUD 230400
+# define STREAM_TARGET_FILL 1024 // samples buffered ahead of playback
+# define STREAM_MAX_DRIFT_PPM 2000 // largest clock difference the resampler tracks
+
+/**
+ * Stream Formats
+ */
+typedef enum {
+    STREAM_PCM_U8,
+    STREAM_ADPCM
+} stream_format;
+
+/**
+ * Stream Counters
+ * underruns - times the buffer ran dry and playback paused to refill
+ * overruns - times the sender lapped the buffer and samples were dropped
+ * fill - the samples buffered in the UART ring
+ * latency - the samples between the newest received sample and the output, including the audio FIFO
+ * drift_ppm - the correction the resampler is applying, positive when the sender runs fast
+ */
+typedef struct {
+    uint32_t underruns;
+    uint32_t overruns;
+    uint32_t fill;
+    uint32_t latency;
+    int32_t drift_ppm;
+} stream_stats;
+
+/**
+ * Starts receiving and playing a stream through the PWM audio output
+ * audio_pump must be called from the idle loop while the stream plays
+ * @param format - the format the sender streams in
+ */
+void stream_start(stream_format format);
+
+/**
+ * Stops receiving and playing the stream
+ */
+void stream_stop(void);
+
+/**
+ * Reads the stream counters
+ * @param stats - the counters to fill
+ */
+void stream_get_stats(stream_stats *stats);
+
+# endif
@@ -0,0 +1,65 @@
+/**
+ * @file pitch_fx.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief control-rate pitch effects (vibrato, portamento, and bends) for the piezo buzzers
+ */
+
+# ifndef PITCH_FX_H
+# define PITCH_FX_H
+
+# include "piezo_driver.h"
+# include "sfx.h"
+
+# define FX_STEPS_PER_SEMITONE 16
+# define FX_STEPS_PER_OCTAVE (12 * FX_STEPS_PER_SEMITONE)
+# define FX_TICK_FREQ 1000 // Hz
+
+/**
+ * Starts the pitch effect of a note on a buzzer
+ * @param buzzer - the buzzer the note is playing on
+ * @param fx - the pitch effect of the note
+ * @param duration - the duration of the note in ms
+ * @param frequency - the frequency of the note
+ * @param next_frequency - the frequency of the following note, or zero if there is none
+ */
+void fx_start(piezo_buzzer buzzer, mp_fx fx, int duration, int frequency, int next_frequency);
+
+/**
+ * Starts a sound effect on a buzzer, which drives its pitch until the effect ends
+ * The buzzer plays the frequency and envelope gate of the effect, since it has no duty or level
+ * @param buzzer - the buzzer the effect is playing on
+ * @param params - the effect to play
+ */
+void fx_start_sfx(piezo_buzzer buzzer, const sfx_params *params);
+
+/**
+ * Stops the pitch effects of a buzzer
+ * @param buzzer - the buzzer to stop the effects of
+ */
+void fx_stop(piezo_buzzer buzzer);
+
+/**
+ * Advances all running pitch effects by one control tick
+ * Must be called at FX_TICK_FREQ
+ */
+void fx_tick(void);
+
+/**
+ * Scales a tone period by a pitch offset
+ * @param period - the tone period to scale
+ * @param steps - the pitch offset in sixteenths of a semitone, positive is higher
+ * @return the scaled tone period
+ */
+int fx_scale(int period, int steps);
+
+/**
+ * Measures the interval between two tone periods
+ * @param from - the starting tone period
+ * @param to - the ending tone period
+ * @return the interval in sixteenths of a semitone, positive is higher
+ */
+int fx_interval(int from, int to);
+
+# endif
@@ -0,0 +1,50 @@
+/**
+ * @file pluck_voice.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a Karplus-Strong plucked string voice with delay lines in a fixed SRAM pool
+ */
+
+# ifndef PLUCK_VOICE_H
+# define PLUCK_VOICE_H
+
+# include <stdint.h>
+
+# define KS_VOICES 4
+# define KS_MIN_FREQ 55 // Hz, the lowest pitch a full-length delay line can hold
+# define KS_MAX_DELAY 288 // samples, AUDIO_RATE / KS_MIN_FREQ rounded up to a multiple of 8
+# define KS_POOL_BYTES (KS_VOICES * KS_MAX_DELAY * sizeof(int16_t))
+
+/**
+ * Pluck Voice
+ * Each voice owns one slot of the delay line pool, so RAM use is fixed at KS_POOL_BYTES
+ */
+typedef struct {
+    int16_t *line;
+    int length;
+    int position;
+    int32_t coef;   // fractional delay all-pass coefficient in Q15
+    int32_t ap_in;  // previous all-pass input
+    int32_t ap_out; // previous all-pass output
+} ks_voice;
+
+/**
+ * Plucks a string, filling its delay line with noise
+ * @param v - the voice to pluck
+ * @param slot - the delay line pool slot the voice uses, below KS_VOICES
+ * @param frequency - the frequency in Q16.16 Hz
+ */
+void ks_start(ks_voice *v, int slot, uint32_t frequency);
+
+/**
+ * Renders a plucked string, adding it onto a mix
+ * The cost per sample is the same at every pitch
+ * @param v - the voice to render
+ * @param mix - the mix to add the samples to
+ * @param n - the number of samples to render
+ * @param amplitude - the amplitude in Q15
+ */
+void ks_render(ks_voice *v, int32_t *mix, int n, int32_t amplitude);
+
+# endif
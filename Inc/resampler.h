@@ -0,0 +1,81 @@
+/**
+ * @file resampler.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a sample playback voice that resamples one recording to any pitch
+ */
+
+# ifndef RESAMPLER_H
+# define RESAMPLER_H
+
+# include <stdint.h>
+
+# define RS_MAX_LENGTH 32767 // samples, keeping the 16.16 phase clear of overflow
+# define RS_MAX_STEP (32 << 16) // fastest playback, five octaves above the recording's own rate
+
+/**
+ * Resampler Interpolation Modes
+ */
+typedef enum {
+    RS_NEAREST,
+    RS_LINEAR,
+    RS_HERMITE
+} rs_interp;
+
+/**
+ * Resampler Recording
+ * Interpolation reads around the playback position, so the data must hold one guard sample before
+ * the first sample and two after the last one (or after the loop end, continuing from the loop start)
+ * root - the pitch of the recording in Q16.16 Hz
+ * rate - the rate the recording was made at in Hz
+ * loop_length - the length of the sustain loop, or zero to play the recording once
+ */
+typedef struct {
+    const int16_t *data;
+    uint32_t length;
+    uint32_t loop_start;
+    uint32_t loop_length;
+    uint32_t root;
+    uint32_t rate;
+} rs_sample;
+
+/**
+ * Resampler Voice
+ * The phase is the playback position in the recording in 16.16 samples
+ */
+typedef struct {
+    const rs_sample *sample;
+    uint32_t phase;
+    uint32_t step;
+    rs_interp interp;
+} rs_voice;
+
+/**
+ * Starts playing a recording from its beginning at a pitch
+ * @param v - the voice to start
+ * @param sample - the recording to play
+ * @param frequency - the pitch to play at in Q16.16 Hz
+ * @param rate - the rate the voice is rendered at in Hz
+ * @param interp - the interpolation to resample with
+ */
+void rs_start(rs_voice *v, const rs_sample *sample, uint32_t frequency, uint32_t rate, rs_interp interp);
+
+/**
+ * Resamples the next samples of a recording, adding them onto a mix
+ * @param v - the voice to render
+ * @param mix - the mix to add the samples to
+ * @param n - the number of samples to render
+ * @param amplitude - the amplitude in Q15
+ * @return one while the recording has samples left, zero once it has finished
+ */
+int rs_render(rs_voice *v, int32_t *mix, int n, int32_t amplitude);
+
+/**
+ * Benchmarks rs_render using the cycle counter
+ * @param interp - the interpolation to benchmark
+ * @return the number of core cycles the voice takes per output sample
+ */
+int rs_cycles_per_sample(rs_interp interp);
+
+# endif
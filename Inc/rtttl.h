@@ -0,0 +1,60 @@
+/**
+ * @file rtttl.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a resumable parser that reads RTTTL ringtone text one note at a time
+ *
+ * An RTTTL song is a name, a defaults section, and a comma separated list of notes, such as
+ *     Tetris:d=4,o=5,b=160:e6,8b,8c6,8d6,16e6,16d6,8c6,8b,a,8a,8c6,e6,8d6,8c6,b,8b,8c6,d6,e6
+ * Each note is [duration] letter [#] [.] [octave] [.], where the letter is a to g, h (which is b),
+ * or p for a rest. The parser only keeps its position in the text, so a song is converted as it
+ * plays rather than all at once. Durations are given in ticks, with the song's tempo carried by its
+ * first note, so the player's tempo map times them without a rounded ms on every note.
+ */
+
+# ifndef RTTTL_H
+# define RTTTL_H
+
+# include "music_player_types.h"
+# include "tempo_map.h"
+
+# define RTTTL_DEFAULT_DURATION 4
+# define RTTTL_DEFAULT_OCTAVE 6
+# define RTTTL_DEFAULT_BPM 63
+
+/**
+ * RTTTL Parser
+ * name - the song's name, which is not null terminated in the text
+ * retimed - one until the note that carries the song's tempo has been read, zero after
+ * errors - the number of malformed notes skipped so far
+ */
+typedef struct {
+    const char *next;
+    const char *name;
+    int name_length;
+    int duration;
+    int octave;
+    int bpm;
+    int retimed;
+    int errors;
+} rtttl_parser;
+
+/**
+ * Opens an RTTTL song, reading its name and defaults
+ * The text must stay in place until the last note has been read
+ * @param p - the parser to open the song with
+ * @param text - the null terminated song
+ * @return one if the song has a valid header, zero otherwise
+ */
+int rtttl_open(rtttl_parser *p, const char *text);
+
+/**
+ * Reads the next note of a song, skipping any malformed notes
+ * @param p - the parser reading the song
+ * @param n - the note to fill
+ * @return one if a note was read, zero at the end of the song
+ */
+int rtttl_next(rtttl_parser *p, mp_note *n);
+
+# endif
@@ -0,0 +1,106 @@
+/**
+ * @file sequencer.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a tracker style sequencer that plays songs written as bytecode, one note at a time
+ *
+ * A sequence is a program of one byte opcodes, each followed by its operands, with every offset a
+ * little-endian halfword counted from the start of the program, which is where it starts playing:
+ *     SEQ_END - the song is over
+ *     SEQ_NOTE instrument, ticks, frequency (halfword) - a note with an empty dual part
+ *     SEQ_DUAL the same twice - a note with a dual part
+ *     SEQ_REST ticks - a rest
+ *     SEQ_CALL offset - plays the pattern at offset, then comes back
+ *     SEQ_REPEAT count, offset - plays the pattern at offset count times, then comes back
+ *     SEQ_RETURN - ends a pattern
+ *     SEQ_JUMP offset - carries on from offset, such as to loop a song forever
+ *     SEQ_TEMPO tempo (halfword) - sets the tempo in quarter notes per minute
+ * Lengths are in ticks, SEQ_TICKS_PER_QUARTER to a quarter note, and reach the player as TM_TICKS
+ * at TM_PPQ, so the player's tempo map times them. A tempo change rides on the next note played, so
+ * the map takes it up from there. Frequencies follow mp_note, so drums may leave theirs at zero and
+ * sound effects give their preset.
+ *
+ * A pattern is stored once however many times it plays, and a looping song never needs more than
+ * the sequencer's own state, as nothing is expanded into RAM ahead of being played. Patterns may
+ * call other patterns up to SEQ_MAX_DEPTH deep, and seq_next runs at most SEQ_MAX_STEPS opcodes
+ * before giving up on a program that never reaches a note.
+ */
+
+# ifndef SEQUENCER_H
+# define SEQUENCER_H
+
+# include <stdint.h>
+# include "music_player_types.h"
+# include "song_bank.h"
+# include "tempo_map.h"
+
+# define SEQ_TICKS_PER_QUARTER 24
+# define SEQ_MAX_DEPTH 4
+# define SEQ_MAX_STEPS 16
+
+// a length in the program must be a whole number of player ticks, and a byte of them must fit
+# if TM_PPQ % SEQ_TICKS_PER_QUARTER || 255 * (TM_PPQ / SEQ_TICKS_PER_QUARTER) > TM_MAX_TICKS
+# error "SEQ_TICKS_PER_QUARTER must divide TM_PPQ, with a byte of ticks no longer than TM_MAX_TICKS"
+# endif
+
+/**
+ * Sequencer Opcodes
+ */
+typedef enum {
+    SEQ_END,
+    SEQ_NOTE,
+    SEQ_DUAL,
+    SEQ_REST,
+    SEQ_CALL,
+    SEQ_REPEAT,
+    SEQ_RETURN,
+    SEQ_JUMP,
+    SEQ_TEMPO
+} seq_opcode;
+
+/**
+ * Sequencer Call Frame
+ * back - where to carry on once the pattern has played
+ * start - the start of the pattern, to play it again from
+ * left - how many more times the pattern plays
+ */
+typedef struct {
+    uint16_t back;
+    uint16_t start;
+    uint8_t left;
+} seq_frame;
+
+/**
+ * Sequencer
+ * retimed - one if the tempo has changed since the last note was played, zero otherwise
+ * errors - one if the song ended early on a malformed program, zero otherwise
+ */
+typedef struct {
+    const uint8_t *program;
+    uint32_t length;
+    uint32_t pc;
+    int tempo;
+    int retimed;
+    seq_frame stack[SEQ_MAX_DEPTH];
+    int depth;
+    int errors;
+} seq_vm;
+
+/**
+ * Starts playing a sequence
+ * @param vm - the sequencer to start
+ * @param song - a song in the SB_FORMAT_SEQUENCE format
+ * @return one if the song is a sequence, zero otherwise
+ */
+int seq_open(seq_vm *vm, const sb_song *song);
+
+/**
+ * Runs a sequence up to its next note
+ * @param vm - the sequencer playing the song
+ * @param n - the note to fill
+ * @return one if a note was played, zero at the end of the song
+ */
+int seq_next(seq_vm *vm, mp_note *n);
+
+# endif
@@ -0,0 +1,105 @@
+/**
+ * @file sfx.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a parametric sound effect generator evaluated at control rate
+ */
+
+# ifndef SFX_H
+# define SFX_H
+
+# include <stdint.h>
+
+# define SFX_TICK_FREQ 1000 // Hz
+# define SFX_LEVEL_MAX 32767
+# define SFX_DUTY_MAX 256
+# define SFX_MIN_FREQ 20 // Hz, effects that slide below this end early
+
+/**
+ * Sound Effect Parameters
+ * Pitches are in sixteenths of a semitone like the pitch effects, and rates are per second
+ */
+typedef struct {
+    int frequency;     // starting frequency in Hz
+    int slide;         // pitch slide in sixteenths of a semitone per second
+    int slide_accel;   // change of the slide in sixteenths of a semitone per second per second
+    int duty;          // starting duty cycle in 256ths
+    int duty_sweep;    // change of the duty cycle in 256ths per second
+    int vibrato_depth; // vibrato depth in sixteenths of a semitone
+    int vibrato_rate;  // vibrato rate in tenths of a hertz
+    int noise;         // one to play noise clocked at the frequency instead of a square wave
+    int attack;        // time to rise to full level in ms
+    int sustain;       // time to hold full level in ms
+    int decay;         // time to fall to silence in ms
+} sfx_params;
+
+/**
+ * Sound Effect State
+ * The outputs of the last tick are the frequency, duty, and level fields
+ */
+typedef struct {
+    const sfx_params *params;
+    int32_t pitch;      // pitch offset from the starting frequency in Q16 sixteenths of a semitone
+    int32_t slide;      // pitch change per tick in Q16 sixteenths of a semitone
+    int32_t duty_q16;   // duty cycle in Q16 256ths
+    uint32_t lfo_phase; // vibrato phase, one cycle per wrap
+    uint32_t lfo_inc;   // vibrato phase increment per tick
+    int elapsed;        // ticks since the effect started
+    int frequency;      // output frequency in Hz
+    int duty;           // output duty cycle in 256ths
+    int level;          // output level from zero to SFX_LEVEL_MAX
+} sfx_state;
+
+/**
+ * Sound Effect Presets
+ */
+typedef enum {
+    SFX_BLIP,
+    SFX_COIN,
+    SFX_EXPLOSION,
+    SFX_HIT,
+    SFX_JUMP,
+    SFX_LASER,
+    SFX_POWERUP,
+    SFX_PRESET_COUNT
+} sfx_preset_id;
+
+extern const sfx_params SFX_PRESETS[SFX_PRESET_COUNT];
+
+/**
+ * Looks up a preset effect
+ * @param id - the preset to look up
+ * @return the parameters of the preset, or zero if there is no such preset
+ */
+const sfx_params * sfx_preset(int id);
+
+/**
+ * Measures how long an effect plays for if it does not slide out of range first
+ * @param params - the effect to measure
+ * @return the duration of the effect in ms
+ */
+int sfx_duration(const sfx_params *params);
+
+/**
+ * Starts an effect from its first tick
+ * @param s - the state to start
+ * @param params - the effect to play
+ */
+void sfx_start(sfx_state *s, const sfx_params *params);
+
+/**
+ * Advances an effect by one control tick and updates its outputs
+ * Must be called at SFX_TICK_FREQ
+ * @param s - the effect to advance
+ * @return one while the effect is playing, zero once it has finished
+ */
+int sfx_tick(sfx_state *s);
+
+/**
+ * Steps the noise generator shared by every effect
+ * @return sixteen fresh pseudo-random bits
+ */
+uint32_t sfx_noise(void);
+
+# endif
@@ -0,0 +1,24 @@
+/**
+ * @file sine_table.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a Q15 sine table in flash, generated into Src/sine_table.c by Tools/sine_gen.c
+ */
+
+# ifndef SINE_TABLE_H
+# define SINE_TABLE_H
+
+# include <stdint.h>
+
+# define SINE_SIZE_BITS 10
+# define SINE_SIZE (1 << SINE_SIZE_BITS)
+
+/**
+ * Looks up the sine of a 32-bit phase, where one cycle is one wrap of the phase
+ */
+# define SINE_OF(phase) (SINE_Q15[(uint32_t) (phase) >> (32 - SINE_SIZE_BITS)])
+
+extern const int16_t SINE_Q15[SINE_SIZE];
+
+# endif
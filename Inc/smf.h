@@ -0,0 +1,112 @@
+/**
+ * @file smf.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a streaming Standard MIDI File reader that merges every track into one event stream
+ *
+ * The file is read in place from flash or RAM. Each track keeps only its read position, the tick
+ * of its next event, and its running status, and a min-heap of the tracks keyed on that tick
+ * yields the events of a type 0 or type 1 file in time order.
+ */
+
+# ifndef SMF_H
+# define SMF_H
+
+# include <stdint.h>
+
+# define SMF_MAX_TRACKS 16
+# define SMF_DEFAULT_TEMPO 500000 // microseconds per quarter note, 120 bpm
+
+/**
+ * MIDI Event Types
+ * Events other than these, such as system exclusive messages and most meta events, are skipped
+ */
+typedef enum {
+    SMF_NOTE_OFF,
+    SMF_NOTE_ON,
+    SMF_CONTROL,
+    SMF_PROGRAM,
+    SMF_PITCH_BEND,
+    SMF_TEMPO
+} smf_event_type;
+
+/**
+ * MIDI Event
+ * key and value are the two data bytes of a channel message, a program change carries its program
+ * in key, a pitch bend carries its 14-bit value in value, and a tempo change carries its tempo in
+ * microseconds per quarter note in value
+ * time_us - the time of the event from the start of the file in microseconds
+ */
+typedef struct {
+    smf_event_type type;
+    uint8_t channel;
+    uint8_t track;
+    uint8_t key;
+    uint32_t value;
+    uint32_t tick;
+    uint32_t time_us;
+} smf_event;
+
+/**
+ * MIDI Track Reader
+ */
+typedef struct {
+    const uint8_t *pos;
+    const uint8_t *end;
+    uint32_t tick;
+    uint8_t status;
+} smf_track;
+
+/**
+ * MIDI File Reader
+ * tracks - the number of tracks with events left, which are the first entries of the heap
+ * division - ticks per quarter note
+ * tempo - the current tempo in microseconds per quarter note
+ * errors - the number of tracks cut short by malformed events
+ */
+typedef struct {
+    smf_track track[SMF_MAX_TRACKS];
+    uint8_t heap[SMF_MAX_TRACKS];
+    int tracks;
+    uint16_t division;
+    uint32_t tempo;
+    uint32_t tempo_tick;
+    uint64_t tempo_us;
+    int errors;
+} smf_player;
+
+/**
+ * Opens a MIDI file held in memory
+ * The file must stay in place until its last event has been read
+ * @param p - the reader to open the file with
+ * @param data - the contents of the file
+ * @param length - the length of the file in bytes
+ * @return one if the file is a type 0 or 1 file with a ticks per quarter note division, zero otherwise
+ */
+int smf_open(smf_player *p, const uint8_t *data, uint32_t length);
+
+/**
+ * Reads the next event of the file in time order
+ * @param p - the reader reading the file
+ * @param e - the event to fill
+ * @return one if an event was read, zero at the end of the file
+ */
+int smf_next(smf_player *p, smf_event *e);
+
+/**
+ * Converts a MIDI note number to a frequency in the build's temperament, where note 69 is A4
+ * @param note - the note number, from 0 to 127
+ * @return the frequency of the note in Q16.16 Hz
+ */
+uint32_t smf_note_frequency(int note);
+
+/**
+ * Benchmarks smf_next using the cycle counter
+ * @param data - the contents of a file to read
+ * @param length - the length of the file in bytes
+ * @return the average number of core cycles it takes to read one event, or zero if the file has none
+ */
+int smf_cycles_per_event(const uint8_t *data, uint32_t length);
+
+# endif
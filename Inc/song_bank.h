@@ -0,0 +1,179 @@
+/**
+ * @file song_bank.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief reads the song banks Tools/songc links into the .songs flash section, in place
+ *
+ * A bank is a header, an index of its songs, a table of slots from song ids to the index, and the
+ * songs themselves, every part aligned to four bytes and stored little-endian. Any number of banks
+ * may be linked, and they are read back to back as one library of songs.
+ *
+ * Each index entry is the same size and holds everything needed to list a song, its id, name,
+ * format, tempo, voices, and playing time, so the library can be listed without reading a song, and
+ * a song is found by its id through the slot table in constant time in each bank. The header keeps
+ * a CRC of the index and slot table, and each entry a CRC of its song, so that a bank can be
+ * checked with sb_check before it is trusted, and a song with sb_verify before it is played.
+ */
+
+# ifndef SONG_BANK_H
+# define SONG_BANK_H
+
+# include <stdint.h>
+# include "music_player_types.h"
+
+# define SB_MAGIC 0x4B4E4253 // "SBNK"
+# define SB_VERSION 2
+# define SB_NAME_LENGTH 12
+# define SB_NOTE_SIZE 10 // bytes per packed note
+# define SB_MAX_ID 1024 // song ids run from zero up to this, exclusive
+# define SB_NO_SONG 0xFFFF // a slot with no song
+# define SB_LOOPS 0xFFFFFFFF // the playing time of a song that loops forever
+
+/**
+ * Song Formats
+ * SB_FORMAT_NOTES - packed notes, each a little-endian duration, frequency, dual duration, and dual
+ * frequency of two bytes, then an instrument and a dual instrument of one byte
+ * SB_FORMAT_SMF - a Standard MIDI File, played with smf_open and mp_play_smf
+ * SB_FORMAT_COMPRESSED - compressed notes, read with sc_open and mp_feed_compressed
+ * SB_FORMAT_SEQUENCE - a sequencer program, played with seq_open and mp_feed_sequence
+ */
+typedef enum {
+    SB_FORMAT_NOTES,
+    SB_FORMAT_SMF,
+    SB_FORMAT_COMPRESSED,
+    SB_FORMAT_SEQUENCE
+} sb_format;
+
+/**
+ * Song Bank Index Entry
+ * offset - the start of the song from the start of its bank
+ * crc - the CRC-32 of the song
+ * duration - the song's playing time in ms, SB_LOOPS if it never ends, or zero if it is not known
+ * tempo - the tempo the song starts at in quarter notes per minute
+ * voices - the most parts the song sounds at once
+ * name - the song's name, null padded and only null terminated when shorter than SB_NAME_LENGTH
+ */
+typedef struct {
+    uint32_t offset;
+    uint32_t length;
+    uint32_t crc;
+    uint32_t duration;
+    uint16_t id;
+    uint16_t tempo;
+    uint8_t format;
+    uint8_t voices;
+    uint8_t reserved[2];
+    char name[SB_NAME_LENGTH];
+} sb_entry;
+
+/**
+ * Song Bank Header
+ * size - the length of the whole bank, so the next bank starts this many bytes on
+ * slots - the length of the slot table after the index, one more than the highest song id
+ * crc - the CRC-32 of the index and slot table
+ */
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+    uint32_t size;
+    uint16_t slots;
+    uint16_t reserved;
+    uint32_t crc;
+    sb_entry entry[];
+} sb_header;
+
+/**
+ * Song
+ * id, tempo, voices, duration, crc - as in the song's index entry
+ */
+typedef struct {
+    const uint8_t *data;
+    uint32_t length;
+    sb_format format;
+    const char *name;
+    int id;
+    int tempo;
+    int voices;
+    uint32_t duration;
+    uint32_t crc;
+} sb_song;
+
+/**
+ * Packed Note Reader
+ */
+typedef struct {
+    const uint8_t *pos;
+    const uint8_t *end;
+} sb_reader;
+
+/**
+ * Counts the songs in every linked bank
+ * @return the number of songs
+ */
+int sb_count(void);
+
+/**
+ * Looks up a song by its position in the linked banks
+ * @param index - the position of the song
+ * @param song - the song to fill
+ * @return one if the song exists, zero otherwise
+ */
+int sb_get(int index, sb_song *song);
+
+/**
+ * Looks up a song by its id in constant time, without reading any other song
+ * @param id - the id of the song
+ * @param song - the song to fill
+ * @return one if there is a song with that id, zero otherwise
+ */
+int sb_find_id(int id, sb_song *song);
+
+/**
+ * Looks up a song by name
+ * @param name - the name of the song
+ * @param song - the song to fill
+ * @return the position of the song, or -1 if there is no song by that name
+ */
+int sb_find(const char *name, sb_song *song);
+
+/**
+ * Computes the CRC-32 of some bytes, as zlib and the song bank compiler do
+ * @param crc - the CRC of the bytes before these, or zero to start
+ * @param data - the bytes
+ * @param length - the number of bytes
+ * @return the CRC of all the bytes so far
+ */
+uint32_t sb_crc(uint32_t crc, const uint8_t *data, uint32_t length);
+
+/**
+ * Checks a song against the CRC in its index entry
+ * @param song - the song to check
+ * @return one if the song is whole, zero otherwise
+ */
+int sb_verify(const sb_song *song);
+
+/**
+ * Checks the index and slot table of every linked bank against their CRCs, and every song against
+ * its own
+ * @return the number of banks and songs that failed, or zero if the whole library is whole
+ */
+int sb_check(void);
+
+/**
+ * Starts reading the packed notes of a song
+ * @param r - the reader to start
+ * @param song - a song in the SB_FORMAT_NOTES format
+ */
+void sb_open(sb_reader *r, const sb_song *song);
+
+/**
+ * Reads the next packed note of a song
+ * @param r - the reader reading the song
+ * @param n - the note to fill
+ * @return one if a note was read, zero at the end of the song
+ */
+int sb_next(sb_reader *r, mp_note *n);
+
+# endif
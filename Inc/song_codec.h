@@ -0,0 +1,88 @@
+/**
+ * @file song_codec.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a compressed song format and a streaming decoder that reads it one note at a time
+ *
+ * A compressed song starts with a dictionary of up to fifteen durations, a count byte followed by
+ * little-endian halfwords, then a stream of tokens:
+ *     0iii dddd - a part played alone, with the dual part left empty
+ *     10nn nnnn - the previous note again, n + 1 more times
+ *     1100 0000 - the next two parts are one note, its main and dual parts
+ * A part's iii is its instrument, from SC_CODES, and dddd indexes its duration in the dictionary,
+ * with fifteen instead followed by the duration as a halfword. Parts that have a pitch are then
+ * followed by the change from the previous frequency or pitch of that voice, zigzag coded into one
+ * to three bytes of seven bits, low bits first. Rests and drums have no pitch.
+ *
+ * Every token is decoded in a bounded number of steps, reading at most SC_MAX_TOKEN bytes, and the
+ * decoder keeps all of its state in its own struct, so notes can be pulled from an interrupt.
+ */
+
+# ifndef SONG_CODEC_H
+# define SONG_CODEC_H
+
+# include <stdint.h>
+# include "music_player_types.h"
+# include "song_bank.h"
+
+# define SC_MAX_DURATIONS 15
+# define SC_ESCAPE 15 // duration index of a duration written in full
+# define SC_MAX_RUN 64
+# define SC_MAX_TOKEN 13 // bytes in the longest token, a note of two parts with full durations
+
+/**
+ * Compressed Song Decoder
+ * durations - the dictionary, which stays in place in the song
+ * frequency - the previous pitch of each voice, which the next pitch is coded from
+ * repeats - how many more times the previous note plays before the next token is read
+ * errors - one if the song ended early on a malformed token, zero otherwise
+ */
+typedef struct {
+    const uint8_t *pos;
+    const uint8_t *end;
+    const uint8_t *durations;
+    int duration_count;
+    int frequency;
+    int dual_frequency;
+    int repeats;
+    mp_note previous;
+    int errors;
+} sc_decoder;
+
+/**
+ * Starts decoding a compressed song
+ * @param d - the decoder to start
+ * @param song - a song in the SB_FORMAT_COMPRESSED format
+ * @return one if the song has a valid dictionary, zero otherwise
+ */
+int sc_open(sc_decoder *d, const sb_song *song);
+
+/**
+ * Decodes the next note of a compressed song
+ * @param d - the decoder reading the song
+ * @param n - the note to fill
+ * @return one if a note was read, zero at the end of the song
+ */
+int sc_next(sc_decoder *d, mp_note *n);
+
+/**
+ * Compresses notes, as songc does for the song banks
+ * @param notes - the notes to compress
+ * @param count - the number of notes
+ * @param out - where to write the compressed song
+ * @param capacity - the room in out, in bytes
+ * @return the length of the compressed song, or zero if a note has no compressed form or it does
+ * not fit
+ */
+int sc_encode(const mp_note *notes, int count, uint8_t *out, int capacity);
+
+/**
+ * Measures the slowest note to decode from a compressed song on the target
+ * @param data - the compressed song
+ * @param length - the length of the song in bytes
+ * @return the most core cycles any one call to sc_next took
+ */
+int sc_cycles_worst(const uint8_t *data, uint32_t length);
+
+# endif
@@ -0,0 +1,347 @@
+/**
+ * @file song_dsl.hpp
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a compile-time song language that resolves notes into packed song bank notes
+ *
+ * Songs are written with note names and fractions of a whole note, and compile resolves them at a
+ * tempo into the packed SB_FORMAT_NOTES layout while the firmware builds, with note names kept as
+ * MIDI notes so they play in the build's temperament:
+ *     constexpr auto SONG = song_dsl::compile<120>(
+ *             note(keys("F#5", quarter + eighth), kick()),
+ *             note(rest(eighth)),
+ *             note(pluck(hz(588), dotted(quarter)))
+ *     );
+ *
+ * Each part is resolved the way mp_add_note would resolve it at runtime, so mp_feed_resolved can
+ * queue the notes as they are. Drums take their preset pitch and length, rests and empty dual parts
+ * become silent keys, and drums keep their instrument so the sample backend plays their recordings.
+ * Compiled at TICKS, lengths stay in ticks and the song plays at whatever tempo the player is set to,
+ * with drums given their preset length in ticks so they keep to the tempo too.
+ *
+ * A mistake, such as an unknown note name or a length that does not fit, calls one of the error
+ * functions below during constant evaluation, which fails the build with the error's name.
+ */
+
+# ifndef SONG_DSL_HPP
+# define SONG_DSL_HPP
+
+# include <array>
+# include <cstddef>
+# include <cstdint>
+
+extern "C" {
+# include "music_player_types.h"
+# include "song_bank.h"
+# include "tuning.h"
+# include "tempo_map.h"
+}
+
+namespace song_dsl {
+
+/**
+ * Build errors, which are never defined so that reaching one can only fail the build
+ */
+void error_unknown_note_name();
+void error_frequency_out_of_range();
+void error_note_out_of_range();
+void error_cents_out_of_range();
+void error_length_out_of_range();
+void error_length_not_whole_ticks();
+
+/**
+ * The tempo to compile a song at to keep its lengths in ticks, so it plays at the player's tempo
+ */
+constexpr int TICKS = 0;
+
+/**
+ * A length as a fraction of a whole note
+ */
+struct length {
+    int num;
+    int den;
+};
+
+constexpr length whole = {1, 1};
+constexpr length half = {1, 2};
+constexpr length quarter = {1, 4};
+constexpr length eighth = {1, 8};
+constexpr length sixteenth = {1, 16};
+constexpr length thirty_second = {1, 32};
+
+/**
+ * Adds two lengths, such as a tied quarter and eighth
+ */
+constexpr length operator+(length a, length b) {
+    return {a.num * b.den + b.num * a.den, a.den * b.den};
+}
+
+/**
+ * Lengthens a note by half again
+ * @param l - the length to dot
+ * @return the dotted length
+ */
+constexpr length dotted(length l) {
+    return {l.num * 3, l.den * 2};
+}
+
+/**
+ * Shortens a note to fit three in the time of two
+ * @param l - the length of the plain note
+ * @return the triplet length
+ */
+constexpr length triplet(length l) {
+    return {l.num * 2, l.den * 3};
+}
+
+/**
+ * A pitch, as a number of Hz or a MIDI note made with TN_PITCH, which the player tunes in the
+ * build's temperament
+ */
+struct pitch {
+    int frequency;
+};
+
+/**
+ * Gives a pitch as a number of Hz
+ * @param f - the frequency in Hz
+ * @return the pitch
+ */
+constexpr pitch hz(int f) {
+    if (f <= 0 || f >= TN_PITCH_FLAG) error_frequency_out_of_range();
+    return {f};
+}
+
+/**
+ * Gives a pitch as a MIDI note number
+ * @param number - the note number, from 0 to 127, where 69 is A4
+ * @param cents - the offset from the note in cents
+ * @return the pitch
+ */
+constexpr pitch midi(int number, int cents = 0) {
+    if (number < 0 || number >= TN_NOTES) error_note_out_of_range();
+    if (cents < -TN_MAX_CENTS || cents > TN_MAX_CENTS) error_cents_out_of_range();
+    return {TN_PITCH(number, cents)};
+}
+
+/**
+ * Resolves a note name, such as A4, F#5, or Bb3, to its MIDI note
+ * @param name - the note name
+ * @param cents - the offset from the note in cents
+ * @return the pitch
+ */
+constexpr pitch named(const char *name, int cents = 0) {
+
+    constexpr int SEMITONES[7] = {9, 11, 0, 2, 4, 5, 7};
+
+    char letter = name[0];
+    if (letter >= 'a' && letter <= 'g') letter -= 'a' - 'A';
+    if (letter < 'A' || letter > 'G') error_unknown_note_name();
+
+    int semitone = SEMITONES[letter - 'A'];
+    int i = 1;
+    if (name[i] == '#') semitone++, i++;
+    else if (name[i] == 'b') semitone--, i++;
+
+    if (name[i] < '0' || name[i] > '9' || name[i + 1] != '\0') error_unknown_note_name();
+
+    return midi(12 * (name[i] - '0' + 1) + semitone, cents);
+}
+
+/**
+ * One part of a note, with its length still a fraction of a whole note
+ * A zero length marks a part whose length comes from its instrument
+ */
+struct part {
+    mp_instrument instrument;
+    length len;
+    int frequency;
+};
+
+constexpr part keys(pitch p, length l) { return {MP_INSTR_KEYS, l, p.frequency}; }
+constexpr part keys(const char *name, length l) { return keys(named(name), l); }
+constexpr part fm(pitch p, length l) { return {MP_INSTR_FM, l, p.frequency}; }
+constexpr part fm(const char *name, length l) { return fm(named(name), l); }
+constexpr part pluck(pitch p, length l) { return {MP_INSTR_PLUCK, l, p.frequency}; }
+constexpr part pluck(const char *name, length l) { return pluck(named(name), l); }
+constexpr part saw(pitch p, length l) { return {MP_INSTR_SAW, l, p.frequency}; }
+constexpr part saw(const char *name, length l) { return saw(named(name), l); }
+constexpr part rest(length l) { return {MP_INSTR_REST, l, 0}; }
+constexpr part hat() { return {MP_INSTR_HAT, {0, 1}, MP_INSTR_HAT_FREQ}; }
+constexpr part kick() { return {MP_INSTR_KICK, {0, 1}, MP_INSTR_KICK_FREQ}; }
+constexpr part snare() { return {MP_INSTR_SNARE, {0, 1}, MP_INSTR_SNARE_FREQ}; }
+constexpr part silent() { return {MP_INSTR_NONE, {0, 1}, 0}; }
+
+/**
+ * A note of one or two parts
+ */
+struct note {
+
+    part main;
+    part dual;
+
+    /**
+     * Makes a note from its parts
+     * @param main - the part played on the first voice
+     * @param dual - the part played alongside it, if any
+     */
+    constexpr note(part main, part dual = silent()) : main(main), dual(dual) {}
+};
+
+/**
+ * A song resolved into packed notes
+ */
+template <std::size_t NOTES>
+struct packed {
+    std::array<uint8_t, NOTES * SB_NOTE_SIZE> data;
+};
+
+/**
+ * Resolves a part the way mp_conv_to_keys would, keeping drum instruments
+ * @param p - the part
+ * @param tempo - the tempo in quarter notes per minute, or TICKS
+ * @param duration - receives the length in ms, or in ticks made with TM_TICKS
+ * @param frequency - receives the frequency in Hz
+ * @return the instrument to store
+ */
+constexpr mp_instrument resolve(part p, int tempo, int &duration, int &frequency) {
+
+    frequency = p.frequency;
+
+    switch (p.instrument) {
+
+        case MP_INSTR_HAT:
+            duration = tempo == TICKS ? MP_INSTR_HAT_TICKS : MP_INSTR_HAT_DURATION;
+            return p.instrument;
+
+        case MP_INSTR_KICK:
+            duration = tempo == TICKS ? MP_INSTR_KICK_TICKS : MP_INSTR_KICK_DURATION;
+            return p.instrument;
+
+        case MP_INSTR_SNARE:
+            duration = tempo == TICKS ? MP_INSTR_SNARE_TICKS : MP_INSTR_SNARE_DURATION;
+            return p.instrument;
+
+        // an empty dual part is a silent 1 ms note
+        case MP_INSTR_NONE:
+            duration = 1;
+            return MP_INSTR_KEYS;
+
+        // every other instrument, rests among them, takes its length from the part below
+        default:
+            break;
+    }
+
+    if (p.len.num <= 0 || p.len.den <= 0) error_length_out_of_range();
+
+    // a whole note lasts four quarter notes of TM_PPQ ticks
+    if (tempo == TICKS) {
+        long long ticks = 4LL * TM_PPQ * p.len.num / p.len.den;
+        if (ticks * p.len.den != 4LL * TM_PPQ * p.len.num) error_length_not_whole_ticks();
+        if (ticks <= 0 || ticks > TM_MAX_TICKS) error_length_out_of_range();
+        duration = TM_TICKS((int) ticks);
+        return p.instrument == MP_INSTR_REST ? MP_INSTR_KEYS : p.instrument;
+    }
+
+    // a whole note lasts four beats
+    long long ms = (240000LL * p.len.num + (long long) p.len.den * tempo / 2) / ((long long) p.len.den * tempo);
+    // lengths in ms from the ticks flag up would be read as ticks
+    if (ms <= 0 || ms > TM_MAX_TICKS) error_length_out_of_range();
+    duration = (int) ms;
+
+    return p.instrument == MP_INSTR_REST ? MP_INSTR_KEYS : p.instrument;
+}
+
+/**
+ * Writes a little-endian halfword into a packed song
+ */
+template <std::size_t SIZE>
+constexpr void put_half(std::array<uint8_t, SIZE> &data, std::size_t at, int value) {
+    data[at] = (uint8_t) (value & 0xFF);
+    data[at + 1] = (uint8_t) ((value >> 8) & 0xFF);
+}
+
+/**
+ * Resolves a song into packed notes at a tempo, or with its lengths kept in ticks for TICKS
+ * @param notes - the notes of the song
+ * @return the packed song
+ */
+template <int TEMPO, typename... NOTES>
+constexpr packed<sizeof...(NOTES)> compile(NOTES... notes) {
+
+    static_assert(TEMPO >= TICKS && TEMPO <= TM_MAX_TEMPO, "tempo out of range");
+
+    packed<sizeof...(NOTES)> song = {};
+    const note list[] = {notes...};
+
+    for (std::size_t i = 0; i < sizeof...(NOTES); i++) {
+
+        std::size_t at = i * SB_NOTE_SIZE;
+        int duration = 0, frequency = 0, dual_duration = 0, dual_frequency = 0;
+
+        mp_instrument instrument = resolve(list[i].main, TEMPO, duration, frequency);
+        mp_instrument dual_instrument = resolve(list[i].dual, TEMPO, dual_duration, dual_frequency);
+
+        put_half(song.data, at, duration);
+        put_half(song.data, at + 2, frequency);
+        put_half(song.data, at + 4, dual_duration);
+        put_half(song.data, at + 6, dual_frequency);
+        song.data[at + 8] = (uint8_t) instrument;
+        song.data[at + 9] = (uint8_t) dual_instrument;
+    }
+
+    return song;
+}
+
+/**
+ * Computes the CRC-32 of a packed song, as sb_crc would
+ * @param song - the packed song
+ * @return the CRC
+ */
+template <std::size_t NOTES>
+constexpr uint32_t crc(const packed<NOTES> &song) {
+
+    uint32_t c = 0xFFFFFFFF;
+
+    for (uint8_t byte : song.data) {
+        c ^= byte;
+        for (int bit = 0; bit < 8; bit++) c = (c >> 1) ^ (0xEDB88320 & (0 - (c & 1)));
+    }
+
+    return ~c;
+}
+
+/**
+ * Counts the parts a packed song sounds at once, two if any note has a dual part that is not silent
+ * @param song - the packed song
+ * @return the number of voices
+ */
+template <std::size_t NOTES>
+constexpr int voices(const packed<NOTES> &song) {
+
+    for (std::size_t at = 0; at < song.data.size(); at += SB_NOTE_SIZE) {
+        int dual_frequency = song.data[at + 6] | (song.data[at + 7] << 8);
+        if (song.data[at + 9] != MP_INSTR_KEYS || dual_frequency) return 2;
+    }
+
+    return 1;
+}
+
+/**
+ * Describes a packed song for the song bank readers
+ * @param song - the packed song, which must have static storage
+ * @param name - the name of the song
+ * @param tempo - the tempo the song was compiled at, or the tempo to play it at if it was compiled
+ * at TICKS
+ * @return the song, ready for sb_open and mp_feed_resolved
+ */
+template <std::size_t NOTES>
+constexpr sb_song as_song(const packed<NOTES> &song, const char *name, int tempo = MP_TEMPO) {
+    return {song.data.data(), (uint32_t) song.data.size(), SB_FORMAT_NOTES, name, 0, tempo, voices(song), 0,
+            crc(song)};
+}
+
+}
+
+# endif
@@ -0,0 +1,112 @@
+/**
+ * @file tempo_map.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief note durations written in ticks and timed by a tempo map as they play
+ *
+ * The duration of a note part may be a number of ms, as it always has been, or a number of ticks
+ * made with TM_TICKS, TM_PPQ to a quarter note. Ticks set the flag bit above every duration in ms a
+ * song format can hold, so both fit the same halfword, and a song written in ticks plays at any
+ * tempo without being encoded again.
+ *
+ * The player converts ticks to ms as each note starts, at the tempo the map gives for where the
+ * song has got to, so a tempo change can land anywhere, even partway through a note. A note may
+ * also carry a tempo change of its own, which the player makes with tm_set_tempo as the note starts,
+ * so formats that change tempo as they go, such as sequences and ABC tunes, are timed by the same
+ * map. The tempo is kept as a Q32 multiplier of ms per tick and the fraction of a ms left by each
+ * note is carried into the next, so a song never drifts from its tempo however long it plays.
+ *
+ * The song moves on by the longer of each note's parts in ticks. Drums in a song written in ticks
+ * take their preset length in ticks too, so they move the song on like any other note, and only
+ * songs written in ms, which have no tempo changes to keep to, hold parts the map does not time.
+ */
+
+# ifndef TEMPO_MAP_H
+# define TEMPO_MAP_H
+
+# include <stdint.h>
+
+# define TM_PPQ 96 // ticks per quarter note
+# define TM_MAX_TEMPO 1000
+
+/**
+ * Durations in ticks
+ */
+# define TM_TICKS_FLAG 0x8000
+# define TM_TICKS(ticks) (TM_TICKS_FLAG | (ticks))
+# define TM_IS_TICKS(duration) (((duration) & TM_TICKS_FLAG) != 0)
+# define TM_TICK_COUNT(duration) ((duration) & 0x7FFF)
+# define TM_MAX_TICKS 0x7FFF
+
+/**
+ * Note Durations in Ticks
+ */
+# define TM_WHOLE TM_TICKS(4 * TM_PPQ)
+# define TM_HALF TM_TICKS(2 * TM_PPQ)
+# define TM_QUARTER TM_TICKS(TM_PPQ)
+# define TM_EIGHTH TM_TICKS(TM_PPQ / 2)
+# define TM_SIXTEENTH TM_TICKS(TM_PPQ / 4)
+
+/**
+ * Tempo Change
+ * tick - where the change happens, in ticks from the start of the song
+ * tempo - the new tempo in quarter notes per minute
+ */
+typedef struct {
+    uint32_t tick;
+    int tempo;
+} tm_change;
+
+/**
+ * Tempo Map
+ * changes - the tempo changes, in order of their ticks, and how many there are
+ * start_tempo - the tempo before the first change
+ * next - the next change to make
+ * tick - where the song has got to
+ * ms_per_tick - the length of a tick at the current tempo in Q32 ms
+ * fraction - the fraction of a ms carried into the next note in Q32
+ */
+typedef struct {
+    const tm_change *changes;
+    int count;
+    int start_tempo;
+    int next;
+    uint32_t tick;
+    uint64_t ms_per_tick;
+    uint32_t fraction;
+} tm_map;
+
+/**
+ * Sets up a tempo map and moves it to the start of the song
+ * @param m - the tempo map
+ * @param tempo - the tempo in quarter notes per minute until the first change
+ * @param changes - the tempo changes, in order of their ticks, which must stay in place, or null
+ * @param count - the number of changes
+ */
+void tm_init(tm_map *m, int tempo, const tm_change *changes, int count);
+
+/**
+ * Moves a tempo map back to the start of the song
+ * @param m - the tempo map
+ */
+void tm_rewind(tm_map *m);
+
+/**
+ * Changes the tempo from where the song has got to, such as for a tempo change a note carries
+ * Any later change in the map's own list still takes over once the song reaches it
+ * @param m - the tempo map
+ * @param tempo - the tempo in quarter notes per minute, which is clamped to a playable range
+ */
+void tm_set_tempo(tm_map *m, int tempo);
+
+/**
+ * Converts the durations of a note's parts from ticks to ms and moves the song on past the note
+ * Durations already in ms are left as they are
+ * @param m - the tempo map
+ * @param duration - the duration of the main part, replaced by its length in ms
+ * @param dual_duration - the duration of the dual part, replaced by its length in ms
+ */
+void tm_resolve(tm_map *m, int *duration, int *dual_duration);
+
+# endif
@@ -0,0 +1,83 @@
+/**
+ * @file tuning.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief pitches written as MIDI note numbers, tuned through a table chosen at build time
+ *
+ * The frequency of a note part may be a number of Hz, as it always has been, or a pitch made with
+ * TN_PITCH from a MIDI note number and an offset in cents. Pitches set the flag bit above every
+ * frequency the player can sound, so both fit the same halfword in every song format, and the
+ * player looks a pitch up in the tuning table only when it starts the note. Transposing a pitch is
+ * adding to its note number, and changing temperament is rebuilding with another table:
+ *     -DTN_TEMPERAMENT=TN_WERCKMEISTER
+ * The tables are generated by Tools/tuning_gen.c, which also writes custom temperaments.
+ */
+
+# ifndef TUNING_H
+# define TUNING_H
+
+# include <stdint.h>
+
+/**
+ * Temperaments
+ */
+# define TN_EQUAL 0
+# define TN_JUST 1
+# define TN_PYTHAGOREAN 2
+# define TN_MEANTONE 3
+# define TN_WERCKMEISTER 4
+# define TN_CUSTOM 5
+
+# ifndef TN_TEMPERAMENT
+# define TN_TEMPERAMENT TN_EQUAL
+# endif
+
+# define TN_NOTES 128
+# define TN_MAX_CENTS 63
+
+/**
+ * Pitches
+ * note - the MIDI note number, where 60 is C4 and 69 is A4
+ * cents - the offset from the note in cents, from -64 to 63
+ */
+# define TN_PITCH_FLAG 0x8000
+# define TN_PITCH(note, cents) (TN_PITCH_FLAG | ((note) << 7) | ((cents) + 64))
+# define TN_IS_PITCH(frequency) (((frequency) & TN_PITCH_FLAG) != 0)
+# define TN_NOTE(pitch) (((pitch) >> 7) & 0x7F)
+# define TN_CENTS(pitch) (((pitch) & 0x7F) - 64)
+
+/**
+ * The frequency of every MIDI note in Q16.16 Hz in the build's temperament
+ */
+extern const uint32_t TN_TABLE[TN_NOTES];
+
+/**
+ * The frequency ratio of each offset from -64 to 63 cents in Q15
+ */
+extern const uint16_t TN_CENTS_RATIO[128];
+
+/**
+ * Converts the frequency of a note part to Q16.16 Hz
+ * @param frequency - a number of Hz, or a pitch made with TN_PITCH
+ * @return the frequency in Q16.16 Hz
+ */
+uint32_t tn_q16(int frequency);
+
+/**
+ * Converts the frequency of a note part to a whole number of Hz
+ * @param frequency - a number of Hz, or a pitch made with TN_PITCH
+ * @return the frequency in Hz, rounded to the nearest
+ */
+int tn_hz(int frequency);
+
+/**
+ * Transposes the frequency of a note part
+ * Only pitches can be transposed, so frequencies in Hz are returned as they are
+ * @param frequency - a number of Hz, or a pitch made with TN_PITCH
+ * @param semitones - the number of semitones to transpose by, which may be negative
+ * @return the transposed pitch, clamped to the MIDI notes
+ */
+int tn_transpose(int frequency, int semitones);
+
+# endif
@@ -0,0 +1,103 @@
+/**
+ * @file voice_alloc.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief assigns note-on and note-off events to the voices of an output backend
+ */
+
+# ifndef VOICE_ALLOC_H
+# define VOICE_ALLOC_H
+
+# include <stdint.h>
+
+# define VA_MAX_VOICES 16
+
+/**
+ * Voice Stealing Policy
+ * Decides which held voice gives way when a note starts and every voice is busy
+ */
+typedef enum {
+    VA_STEAL_OLDEST,
+    VA_STEAL_QUIETEST
+} va_policy;
+
+/**
+ * Voice State
+ * A released voice has had its note-off but may still be sounding a tail, so it is
+ * reused before any held voice
+ */
+typedef enum {
+    VA_FREE,
+    VA_RELEASED,
+    VA_HELD
+} va_state;
+
+/**
+ * Allocated Voice
+ */
+typedef struct {
+    va_state state;
+    int key;
+    int level;
+    uint32_t age;
+} va_voice;
+
+/**
+ * Voice Allocator
+ */
+typedef struct {
+    int voices;
+    va_policy policy;
+    uint32_t clock;
+    va_voice voice[VA_MAX_VOICES];
+} voice_allocator;
+
+/**
+ * Initializes an allocator with every voice free
+ * @param va - the allocator to initialize
+ * @param voices - the number of voices the backend has, at most VA_MAX_VOICES
+ * @param policy - the policy used to steal a voice when none are free
+ */
+void va_init(voice_allocator *va, int voices, va_policy policy);
+
+/**
+ * Assigns a voice to a note, stealing one if every voice is busy
+ * @param va - the allocator to assign from
+ * @param key - the key identifying the note for va_note_off
+ * @param level - the loudness of the note, compared by VA_STEAL_QUIETEST
+ * @return the voice the note should play on, or -1 if the allocator has no voices
+ */
+int va_note_on(voice_allocator *va, int key, int level);
+
+/**
+ * Releases the held voice playing a note
+ * @param va - the allocator to release from
+ * @param key - the key the note was started with
+ * @return the voice that was released, or -1 if no held voice plays the note
+ */
+int va_note_off(voice_allocator *va, int key);
+
+/**
+ * Releases a voice whose note has ended
+ * @param va - the allocator to release from
+ * @param voice - the voice to release
+ */
+void va_release(voice_allocator *va, int voice);
+
+/**
+ * Frees a voice that has gone silent
+ * @param va - the allocator to free from
+ * @param voice - the voice to free
+ */
+void va_free(voice_allocator *va, int voice);
+
+/**
+ * Updates the loudness of a voice as its envelope moves
+ * @param va - the allocator the voice belongs to
+ * @param voice - the voice to update
+ * @param level - the new loudness of the voice
+ */
+void va_set_level(voice_allocator *va, int voice, int level);
+
+# endif
@@ -0,0 +1,63 @@
+/**
+ * @file wavetable.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief band-limited, mip-mapped wavetable oscillators stored in flash
+ */
+
+# ifndef WAVETABLE_H
+# define WAVETABLE_H
+
+# include <stdint.h>
+# include "dds.h"
+
+# define WT_SIZE_BITS 8
+# define WT_SIZE (1 << WT_SIZE_BITS)
+# define WT_LEVELS 8
+
+/**
+ * Band-limited tables, one per octave, generated by Tools/wavetable_gen.c into Src/wavetables.c
+ * Each table holds one cycle plus a guard sample that repeats the first
+ */
+extern const int16_t WT_SQUARE[WT_LEVELS][WT_SIZE + 1];
+extern const int16_t WT_SAW[WT_LEVELS][WT_SIZE + 1];
+
+/**
+ * Wavetable Waveforms
+ */
+typedef enum {
+    WT_WAVE_SQUARE,
+    WT_WAVE_SAW
+} wt_wave;
+
+/**
+ * Selects the table of a waveform whose harmonics stay below the Nyquist frequency
+ * @param wave - the waveform
+ * @param inc - the phase increment of the oscillator that will play the table
+ * @return the table for the octave the increment falls in
+ */
+const int16_t * wt_select(wt_wave wave, uint32_t inc);
+
+/**
+ * Renders an oscillator through a table with linear interpolation, adding it onto a mix
+ * @param osc - the oscillator to render
+ * @param table - the table to render, as returned by wt_select
+ * @param mix - the mix to add the samples to
+ * @param n - the number of samples to render
+ * @param amplitude - the amplitude in Q15
+ */
+void wt_render(dds_osc *osc, const int16_t *table, int32_t *mix, int n, int32_t amplitude);
+
+/**
+ * Renders an oscillator through a table without interpolation, adding it onto a mix
+ * Cheaper than wt_render at the cost of more aliasing and noise
+ * @param osc - the oscillator to render
+ * @param table - the table to render, as returned by wt_select
+ * @param mix - the mix to add the samples to
+ * @param n - the number of samples to render
+ * @param amplitude - the amplitude in Q15
+ */
+void wt_render_nearest(dds_osc *osc, const int16_t *table, int32_t *mix, int n, int32_t amplitude);
+
+# endif
@@ -0,0 +1,746 @@
+/**
+ * @file abc.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a resumable parser that reads tunes in ABC notation one note at a time
+ */
+
+# include "abc.h"
+# include "tuning.h"
+
+# define ABC_MAX_DIVISOR 256 // the shortest length multiplier, so lengths cannot overflow
+# define ABC_MAX_BROKEN 3 // the most > or < signs in a broken rhythm
+
+/**
+ * The semitone above C of each letter from C to B
+ */
+static const int ABC_SEMITONES[7] = {0, 2, 4, 5, 7, 9, 11};
+
+/**
+ * The position on the circle of fifths of each letter from C to B
+ */
+static const int ABC_FIFTHS[7] = {0, 2, 4, -1, 1, 3, 5};
+
+/**
+ * The letters from C to B that a key sharpens, in the order it sharpens them, which flats take in
+ * reverse
+ */
+static const int ABC_SHARPS[7] = {3, 0, 4, 1, 5, 2, 6};
+
+/**
+ * Modes, by the first three letters of their names, and how far round the circle of fifths each
+ * moves its key from major
+ */
+static const struct {
+    char name[4];
+    int fifths;
+} ABC_MODES[] = {
+        {"maj", 0}, {"ion", 0}, {"mix", -1}, {"dor", -2}, {"min", -3},
+        {"aeo", -3}, {"phr", -4}, {"loc", -5}, {"lyd", 1}
+};
+
+# define ABC_MODE_COUNT (int) (sizeof(ABC_MODES) / sizeof(ABC_MODES[0]))
+
+/**
+ * Converts a letter from C to B, in either case, to its place from C
+ * @param c - the letter
+ * @return the place of the letter from C, or -1 if it is not a note letter
+ */
+static int abc_letter(char c) {
+    c |= 0x20;
+    if (c < 'a' || c > 'g') return -1;
+    return c >= 'c' ? c - 'c' : c - 'a' + 5;
+}
+
+/**
+ * Skips spaces
+ * @param s - the text to skip from
+ * @return the first other character
+ */
+static const char * abc_skip(const char *s) {
+    while (*s == ' ' || *s == '\t') s++;
+    return s;
+}
+
+/**
+ * Finds the end of a line
+ * @param s - the text to search from
+ * @return the line break or the end of the text
+ */
+static const char * abc_line_end(const char *s) {
+    while (*s && *s != '\n') s++;
+    return s;
+}
+
+/**
+ * Checks whether a line has nothing on it
+ * @param s - the start of the line
+ * @return one if the line is blank, zero otherwise
+ */
+static int abc_blank(const char *s) {
+    while (*s == ' ' || *s == '\t' || *s == '\r') s++;
+    return *s == '\n' || !*s;
+}
+
+/**
+ * Checks whether text is a field, a letter then a colon
+ * @param s - the text
+ * @return one if the text starts with a field, zero otherwise
+ */
+static int abc_is_field(const char *s) {
+    return ((*s >= 'A' && *s <= 'Z') || (*s >= 'a' && *s <= 'z')) && s[1] == ':';
+}
+
+/**
+ * Reads an unsigned decimal number
+ * @param s - the text to read, advanced past the number
+ * @return the number, or -1 if there is no number
+ */
+static int abc_number(const char **s) {
+
+    const char *c = *s;
+    int value = 0;
+
+    if (*c < '0' || *c > '9') return -1;
+
+    // stop accumulating once the value is out of range so long runs of digits cannot overflow
+    while (*c >= '0' && *c <= '9') {
+        if (value < 10000) value = value * 10 + (*c - '0');
+        c++;
+    }
+
+    *s = c;
+    return value;
+}
+
+/**
+ * Reads a fraction such as 1/8
+ * @param s - the text to read, advanced past the fraction
+ * @param num - receives the numerator
+ * @param den - receives the denominator
+ * @return one if the fraction is valid, zero otherwise
+ */
+static int abc_fraction(const char **s, int *num, int *den) {
+
+    *num = abc_number(s);
+    if (**s != '/') return 0;
+    (*s)++;
+    *den = abc_number(s);
+
+    return *num > 0 && *den > 0;
+}
+
+/**
+ * Reads a length multiplier, such as 2, 3/2, /, or //
+ * @param s - the text to read, advanced past the multiplier
+ * @param num - receives the numerator
+ * @param den - receives the denominator
+ * @return one if the multiplier is valid, zero otherwise
+ */
+static int abc_length(const char **s, int *num, int *den) {
+
+    int n = abc_number(s);
+    *num = n < 0 ? 1 : n;
+    *den = 1;
+
+    // each slash halves the length, unless a divisor follows it
+    while (**s == '/') {
+        (*s)++;
+        int d = abc_number(s);
+        *den *= d < 0 ? 2 : d;
+        if (*den <= 0 || *den > ABC_MAX_DIVISOR) return 0;
+    }
+
+    return *num > 0;
+}
+
+/**
+ * Forgets the accidentals of the bar that just ended
+ * @param p - the parser
+ */
+static void abc_new_bar(abc_parser *p) {
+    for (int i = 0; i < ABC_OCTAVES * 7; i++) p->bar[i] = ABC_NO_ACCIDENTAL;
+}
+
+/**
+ * Sets the key signature from a key field, such as G, Bb, F#m, Ador, or none
+ * @param p - the parser
+ * @param s - the value of the field
+ */
+static void abc_key(abc_parser *p, const char *s) {
+
+    for (int i = 0; i < 7; i++) p->key[i] = 0;
+    abc_new_bar(p);
+
+    s = abc_skip(s);
+    int letter = abc_letter(*s);
+
+    // a key of none, or highland pipes, has no signature
+    if (*s < 'A' || *s > 'G' || letter < 0) return;
+    s++;
+
+    int fifths = ABC_FIFTHS[letter];
+    if (*s == '#') fifths += 7, s++;
+    else if (*s == 'b') fifths -= 7, s++;
+
+    // the mode, named by its first three letters, or m for minor
+    s = abc_skip(s);
+    char mode[4] = {0};
+    for (int i = 0; i < 3 && ((*s >= 'a' && *s <= 'z') || (*s >= 'A' && *s <= 'Z')); i++) mode[i] = *s++ | 0x20;
+
+    if (mode[0] == 'm' && !mode[1]) {
+        fifths -= 3;
+    } else {
+        for (int i = 0; i < ABC_MODE_COUNT; i++) {
+            if (mode[0] == ABC_MODES[i].name[0] && mode[1] == ABC_MODES[i].name[1] &&
+                mode[2] == ABC_MODES[i].name[2]) {
+                fifths += ABC_MODES[i].fifths;
+            }
+        }
+    }
+
+    if (fifths > 7) fifths = 7;
+    if (fifths < -7) fifths = -7;
+
+    for (int i = 0; i < fifths; i++) p->key[ABC_SHARPS[i]] = 1;
+    for (int i = 0; i < -fifths; i++) p->key[ABC_SHARPS[6 - i]] = -1;
+}
+
+/**
+ * Sets the tempo from a tempo field, such as 1/4=120, "Allegro" 3/8=80, or 120 unit notes a minute
+ * @param p - the parser
+ * @param s - the value of the field
+ * @param end - the end of the value
+ */
+static void abc_tempo(abc_parser *p, const char *s, const char *end) {
+
+    int num = p->unit_num, den = p->unit_den;
+
+    while (s < end) {
+
+        s = abc_skip(s);
+
+        // skip the words that name the tempo
+        if (*s == '"') {
+            s++;
+            while (s < end && *s != '"') s++;
+            s++;
+            continue;
+        }
+
+        const char *start = s;
+        int n, d;
+        if (abc_fraction(&s, &n, &d)) {
+            num = n;
+            den = d;
+            continue;
+        }
+
+        s = start;
+        if (*s == '=') s++;
+        int bpm = abc_number(&s);
+        if (bpm > 0) {
+            p->beat_num = num;
+            p->beat_den = den;
+            p->bpm = bpm;
+            p->retimed = 1;
+            return;
+        }
+
+        if (s == start) s++;
+    }
+}
+
+/**
+ * Notes which voice a voice field starts, and mutes every voice but the first
+ * @param p - the parser
+ * @param s - the value of the field
+ * @param end - the end of the value
+ */
+static void abc_voice(abc_parser *p, const char *s, const char *end) {
+
+    s = abc_skip(s);
+    const char *id = s;
+    while (s < end && *s != ' ' && *s != '\t' && *s != '\r' && *s != ']') s++;
+    int length = (int) (s - id);
+
+    if (!p->voice) {
+        p->voice = id;
+        p->voice_length = length;
+    }
+
+    p->muted = length != p->voice_length;
+    for (int i = 0; !p->muted && i < length; i++) p->muted = id[i] != p->voice[i];
+}
+
+/**
+ * Applies a field, from the header, a line of the tune, or inline between brackets
+ * @param p - the parser
+ * @param key - the field's letter
+ * @param s - the value of the field
+ * @param end - the end of the value
+ */
+static void abc_field(abc_parser *p, char key, const char *s, const char *end) {
+
+    int num, den;
+
+    switch (key) {
+
+        case 'K':
+            abc_key(p, s);
+            break;
+
+        case 'L':
+            s = abc_skip(s);
+            if (abc_fraction(&s, &num, &den)) {
+                p->unit_num = num;
+                p->unit_den = den;
+            }
+            break;
+
+        case 'M':
+            s = abc_skip(s);
+            if (*s == 'C') {
+                p->meter_num = s[1] == '|' ? 2 : 4;
+                p->meter_den = s[1] == '|' ? 2 : 4;
+            } else if (abc_fraction(&s, &num, &den)) {
+                p->meter_num = num;
+                p->meter_den = den;
+            }
+            break;
+
+        case 'Q':
+            abc_tempo(p, s, end);
+            break;
+
+        case 'T':
+            // later titles name the parts of the tune
+            if (!p->title) {
+                p->title = abc_skip(s);
+                p->title_length = (int) (end - p->title);
+                while (p->title_length && p->title[p->title_length - 1] == '\r') p->title_length--;
+            }
+            break;
+
+        case 'V':
+            abc_voice(p, s, end);
+            break;
+
+        // do nothing if we receive an invalid value
+        default:
+            break;
+    }
+}
+
+/**
+ * Opens the first ABC tune in some text, reading its header
+ * The text must stay in place until the last note has been read
+ * @param p - the parser to open the tune with
+ * @param text - the null terminated text, such as a collection of tunes or where the last one ended
+ * @return one if a tune with a key was found, zero otherwise
+ */
+int abc_open(abc_parser *p, const char *text) {
+
+    const char *s = text;
+    int unit = 0;
+
+    // an invalid tune has no notes to read
+    p->next = "";
+    p->ended = 1;
+    p->errors = 0;
+
+    while (*s) {
+
+        const char *end = abc_line_end(s);
+
+        // a reference number starts a tune, so forget anything a previous header set
+        if (s == text || (*s == 'X' && s[1] == ':')) {
+            p->unit_num = 1;
+            p->unit_den = 8;
+            p->meter_num = 4;
+            p->meter_den = 4;
+            p->beat_num = 1;
+            p->beat_den = 4;
+            p->bpm = ABC_DEFAULT_TEMPO;
+            p->title = 0;
+            p->voice = 0;
+            p->voice_length = 0;
+            unit = 0;
+        }
+
+        // fields fill the header, which the key ends, and anything else before it is passed over
+        if (abc_is_field(s)) {
+            unit |= *s == 'L';
+            abc_field(p, *s, s + 2, end);
+
+            if (*s == 'K') {
+
+                // without a unit length, short meters count in sixteenths and the rest in eighths
+                if (!unit) p->unit_den = 4 * p->meter_num < 3 * p->meter_den ? 16 : 8;
+
+                p->next = *end ? end + 1 : end;
+                p->repeat = p->next;
+                p->retimed = 1;
+                p->second = 0;
+                p->muted = 0;
+                p->ended = 0;
+                p->tuplet_left = 0;
+                p->broken_num = 1;
+                p->broken_den = 1;
+
+                return 1;
+            }
+        }
+
+        s = *end ? end + 1 : end;
+    }
+
+    p->next = s;
+    return 0;
+}
+
+/**
+ * Reads a note or rest, with its length
+ * @param p - the parser
+ * @param s - the text to read, advanced past the note
+ * @param midi - receives the MIDI note number, or -1 for a rest
+ * @param num - receives the numerator of the length in unit notes
+ * @param den - receives the denominator of the length in unit notes
+ * @return one if the note is valid, zero otherwise
+ */
+static int abc_note(abc_parser *p, const char **s, int *midi, int *num, int *den) {
+
+    const char *c = *s;
+    int accidental = 0, marked = 0;
+
+    // sharps, flats, and naturals, which last to the end of the bar
+    for (; *c == '^' || *c == '_' || *c == '='; c++) {
+        accidental += *c == '^' ? 1 : *c == '_' ? -1 : 0;
+        marked = 1;
+    }
+
+    // a multiple bar rest lasts whole bars of the meter
+    if (*c == 'Z' || *c == 'X') {
+        c++;
+        int bars = abc_number(&c);
+        if (bars < 0) bars = 1;
+        *midi = -1;
+        *num = bars * p->meter_num * p->unit_den;
+        *den = p->meter_den * p->unit_num;
+        *s = c;
+        return !marked && bars > 0;
+    }
+
+    int letter = abc_letter(*c);
+    int octave = *c >= 'a' ? 5 : 4;
+    int valid = !marked || letter >= 0;
+
+    if (*c == 'z' || *c == 'x') {
+        *midi = -1;
+        valid = !marked;
+        c++;
+    } else if (letter >= 0) {
+        c++;
+        for (; *c == '\'' || *c == ','; c++) octave += *c == '\'' ? 1 : -1;
+
+        if (octave < 0 || octave >= ABC_OCTAVES || accidental < -2 || accidental > 2) {
+            valid = 0;
+        } else {
+            int8_t *bar = &p->bar[octave * 7 + letter];
+            if (marked) *bar = (int8_t) accidental;
+            accidental = *bar != ABC_NO_ACCIDENTAL ? *bar : p->key[letter];
+            *midi = 12 * (octave + 1) + ABC_SEMITONES[letter] + accidental;
+        }
+    }
+
+    valid = abc_length(&c, num, den) && valid;
+    *s = c;
+
+    return valid;
+}
+
+/**
+ * Fills a note from its pitch and length
+ * @param p - the parser
+ * @param n - the note to fill
+ * @param midi - the MIDI note number, or -1 for a rest
+ * @param dual - the MIDI note number of the dual part, or -1 for none
+ * @param num - the numerator of the length in unit notes
+ * @param den - the denominator of the length in unit notes
+ * @return one if the note can be played, zero otherwise
+ */
+static int abc_fill(abc_parser *p, mp_note *n, int midi, int dual, int num, int den) {
+
+    // a whole note is four quarter notes of ticks
+    int64_t top = 4LL * TM_PPQ * p->unit_num * num;
+    int64_t bottom = (int64_t) p->unit_den * den;
+    int64_t ticks = (top + bottom / 2) / bottom;
+
+    if (ticks <= 0 || ticks > TM_MAX_TICKS) return 0;
+
+    *n = (mp_note) {0};
+    n->instrument = midi < 0 ? MP_INSTR_REST : MP_INSTR_KEYS;
+    n->duration = TM_TICKS((int) ticks);
+    n->dual_instrument = dual < 0 ? MP_INSTR_NONE : MP_INSTR_KEYS;
+    n->dual_duration = dual < 0 ? 0 : TM_TICKS((int) ticks);
+
+    if (midi > TN_NOTES - 1 || dual > TN_NOTES - 1) return 0;
+    if (midi >= 0) n->frequency = TN_PITCH(midi, 0);
+    if (dual >= 0) n->dual_frequency = TN_PITCH(dual, 0);
+
+    // a beat of beat_num / beat_den whole notes is 4 * beat_num / beat_den quarter notes
+    if (p->retimed) {
+        int64_t quarters = (4LL * p->bpm * p->beat_num + p->beat_den / 2) / p->beat_den;
+        n->tempo = quarters < 1 ? 1 : quarters > TM_MAX_TEMPO ? TM_MAX_TEMPO : (int) quarters;
+    }
+    p->retimed = 0;
+
+    return 1;
+}
+
+/**
+ * Reads a bar line, which may end or start a repeat or start an ending, and moves to where the
+ * tune carries on from
+ * @param p - the parser
+ * @param s - the text at the bar line, advanced to where the tune carries on
+ */
+static void abc_bar(abc_parser *p, const char **s) {
+
+    const char *start = *s;
+    const char *c = start;
+    int thick = *c == '[';
+
+    if (thick) c++;
+    while (*c == '|' || *c == ':' || *c == ']') {
+        thick |= (*c == '|' && c[1] == '|') || *c == ']';
+        c++;
+    }
+
+    int ends = *start == ':';
+    int starts = c - start > 1 && c[-1] == ':';
+
+    abc_new_bar(p);
+
+    // the first time through, an end of repeat goes back to play the section again
+    if (ends && !p->second) {
+        p->second = 1;
+        *s = p->repeat;
+        return;
+    }
+
+    if (ends || starts) p->second = 0;
+    if (starts || thick) p->repeat = c;
+
+    // the first ending is skipped the second time through, on to the second ending
+    if (*c == '1' && p->second) {
+        while (*c && !((*c == '|' || *c == '[') && c[1] == '2') && !(*c == '\n' && abc_blank(c + 1))) c++;
+        if (*c && *c != '\n') c += 2;
+        p->second = 0;
+    } else if (*c >= '1' && *c <= '9') {
+        c++;
+    }
+
+    *s = c;
+}
+
+/**
+ * Handles the start of a line, which may be a field, a voice that is not played, or the blank line
+ * that ends the tune
+ * @param p - the parser
+ * @param s - the start of the line, advanced past anything handled
+ * @return one if something was handled, zero if the line holds notes to read
+ */
+static int abc_line(abc_parser *p, const char **s) {
+
+    const char *c = *s;
+    const char *end = abc_line_end(c);
+
+    if (abc_blank(c) || (*c == 'X' && c[1] == ':')) {
+        p->ended = 1;
+        p->next = c;
+        return 1;
+    }
+
+    if (abc_is_field(c)) {
+        abc_field(p, *c, c + 2, end);
+    } else if (*c != '%' && !p->muted) {
+        return 0;
+    }
+
+    // fields, comments, and the lines of other voices are passed over whole
+    *s = *end ? end + 1 : end;
+    return 1;
+}
+
+/**
+ * Reads the next note of a tune, skipping any malformed notes
+ * @param p - the parser reading the tune
+ * @param n - the note to fill
+ * @return one if a note was read, zero at the end of the tune
+ */
+int abc_next(abc_parser *p, mp_note *n) {
+
+    const char *s = p->next;
+
+    while (!p->ended) {
+
+        if (s[-1] == '\n' && abc_line(p, &s)) continue;
+
+        char c = *s;
+
+        if (!c) {
+            p->ended = 1;
+            p->next = s;
+            break;
+        }
+
+        // chord symbols, decorations, and grace notes
+        if (c == '"' || c == '!' || c == '+' || c == '{') {
+            char close = c == '{' ? '}' : c;
+            const char *t = s + 1;
+            while (*t && *t != '\n' && *t != close) t++;
+            s = *t == close ? t + 1 : s + 1;
+            continue;
+        }
+
+        if (c == '%') {
+            s = abc_line_end(s);
+            continue;
+        }
+
+        // inline fields, endings, and bar lines that start with a bracket
+        if (c == '[' && abc_is_field(s + 1)) {
+            const char *end = s + 3;
+            while (*end && *end != '\n' && *end != ']') end++;
+            abc_field(p, s[1], s + 3, end);
+            s = *end == ']' ? end + 1 : end;
+            continue;
+        }
+
+        if (c == '[' && s[1] >= '1' && s[1] <= '9') {
+            s++;
+            abc_bar(p, &s);
+            continue;
+        }
+
+        if (c == '|' || c == ':' || (c == '[' && s[1] == '|')) {
+            abc_bar(p, &s);
+            continue;
+        }
+
+        // tuplets, such as (3 for three notes in the time of two
+        if (c == '(' && s[1] >= '2' && s[1] <= '9') {
+            s++;
+            p->tuplet_p = abc_number(&s);
+            int compound = p->meter_num % 3 == 0 && p->meter_num > 3;
+            p->tuplet_q = p->tuplet_p == 3 || p->tuplet_p == 6 ? 2 :
+                          p->tuplet_p == 2 || p->tuplet_p == 4 || p->tuplet_p == 8 ? 3 : compound ? 3 : 2;
+            p->tuplet_left = p->tuplet_p;
+            if (*s == ':') {
+                s++;
+                int q = abc_number(&s);
+                if (q > 0) p->tuplet_q = q;
+                if (*s == ':') {
+                    s++;
+                    int r = abc_number(&s);
+                    if (r > 0) p->tuplet_left = r;
+                }
+            }
+            continue;
+        }
+
+        int chord = c == '[';
+        int note = c == '^' || c == '_' || c == '=' || c == 'z' || c == 'x' || c == 'Z' || c == 'X' ||
+                   abc_letter(c) >= 0;
+
+        if (!chord && !note) {
+            s++;
+            continue;
+        }
+
+        int midi = -1, dual = -1, num = 1, den = 1;
+        int valid = 1;
+
+        if (chord) {
+
+            // the first note of a chord plays on the main part and the second on the dual part
+            s++;
+            int count = 0;
+            while (*s && *s != ']' && *s != '\n') {
+                int m, a, b;
+                if (!abc_note(p, &s, &m, &a, &b)) {
+                    valid = 0;
+                    break;
+                }
+                if (count == 0) midi = m, num = a, den = b;
+                if (count == 1) dual = m;
+                count++;
+            }
+            while (*s && *s != ']' && *s != '\n') s++;
+            if (*s == ']') s++;
+
+            int a, b;
+            valid = abc_length(&s, &a, &b) && valid && count;
+            num *= a;
+            den *= b;
+
+        } else {
+
+            valid = abc_note(p, &s, &midi, &num, &den);
+
+            // ties join the notes of the same pitch that follow, even across a bar line
+            while (valid && midi >= 0 && *s == '-') {
+                const char *t = abc_skip(s + 1);
+                if (*t == '|' && t[1] != '|' && t[1] != ':' && t[1] != ']' && !(t[1] >= '1' && t[1] <= '9')) {
+                    t = abc_skip(t + 1);
+                    abc_new_bar(p);
+                }
+                int m, a, b;
+                if (!(*t == '^' || *t == '_' || *t == '=' || abc_letter(*t) >= 0) || !abc_note(p, &t, &m, &a, &b) ||
+                    m != midi) {
+                    s++;
+                    break;
+                }
+                num = num * b + a * den;
+                den *= b;
+                s = t;
+            }
+        }
+
+        if (*s == '-') s++;
+
+        // a broken rhythm lengthens one note of a pair by what it takes from the other
+        num *= p->broken_num;
+        den *= p->broken_den;
+        p->broken_num = 1;
+        p->broken_den = 1;
+
+        if (*s == '>' || *s == '<') {
+            char sign = *s;
+            int k = 0;
+            while (*s == sign && k < ABC_MAX_BROKEN) s++, k++;
+            int longer = (2 << k) - 1, shorter = 1, whole = 1 << k;
+            num *= sign == '>' ? longer : shorter;
+            den *= whole;
+            p->broken_num = sign == '>' ? shorter : longer;
+            p->broken_den = whole;
+        }
+
+        if (p->tuplet_left > 0) {
+            num *= p->tuplet_q;
+            den *= p->tuplet_p;
+            p->tuplet_left--;
+        }
+
+        if (valid && abc_fill(p, n, midi, dual, num, den)) {
+            p->next = s;
+            return 1;
+        }
+
+        p->errors++;
+    }
+
+    p->next = s;
+    return 0;
+}
@@ -0,0 +1,152 @@
+/**
+ * @file adpcm.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief one-shot playback of IMA-ADPCM clips stored in flash
+ */
+
+# include "adpcm.h"
+
+# define ADPCM_MAX_INDEX 88
+
+/**
+ * IMA-ADPCM quantizer step sizes
+ */
+static const int16_t ADPCM_STEPS[ADPCM_MAX_INDEX + 1] = {
+        7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+        34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143,
+        157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+        724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024,
+        3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+        15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+/**
+ * IMA-ADPCM step index adjustments for each code
+ */
+static const int8_t ADPCM_INDEX_STEPS[16] = {
+        -1, -1, -1, -1, 2, 4, 6, 8,
+        -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+/**
+ * Decodes one code, updating the predictor and step index
+ * @param predictor - the predicted sample, updated to the decoded sample
+ * @param index - the step index, updated for the next code
+ * @param code - the 4-bit code to decode
+ */
+static inline void adpcm_step(int32_t *predictor, int32_t *index, int code) {
+
+    // reconstruct the difference from the code bits
+    int32_t step = ADPCM_STEPS[*index];
+    int32_t diff = step >> 3;
+    if (code & 4) diff += step;
+    if (code & 2) diff += step >> 1;
+    if (code & 1) diff += step >> 2;
+
+    int32_t p = *predictor + ((code & 8) ? -diff : diff);
+    if (p > 32767) p = 32767;
+    if (p < -32768) p = -32768;
+    *predictor = p;
+
+    int32_t i = *index + ADPCM_INDEX_STEPS[code];
+    if (i < 0) i = 0;
+    if (i > ADPCM_MAX_INDEX) i = ADPCM_MAX_INDEX;
+    *index = i;
+}
+
+/**
+ * Starts playing a clip from its beginning
+ * @param p - the player to start
+ * @param clip - the clip to play
+ */
+void adpcm_start(adpcm_player *p, const adpcm_clip *clip) {
+    p->clip = clip;
+    p->position = 0;
+    p->predictor = 0;
+    p->index = 0;
+}
+
+/**
+ * Decodes the next samples of a clip, adding them onto a mix
+ * @param p - the player to render
+ * @param mix - the mix to add the samples to
+ * @param n - the number of samples to render
+ * @param amplitude - the amplitude in Q15
+ * @return one if the clip has samples left, zero once it has finished
+ */
+int adpcm_render(adpcm_player *p, int32_t *mix, int n, int32_t amplitude) {
+
+    if (!p->clip) return 0;
+
+    uint32_t position = p->position;
+    uint32_t samples = p->clip->samples;
+    int32_t predictor = p->predictor;
+    int32_t index = p->index;
+
+    while (n > 0 && position < samples) {
+
+        // locate the current block and the position within it
+        uint32_t block = position / ADPCM_BLOCK_SAMPLES;
+        uint32_t offset = position - block * ADPCM_BLOCK_SAMPLES;
+        const uint8_t *data = p->clip->data + block * ADPCM_BLOCK_BYTES;
+
+        // the first sample of each block comes straight from its header, resynchronizing the decoder
+        if (offset == 0) {
+            predictor = (int16_t) (data[0] | (data[1] << 8));
+            index = data[2] > ADPCM_MAX_INDEX ? ADPCM_MAX_INDEX : data[2];
+            *mix++ += (predictor * amplitude) >> 15;
+            position++;
+            n--;
+            continue;
+        }
+
+        // decode the rest of the block, or as much of it as the mix wants
+        uint32_t run = ADPCM_BLOCK_SAMPLES - offset;
+        if (run > samples - position) run = samples - position;
+        if (run > (uint32_t) n) run = n;
+
+        const uint8_t *codes = data + ADPCM_HEADER_BYTES;
+        uint32_t code_index = offset - 1;
+
+        for (uint32_t i = 0; i < run; i++, code_index++) {
+
+            uint8_t byte = codes[code_index >> 1];
+            int code = (code_index & 1) ? (byte >> 4) : (byte & 0x0F);
+
+            adpcm_step(&predictor, &index, code);
+
+            *mix++ += (predictor * amplitude) >> 15;
+        }
+
+        position += run;
+        n -= run;
+    }
+
+    p->position = position;
+    p->predictor = predictor;
+    p->index = index;
+
+    return position < samples;
+}
+
+/**
+ * Resets a stream decoder to silence with the smallest step
+ * @param d - the decoder to reset
+ */
+void adpcm_reset(adpcm_decoder *d) {
+    d->predictor = 0;
+    d->index = 0;
+}
+
+/**
+ * Decodes one code of a stream
+ * @param d - the decoder to advance
+ * @param code - the 4-bit code to decode
+ * @return the decoded sample
+ */
+int16_t adpcm_decode(adpcm_decoder *d, int code) {
+    adpcm_step(&d->predictor, &d->index, code & 0x0F);
+    return (int16_t) d->predictor;
+}
@@ -0,0 +1,114 @@
+/**
+ * @file biquad.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a cascaded direct form I biquad filter for tone shaping the sample output
+ */
+
+# include <stm32f446xx.h>
+# include "biquad.h"
+# include "cycle_counter.h"
+# include "audio_driver.h"
+
+/**
+ * Initializes a cascade with cleared state
+ * @param f - the cascade to initialize
+ * @param coefs - the coefficients of each section
+ * @param sections - the number of sections, at most BIQUAD_MAX_SECTIONS, or zero to bypass
+ */
+void biquad_init(biquad_cascade *f, const biquad_coefs *coefs, int sections) {
+
+    // bypass the cascade while it changes
+    f->sections = 0;
+
+    if (!coefs || sections < 0) sections = 0;
+    if (sections > BIQUAD_MAX_SECTIONS) sections = BIQUAD_MAX_SECTIONS;
+
+    for (int i = 0; i < BIQUAD_MAX_SECTIONS; i++) {
+        f->x12[i] = 0;
+        f->y12[i] = 0;
+    }
+
+    f->coefs = coefs;
+    f->sections = sections;
+}
+
+/**
+ * Filters a block of samples in place through every section of a cascade
+ * @param f - the cascade to filter through
+ * @param block - the samples to filter
+ * @param n - the number of samples
+ */
+void biquad_process(biquad_cascade *f, int16_t *block, int n) {
+    biquad_process_limited(f, block, n, f->sections);
+}
+
+/**
+ * Filters a block of samples in place through only the leading sections of a cascade
+ * The skipped sections have their history cleared so they restart cleanly once they are used again
+ * @param f - the cascade to filter through
+ * @param block - the samples to filter
+ * @param n - the number of samples
+ * @param sections - the number of leading sections to run
+ */
+void biquad_process_limited(biquad_cascade *f, int16_t *block, int n, int sections) {
+
+    if (sections > f->sections) sections = f->sections;
+
+    for (int s = sections; s < f->sections; s++) {
+        f->x12[s] = 0;
+        f->y12[s] = 0;
+    }
+
+    // run the whole block through one section at a time so its state stays in registers
+    for (int s = 0; s < sections; s++) {
+
+        int32_t b0 = f->coefs[s].b0;
+        uint32_t b12 = f->coefs[s].b12;
+        uint32_t a12 = f->coefs[s].a12;
+        uint32_t x12 = f->x12[s];
+        uint32_t y12 = f->y12[s];
+
+        for (int i = 0; i < n; i++) {
+            int32_t x = block[i];
+
+            // b0 x, then both feedforward and both feedback taps as dual 16-bit multiply-accumulates
+            uint64_t acc = (uint64_t) (int64_t) (b0 * x);
+            acc = __SMLALD(b12, x12, acc);
+            acc = __SMLALD(a12, y12, acc);
+
+            int32_t y = __SSAT((int32_t) ((int64_t) acc >> BIQUAD_COEF_SHIFT), 16);
+
+            // shift the newest input and output into the low halves of the history
+            x12 = __PKHBT(x, x12, 16);
+            y12 = __PKHBT(y, y12, 16);
+
+            block[i] = (int16_t) y;
+        }
+
+        f->x12[s] = x12;
+        f->y12[s] = y12;
+    }
+
+}
+
+/**
+ * Benchmarks biquad_process using the cycle counter
+ * @return the number of core cycles one section takes per sample
+ */
+int biquad_cycles_per_sample(void) {
+
+    static int16_t block[AUDIO_BLOCK_SIZE];
+    biquad_cascade f;
+
+    biquad_init(&f, BIQUAD_LOWPASS, 1);
+
+    // time one block through a single section
+    cyc_init();
+    uint32_t start = cyc_now();
+    biquad_process(&f, block, AUDIO_BLOCK_SIZE);
+    uint32_t cycles = cyc_now() - start;
+
+    return (int) ((cycles + AUDIO_BLOCK_SIZE / 2) / AUDIO_BLOCK_SIZE);
+}
@@ -0,0 +1,15 @@
+/**
+ * @file biquad_presets.c
+ * @brief biquad cascades, generated by Tools/biquad_design.c (do not edit)
+ */
+
+# include "biquad.h"
+
+const biquad_coefs BIQUAD_LOWPASS[1] = {
+        BIQUAD_COEFS(4981, 9962, 4981, -724, -2816) // lowpass:4000:0.707
+};
+
+const biquad_coefs BIQUAD_PIEZO_TONE[2] = {
+        BIQUAD_COEFS(13109, 988, 13109, -988, -9834), // notch:4000:2
+        BIQUAD_COEFS(9723, 19446, 9723, -16616, -5892) // lowpass:6000:0.707
+};
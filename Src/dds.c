@@ -0,0 +1,162 @@
+/**
+ * @file dds.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a bank of direct digital synthesis oscillators with 32-bit phase accumulators
+ */
+
+# include "dds.h"
+# include "cycle_counter.h"
+
+# define DDS_BENCH_STEPS 1024
+# define DDS_BENCH_BASE_FREQ 440
+
+/**
+ * Initializes an oscillator bank with every oscillator stopped
+ * @param bank - the bank to initialize
+ * @param voices - the number of oscillators in use, at most DDS_MAX_VOICES
+ */
+void dds_init(dds_bank *bank, int voices) {
+
+    // clamp the number of voices to the size of the bank
+    if (voices > DDS_MAX_VOICES) voices = DDS_MAX_VOICES;
+    if (voices < 0) voices = 0;
+
+    bank->voices = voices;
+
+    for (int i = 0; i < DDS_MAX_VOICES; i++) {
+        bank->osc[i].phase = 0;
+        bank->osc[i].inc = 0;
+    }
+}
+
+/**
+ * Computes the phase increment of a frequency
+ * @param frequency - the frequency in Q16.16 Hz
+ * @param rate - the rate the oscillator is stepped at in Hz
+ * @return the phase increment per step
+ */
+uint32_t dds_increment(uint32_t frequency, uint32_t rate) {
+
+    // an oscillator that is never stepped never moves
+    if (rate == 0) return 0;
+
+    // inc = frequency * 2^32 / rate, with the Q16.16 frequency supplying 16 of the 32 bits
+    return (uint32_t) (((uint64_t) frequency << 16) / rate);
+}
+
+/**
+ * Sets the frequency of an oscillator without resetting its phase
+ * @param osc - the oscillator to modify
+ * @param frequency - the frequency in Q16.16 Hz
+ * @param rate - the rate the oscillator is stepped at in Hz
+ */
+void dds_set(dds_osc *osc, uint32_t frequency, uint32_t rate) {
+    osc->inc = dds_increment(frequency, rate);
+}
+
+/**
+ * Advances every oscillator of a bank by one step
+ * @param bank - the bank to advance
+ * @return the square wave output of each oscillator, one bit per oscillator
+ */
+uint32_t dds_step(dds_bank *bank) {
+
+    dds_osc *osc = bank->osc;
+    int voices = bank->voices;
+    uint32_t gate = 0;
+    int i = 0;
+
+    // step four oscillators per iteration to keep the loop overhead off the accumulators
+    for (; i + 4 <= voices; i += 4) {
+        osc[i].phase += osc[i].inc;
+        osc[i + 1].phase += osc[i + 1].inc;
+        osc[i + 2].phase += osc[i + 2].inc;
+        osc[i + 3].phase += osc[i + 3].inc;
+        gate |= ((osc[i].phase >> 31) << i)
+                | ((osc[i + 1].phase >> 31) << (i + 1))
+                | ((osc[i + 2].phase >> 31) << (i + 2))
+                | ((osc[i + 3].phase >> 31) << (i + 3));
+    }
+
+    // step any remaining oscillators
+    for (; i < voices; i++) {
+        osc[i].phase += osc[i].inc;
+        gate |= (osc[i].phase >> 31) << i;
+    }
+
+    return gate;
+}
+
+/**
+ * Renders an oscillator as a naive square wave, adding it onto a mix
+ * @param osc - the oscillator to render
+ * @param mix - the mix to add the samples to
+ * @param n - the number of samples to render
+ * @param amplitude - the amplitude of the square wave
+ */
+void dds_render_square(dds_osc *osc, int32_t *mix, int n, int32_t amplitude) {
+
+    uint32_t phase = osc->phase;
+    uint32_t inc = osc->inc;
+    int32_t sign;
+
+    // the phase sign is 0 or -1, which conditionally negates the amplitude without a branch
+    while (n >= 4) {
+        phase += inc;
+        sign = (int32_t) phase >> 31;
+        mix[0] += (amplitude ^ sign) - sign;
+        phase += inc;
+        sign = (int32_t) phase >> 31;
+        mix[1] += (amplitude ^ sign) - sign;
+        phase += inc;
+        sign = (int32_t) phase >> 31;
+        mix[2] += (amplitude ^ sign) - sign;
+        phase += inc;
+        sign = (int32_t) phase >> 31;
+        mix[3] += (amplitude ^ sign) - sign;
+        mix += 4;
+        n -= 4;
+    }
+
+    // render any remaining samples
+    while (n-- > 0) {
+        phase += inc;
+        sign = (int32_t) phase >> 31;
+        *mix++ += (amplitude ^ sign) - sign;
+    }
+
+    osc->phase = phase;
+}
+
+/**
+ * Benchmarks dds_step with a full bank using the cycle counter
+ * @param rate - the rate the bank would be stepped at in Hz
+ * @return the number of oscillators that fit in 1 MHz of core time at that rate
+ */
+int dds_voices_per_mhz(uint32_t rate) {
+
+    static dds_bank bench;
+
+    if (rate == 0) return 0;
+
+    // detune every oscillator so none of them can be folded together
+    dds_init(&bench, DDS_MAX_VOICES);
+    for (int i = 0; i < DDS_MAX_VOICES; i++) {
+        dds_set(&bench.osc[i], DDS_HZ(DDS_BENCH_BASE_FREQ + i), rate);
+    }
+
+    // time a fixed number of steps of the full bank
+    cyc_init();
+    uint32_t start = cyc_now();
+    for (int i = 0; i < DDS_BENCH_STEPS; i++) {
+        dds_step(&bench);
+    }
+    uint32_t cycles = cyc_now() - start;
+
+    if (cycles == 0) return 0;
+
+    // voices per MHz = 10^6 / (cycles per oscillator step * rate)
+    return (int) ((1000000ULL * DDS_BENCH_STEPS * DDS_MAX_VOICES) / ((uint64_t) cycles * rate));
+}
@@ -0,0 +1,139 @@
+/**
+ * @file demo_song.cpp
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief the demo song, resolved into packed notes while the firmware builds
+ */
+
+# include "demo_song.h"
+# include "song_dsl.hpp"
+
+using namespace song_dsl;
+
+/**
+ * The notes of the song, kept in ticks so it plays at the player's tempo
+ */
+static constexpr auto DEMO = compile<TICKS>(
+        note(rest(quarter), kick()),
+        note(rest(eighth), hat()),
+
+        note(keys("A4", eighth)),
+        note(keys("B4", quarter)),
+        note(rest(eighth)),
+        note(keys("A4", eighth), kick()),
+        note(keys("A4", eighth)),
+        note(keys("G4", eighth)),
+        note(keys("F#4", quarter), kick()),
+        note(keys("F#4", quarter)),
+
+        note(keys("F#5", quarter), hat()),
+        note(keys("F#4", quarter + eighth), kick()),
+        note(rest(eighth)),
+
+        note(keys("F#4", eighth)),
+        note(keys("E4", eighth)),
+        note(keys("D4", eighth)),
+        note(keys("E4", eighth)),
+        note(keys("F#4", quarter), kick()),
+
+        note(kick()),
+        note(kick()),
+        note(kick()),
+
+        note(keys("B4", quarter)),
+        note(rest(quarter)),
+
+        note(keys("B4", quarter)),
+        note(rest(eighth)),
+        note(keys("F#4", eighth)),
+        note(keys("A4", eighth)),
+        note(keys("G4", eighth)),
+        note(keys("F#4", quarter)),
+        note(keys("F#4", quarter)),
+
+        note(keys("F#4", eighth)),
+        note(keys("A4", eighth)),
+        note(keys("F#4", quarter)),
+        note(rest(quarter)),
+
+        note(keys("F#4", eighth)),
+        note(keys("E4", eighth)),
+        note(keys("D4", eighth)),
+        note(keys("E4", eighth)),
+        note(keys("F#4", quarter + eighth)),
+
+        note(keys("D5", eighth)),
+        note(keys("D5", eighth)),
+        note(keys("D5", eighth)),
+        note(keys("D5", eighth)),
+        note(keys("E5", eighth)),
+        note(keys("F#5", quarter)),
+        note(keys("E5", quarter)),
+        note(keys("D5", quarter)),
+        note(keys("B4", quarter)),
+        note(keys("A4", quarter)),
+        note(keys("D5", quarter)),
+        note(keys("B4", quarter)),
+        note(keys("G4", quarter)),
+        note(keys("F#4", whole)),
+
+        note(kick()),
+        note(rest(quarter)),
+        note(kick()),
+        note(kick()),
+        note(rest(eighth)),
+
+        note(keys("E5", eighth)),
+        note(keys("F#5", quarter)),
+        note(keys("E5", quarter)),
+        note(keys("D5", quarter)),
+        note(keys("B4", quarter)),
+        note(keys("A4", quarter)),
+        note(keys("D5", quarter)),
+        note(keys("B4", quarter)),
+        note(keys("G4", quarter)),
+        note(keys("F#5", quarter + eighth)),
+        note(keys("A5", eighth)),
+        note(keys("F#5", half)),
+
+        note(kick()),
+        note(kick()),
+        note(rest(eighth)),
+        note(kick()),
+        note(kick()),
+        note(rest(quarter)),
+
+        note(keys("E5", eighth)),
+        note(keys("F#5", quarter)),
+        note(keys("E5", quarter)),
+        note(keys("D5", quarter)),
+        note(keys("B4", quarter)),
+        note(keys("A4", quarter)),
+        note(keys("D5", quarter)),
+        note(keys("B4", quarter)),
+        note(keys("G4", quarter)),
+        note(keys("F#4", whole)),
+
+        note(kick()),
+        note(rest(quarter + eighth)),
+
+        note(keys("F#4", eighth)),
+        note(keys("E4", eighth)),
+        note(keys("D4", eighth)),
+        note(keys("E4", eighth)),
+        note(keys("F#4", whole)),
+
+        note(kick()),
+        note(kick()),
+        note(rest(quarter)),
+
+        note(keys("F#4", eighth)),
+        note(keys("E4", eighth)),
+        note(keys("D4", eighth)),
+        note(keys("E4", eighth)),
+        note(keys("D4", whole)),
+        note(kick())
+);
+
+const sb_song SONG_DEMO = as_song(DEMO, "demo");
@@ -0,0 +1,282 @@
+/**
+ * @file
+ * @brief IMA-ADPCM clips, generated by Tools/adpcm_encode.c (do not edit)
+ */
+
+# include "adpcm.h"
+
+static const uint8_t DRUM_KICK_DATA[] = {
+        0x10, 0x07, 0x00, 0x00,
+        0x77, 0x77, 0x77, 0x77, 0x27, 0x10, 0x10, 0x00, 0x01, 0x01, 0x00, 0x81,
+        0x80, 0x80, 0x99, 0xAA, 0xBB, 0xBD, 0xBC, 0xCC, 0xBB, 0xCC, 0xBB, 0xDB,
+        0xCA, 0xBA, 0xCB, 0xCA, 0xBA, 0xBB, 0xCB, 0xBB, 0xCB, 0xAB, 0xBB, 0xAC,
+        0xBA, 0xAA, 0xAA, 0x99, 0x89, 0x08, 0x22, 0x44, 0x53, 0x34, 0x44, 0x43,
+        0x43, 0x43, 0x43, 0x43, 0x33, 0x34, 0x24, 0x24, 0x33, 0x34, 0x33, 0x34,
+        0x43, 0x33, 0x33, 0x34, 0x33, 0x43, 0x32, 0x23, 0x33, 0x32, 0x22, 0x11,
+        0x01, 0x99, 0xCA, 0xCC, 0xBC, 0xBD, 0xCC, 0xCB, 0xBB, 0xBD, 0xCB, 0xBC,
+        0xBB, 0xCC, 0xBB, 0xCB, 0xCB, 0xBB, 0xBC, 0xBB, 0xBC, 0xBC, 0xCA, 0xBA,
+        0xBB, 0xCB, 0xBA, 0xCB, 0xBA, 0xBA, 0xBB, 0xBA, 0xAB, 0xBA, 0x99, 0x89,
+        0x10, 0x32, 0x45, 0x44, 0x34, 0x34, 0x35, 0x43, 0x34, 0x43, 0x34, 0x43,
+        0x33, 0x44, 0x42, 0x32, 0x43, 0x33, 0x53, 0x32,
+        0x6E, 0x07, 0x33, 0x00,
+        0x43, 0x33, 0x33, 0x25, 0x33, 0x43, 0x23, 0x24, 0x33, 0x42, 0x22, 0x33,
+        0x32, 0x33, 0x23, 0x23, 0x22, 0x12, 0x80, 0xA8, 0xDB, 0xCC, 0xDB, 0xCB,
+        0xBC, 0xCC, 0xBB, 0xCC, 0xBB, 0xBC, 0xBC, 0xBC, 0xCB, 0xCB, 0xBB, 0xBC,
+        0xAC, 0xAC, 0xBB, 0xBC, 0xBB, 0xBC, 0xBC, 0xBB, 0xDB, 0xBA, 0xBB, 0xBC,
+        0xBB, 0xAC, 0xAC, 0xBA, 0xBB, 0xBB, 0xCB, 0xAB, 0xBB, 0xBB, 0xBA, 0xAB,
+        0xAA, 0x89, 0x08, 0x31, 0x63, 0x34, 0x45, 0x33, 0x35, 0x25, 0x34, 0x43,
+        0x43, 0x43, 0x33, 0x25, 0x24, 0x43, 0x42, 0x32, 0x43, 0x33, 0x34, 0x24,
+        0x24, 0x33, 0x43, 0x43, 0x32, 0x24, 0x43, 0x32, 0x33, 0x34, 0x33, 0x34,
+        0x43, 0x32, 0x43, 0x32, 0x33, 0x43, 0x23, 0x33, 0x33, 0x24, 0x32, 0x22,
+        0x22, 0x21, 0x10, 0x88, 0xAA, 0xCC, 0xDB, 0xBC, 0xBD, 0xBC, 0xBC, 0xCC,
+        0xBB, 0xCC, 0xBB, 0xBC, 0xDB, 0xBB, 0xDB, 0xBB,
+        0x50, 0x23, 0x2A, 0x00,
+        0xBC, 0xCB, 0xBB, 0xCC, 0xBA, 0xCB, 0xBB, 0xBC, 0xCB, 0xBB, 0xBC, 0xCB,
+        0xBB, 0xCB, 0xCB, 0xBA, 0xAC, 0xBB, 0xAC, 0xBB, 0xAC, 0xCB, 0xBA, 0xCA,
+        0xAA, 0xBB, 0xBB, 0xBC, 0xBA, 0xBB, 0xCB, 0xBA, 0xAA, 0xAB, 0x9A, 0x9A,
+        0x88, 0x00, 0x32, 0x35, 0x45, 0x43, 0x34, 0x35, 0x43, 0x34, 0x53, 0x33,
+        0x34, 0x34, 0x34, 0x43, 0x24, 0x43, 0x33, 0x34, 0x24, 0x24, 0x43, 0x32,
+        0x34, 0x33, 0x34, 0x34, 0x33, 0x34, 0x34, 0x33, 0x34, 0x34, 0x33, 0x34,
+        0x33, 0x34, 0x34, 0x33, 0x43, 0x43, 0x32, 0x24, 0x33, 0x33, 0x34, 0x33,
+        0x43, 0x33, 0x43, 0x23, 0x33, 0x24, 0x23, 0x23, 0x23, 0x32, 0x22, 0x11,
+        0x01, 0x98, 0xBA, 0xCD, 0xDB, 0xBC, 0xCC, 0xCB, 0xDB, 0xCA, 0xBB, 0xBC,
+        0xBC, 0xBC, 0xDB, 0xCA, 0xBA, 0xBC, 0xCB, 0xBB, 0xBC, 0xBC, 0xCB, 0xBB,
+        0xBC, 0xBC, 0xCB, 0xBB, 0xBC, 0xCB, 0xBB, 0xBC,
+        0xC9, 0x03, 0x27, 0x00,
+        0xCB, 0xBB, 0xBC, 0xCB, 0xBB, 0xBC, 0xBB, 0xBC, 0xAC, 0xCB, 0xBA, 0xCB,
+        0xBA, 0xAC, 0xBB, 0xCB, 0xBB, 0xBB, 0xBC, 0xCB, 0xAB, 0xCB, 0xBA, 0xBB,
+        0xCB, 0xBA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBA, 0x9A, 0x89, 0x10, 0x42,
+        0x44, 0x44, 0x53, 0x43, 0x34, 0x53, 0x43, 0x33, 0x35, 0x43, 0x43, 0x43,
+        0x33, 0x44, 0x32, 0x34, 0x43, 0x43, 0x33, 0x34, 0x24, 0x24, 0x43, 0x32,
+        0x34, 0x33, 0x34, 0x34, 0x33, 0x44, 0x32, 0x43, 0x33, 0x34, 0x33, 0x34,
+        0x34, 0x33, 0x34, 0x43, 0x33, 0x34, 0x33, 0x34, 0x43, 0x33, 0x43, 0x33,
+        0x34, 0x33, 0x24, 0x24, 0x32, 0x43, 0x32, 0x33, 0x43, 0x32, 0x43, 0x32,
+        0x32, 0x33, 0x33, 0x43, 0x22, 0x22, 0x12, 0x11, 0x00, 0x99, 0xCB, 0xCC,
+        0xBC, 0xBD, 0xBC, 0xBD, 0xCB, 0xBC, 0xDB, 0xBB, 0xBC, 0xBC, 0xBC, 0xCB,
+        0xCB, 0xCB, 0xBB, 0xBC, 0xBC, 0xCB, 0xCB, 0xBB,
+        0x7B, 0x14, 0x20, 0x00,
+        0xBC, 0xCB, 0xCB, 0xBB, 0xBC, 0xCB, 0xBB, 0xBC, 0xCB, 0xCB, 0xBB, 0xCB,
+        0xCB, 0xBA, 0xBC, 0xBB, 0xBC, 0xCB, 0xBB, 0xBC, 0xBB, 0xBC, 0xBC, 0xBB,
+        0xAC, 0xAC, 0xBB, 0xCB, 0xBB, 0xCB, 0xBB, 0xBC, 0xBB, 0xCB, 0xBB, 0xBC,
+        0xBB, 0xCB, 0xBB, 0xBB, 0xAC, 0xBB, 0xAC, 0xAB, 0xBB, 0xBA, 0xBB, 0xAB,
+        0xAB, 0x9A, 0x99, 0x10, 0x33, 0x45, 0x44, 0x34, 0x44, 0x43, 0x43, 0x53,
+        0x33, 0x34, 0x34, 0x34, 0x34, 0x43, 0x43, 0x43, 0x33, 0x25, 0x43, 0x42,
+        0x32, 0x43, 0x43, 0x33, 0x53, 0x32, 0x34, 0x33, 0x34, 0x34, 0x43, 0x33,
+        0x53, 0x32, 0x24, 0x24, 0x33, 0x43, 0x33, 0x34, 0x43, 0x33, 0x43, 0x24,
+        0x33, 0x24, 0x43, 0x33, 0x33, 0x34, 0x34, 0x33, 0x53, 0x32, 0x33, 0x34,
+        0x33, 0x34, 0x43, 0x32, 0x24, 0x33, 0x33, 0x34, 0x33, 0x43, 0x33, 0x33,
+        0x24, 0x33, 0x33, 0x43, 0x22, 0x23, 0x22, 0x12,
+        0x8A, 0x1A, 0x0A, 0x00,
+        0x81, 0x90, 0xBA, 0xCC, 0xCC, 0xDB, 0xCB, 0xCB, 0xBC, 0xBC, 0xDB, 0xBB,
+        0xCC, 0xBB, 0xBC, 0xDB, 0xBB, 0xDB, 0xBB, 0xBC, 0xCB, 0xCB, 0xCB, 0xCA,
+        0xBA, 0xAC, 0xAC, 0xBB, 0xBC, 0xCB, 0xBB, 0xBC, 0xCB, 0xCB, 0xBB, 0xBC,
+        0xBB, 0xCC, 0xBA, 0xCB, 0xBB, 0xBC, 0xCB, 0xBB, 0xCB, 0xCB, 0xBB, 0xCB,
+        0xBB, 0xBC, 0xCB, 0xBB, 0xAC, 0xCB, 0xBB, 0xBB, 0xBC, 0xAC, 0xCB, 0xBA,
+        0xCB, 0xBA, 0xCB, 0xBA, 0xCB, 0xBA, 0xBB, 0xBC, 0xBB, 0xCB, 0xBB, 0xBB,
+        0xBC, 0xBA, 0xCB, 0xAA, 0xBB, 0xBA, 0xAA, 0x9B, 0x9A, 0x89, 0x10, 0x32,
+        0x45, 0x34, 0x35, 0x35, 0x53, 0x33, 0x35, 0x53, 0x42, 0x33, 0x53, 0x33,
+        0x34, 0x34, 0x34, 0x43, 0x43, 0x33, 0x34, 0x34, 0x43, 0x33, 0x44, 0x32,
+        0x34, 0x33, 0x34, 0x34, 0x43, 0x33, 0x34, 0x24, 0x24, 0x33, 0x24, 0x24,
+        0x33, 0x34, 0x43, 0x42, 0x32, 0x43, 0x33, 0x43,
+        0xAF, 0x02, 0x1C, 0x00,
+        0x33, 0x34, 0x24, 0x33, 0x34, 0x43, 0x32, 0x34, 0x42, 0x32, 0x43, 0x32,
+        0x43, 0x33, 0x43, 0x42, 0x32, 0x42, 0x32, 0x33, 0x43, 0x33, 0x33, 0x34,
+        0x43, 0x32, 0x33, 0x33, 0x34, 0x23, 0x33, 0x43, 0x22, 0x12, 0x12, 0x11,
+        0x90, 0x99, 0xEB, 0xBB, 0xCC, 0xDB, 0xCB, 0xBC, 0xCB, 0xBC, 0xDB, 0xBB,
+        0xBC, 0xBC, 0xBC, 0xBC, 0xCB, 0xCB, 0xBB, 0xBC, 0xBC, 0xCB, 0xAC, 0xCB,
+        0xBA, 0xBC, 0xCB, 0xBB, 0xBC, 0xAC, 0xAC, 0xBB, 0xBC, 0xCB, 0xCB, 0xBA,
+        0xBC, 0xBB, 0xBC, 0xAC, 0xAC, 0xBB, 0xCB, 0xCB, 0xBB, 0xCB, 0xBB, 0xBC,
+        0xCB, 0xBB, 0xBC, 0xBB, 0xBC, 0xAC, 0xCB, 0xBA, 0xAC, 0xBB, 0xCB, 0xBB,
+        0xAC, 0xAC, 0xAB, 0xCB, 0xAB, 0xAC, 0xBB, 0xBB, 0xBC, 0xCB, 0xBA, 0xBB,
+        0xBC, 0xBA, 0xAC, 0xBB, 0xBA, 0xAC, 0xBA, 0xBA, 0xAB, 0xAA, 0xAA, 0x99,
+        0x90, 0x21, 0x33, 0x35, 0x34, 0x34, 0x35, 0x44,
+        0xA1, 0xF1, 0x0C, 0x00,
+        0x43, 0x43, 0x24, 0x43, 0x43, 0x43, 0x33, 0x34, 0x34, 0x34, 0x43, 0x33,
+        0x44, 0x32, 0x34, 0x43, 0x33, 0x34, 0x34, 0x43, 0x33, 0x34, 0x34, 0x43,
+        0x33, 0x53, 0x32, 0x34, 0x42, 0x33, 0x43, 0x33, 0x34, 0x34, 0x33, 0x34,
+        0x43, 0x43, 0x32, 0x24, 0x43, 0x32, 0x24, 0x33, 0x24, 0x43, 0x33, 0x33,
+        0x34, 0x34, 0x33, 0x34, 0x33, 0x34, 0x43, 0x33, 0x43, 0x33, 0x43, 0x33,
+        0x24, 0x33, 0x24, 0x33, 0x43, 0x33, 0x33, 0x43, 0x33, 0x33, 0x33, 0x24,
+        0x23, 0x23, 0x22, 0x12, 0x11, 0x91, 0xB9, 0xBB, 0xBD, 0xCB, 0xDB, 0xCB,
+        0xCB, 0xBC, 0xDB, 0xBB, 0xBC, 0xBC, 0xBC, 0xBC, 0xCB, 0xCB, 0xCB, 0xBB,
+        0xBC, 0xBC, 0xCB, 0xBB, 0xAD, 0xCB, 0xBB, 0xCB, 0xCB, 0xBB, 0xBC, 0xBC,
+        0xBB, 0xBC, 0xBC, 0xCB, 0xBB, 0xBC, 0xCB, 0xCB, 0xBA, 0xBC, 0xBB, 0xBC,
+        0xCB, 0xBB, 0xBC, 0xAC, 0xCB, 0xBA, 0xCB, 0xBB,
+        0x58, 0xFD, 0x14, 0x00,
+        0xCB, 0xCB, 0xBB, 0xCB, 0xBB, 0xCB, 0xCB, 0xBA, 0xAC, 0xBB, 0xAC, 0xBB,
+        0xBC, 0xBB, 0xBC, 0xBB, 0xCB, 0xCB, 0xBA, 0xCB, 0xBA, 0xBB, 0xCB, 0xBB,
+        0xBB, 0xAC, 0xBB, 0xBB, 0xCB, 0xAA, 0xAB, 0xAA, 0xA9, 0x99, 0x09, 0x11,
+        0x33, 0x33, 0x35, 0x43, 0x43, 0x53, 0x33, 0x35, 0x43, 0x53, 0x33, 0x53,
+        0x33, 0x53, 0x33, 0x34, 0x34, 0x43, 0x43, 0x33, 0x34, 0x53, 0x32, 0x34,
+        0x33, 0x34, 0x34, 0x43, 0x43, 0x33, 0x43, 0x43, 0x33, 0x34, 0x43, 0x33,
+        0x34, 0x43, 0x33, 0x34, 0x43, 0x43, 0x32, 0x34, 0x33, 0x53, 0x32, 0x24,
+        0x33, 0x34, 0x33, 0x34, 0x24, 0x43, 0x32, 0x43, 0x32, 0x34, 0x42, 0x32,
+        0x33, 0x34, 0x33, 0x34, 0x43, 0x33, 0x33, 0x34, 0x43, 0x32, 0x24, 0x33,
+        0x33, 0x24, 0x33, 0x33, 0x24, 0x33, 0x33, 0x33, 0x32, 0x33, 0x33, 0x11,
+        0x11, 0x99, 0xAA, 0xBB, 0xCB, 0xBB, 0xCC, 0xCB,
+        0xF5, 0x07, 0x05, 0x00,
+        0xDB, 0xBB, 0xBC, 0xBC, 0xBC, 0xBC, 0xBC, 0xCB, 0xCB, 0xCB, 0xBB, 0xBC,
+        0xBC, 0xCB, 0x0B,
+};
+
+const adpcm_clip DRUM_KICK = {DRUM_KICK_DATA, 2343}; // 1207 bytes
+
+static const uint8_t DRUM_SNARE_DATA[] = {
+        0xCE, 0x43, 0x00, 0x00,
+        0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x94, 0xF9, 0x85, 0x9A, 0x14, 0x08, 0x8C,
+        0xD4, 0x38, 0x0A, 0x98, 0x14, 0xC8, 0x09, 0xA5, 0xB2, 0x0A, 0x84, 0x28,
+        0x9A, 0xD1, 0x02, 0x1B, 0xA1, 0xD9, 0x87, 0x88, 0x00, 0x1C, 0xC3, 0xB4,
+        0x80, 0xB3, 0x92, 0x79, 0x80, 0x28, 0x3C, 0xA8, 0xC1, 0x30, 0x04, 0x9D,
+        0x93, 0x09, 0x68, 0x19, 0xB8, 0x30, 0xC2, 0x99, 0x87, 0xC0, 0x38, 0x00,
+        0x3C, 0x0C, 0x38, 0xA0, 0xC2, 0xA1, 0x12, 0xDA, 0x93, 0x6A, 0x9C, 0x12,
+        0x28, 0xB9, 0x80, 0xB6, 0x28, 0xB9, 0x90, 0x70, 0x88, 0x3A, 0xA4, 0xD2,
+        0x40, 0xB9, 0x60, 0x2A, 0x1A, 0x02, 0xD9, 0xB3, 0xB5, 0x84, 0x89, 0xA1,
+        0x28, 0x93, 0x4D, 0xA9, 0x82, 0xD0, 0x84, 0x98, 0xA8, 0x95, 0xC2, 0x90,
+        0x08, 0x90, 0xA1, 0x78, 0x08, 0x88, 0xD8, 0xB3, 0xB2, 0x92, 0x44, 0x09,
+        0xA0, 0xF2, 0x93, 0x8A, 0x32, 0x0E, 0xC3, 0x30,
+        0x07, 0xD4, 0x4F, 0x00,
+        0x08, 0xB4, 0xA3, 0x08, 0x97, 0xB0, 0xA4, 0x20, 0x11, 0x89, 0xF8, 0x04,
+        0xC8, 0xB3, 0x94, 0x28, 0x0A, 0x92, 0xF8, 0xA2, 0xB2, 0x58, 0x4B, 0x8A,
+        0x38, 0x1A, 0x3B, 0x5C, 0x09, 0xD8, 0x03, 0x18, 0xB8, 0x00, 0x10, 0x4E,
+        0x0C, 0x40, 0xC8, 0x01, 0x08, 0xA3, 0x20, 0xAA, 0x7A, 0xB1, 0x01, 0x28,
+        0xF1, 0x11, 0x88, 0xA3, 0x00, 0x2F, 0xC2, 0x48, 0x98, 0x28, 0x19, 0xB9,
+        0x59, 0xC8, 0x22, 0x8D, 0xC4, 0xA2, 0x28, 0x4A, 0xC8, 0xB3, 0xA3, 0xA0,
+        0xA2, 0x07, 0xB9, 0x40, 0xD8, 0x82, 0x39, 0x2C, 0x11, 0x8D, 0x03, 0x1C,
+        0xA2, 0x22, 0x1D, 0x01, 0xA0, 0x00, 0x6A, 0xC9, 0x13, 0x00, 0x0F, 0xA3,
+        0x20, 0x90, 0x4D, 0x88, 0x29, 0x0D, 0x82, 0x99, 0x03, 0x2D, 0x92, 0xA0,
+        0xF3, 0x48, 0x09, 0x9A, 0x81, 0x00, 0x29, 0xF3, 0x09, 0xB5, 0x90, 0x50,
+        0x2A, 0x80, 0x2C, 0xA0, 0xB2, 0xA6, 0x02, 0xA8,
+        0x4D, 0x0A, 0x4A, 0x00,
+        0xAB, 0x92, 0xA1, 0x34, 0x11, 0xF3, 0xA9, 0x01, 0x53, 0xF0, 0x80, 0x21,
+        0x19, 0x0B, 0x80, 0x00, 0x2A, 0xF0, 0x49, 0x20, 0xA0, 0x1F, 0x92, 0x98,
+        0xC4, 0x18, 0xB1, 0xA0, 0x92, 0x87, 0x0C, 0x02, 0xA0, 0x12, 0x0F, 0xA2,
+        0xA1, 0xC2, 0x33, 0x8E, 0x31, 0x1B, 0x00, 0xE1, 0x84, 0x18, 0x2C, 0x4A,
+        0x1B, 0x4A, 0x98, 0x69, 0x0A, 0xC2, 0x01, 0x88, 0xB3, 0x28, 0x11, 0xCB,
+        0xD5, 0x00, 0x28, 0xA9, 0x81, 0x4A, 0xE4, 0x30, 0x88, 0x89, 0x3A, 0x4A,
+        0xAA, 0x86, 0xAB, 0x83, 0xA3, 0x0D, 0x41, 0x2C, 0x89, 0x29, 0xE4, 0x30,
+        0x09, 0x2B, 0x92, 0x38, 0xB8, 0xD7, 0xA3, 0x92, 0xA8, 0x95, 0x10, 0x8B,
+        0x83, 0x21, 0xD9, 0x13, 0xC9, 0x31, 0x8F, 0x82, 0x90, 0x20, 0xF2, 0x38,
+        0x3A, 0x2E, 0x08, 0x4C, 0x8A, 0x18, 0x81, 0xA9, 0xB5, 0xB3, 0x12, 0x09,
+        0x3C, 0x3A, 0xD2, 0x3B, 0xE1, 0xB5, 0x11, 0x1B,
+        0x4F, 0xE5, 0x47, 0x00,
+        0x84, 0x11, 0xD8, 0x83, 0xB8, 0x38, 0x7A, 0x88, 0x19, 0x0B, 0x80, 0x16,
+        0x2E, 0x98, 0xA2, 0x91, 0x85, 0x8A, 0x48, 0x09, 0x1C, 0x4A, 0x0A, 0x59,
+        0xC8, 0x94, 0x90, 0x1A, 0xA0, 0x82, 0xC3, 0x80, 0x98, 0x95, 0x6A, 0xB9,
+        0x90, 0x97, 0x28, 0x4B, 0x1C, 0x90, 0x11, 0x28, 0xC0, 0xD2, 0xA4, 0x08,
+        0x88, 0x51, 0x1A, 0x99, 0x05, 0xBA, 0xA5, 0xB2, 0x13, 0x2E, 0xA8, 0x03,
+        0x3A, 0x0C, 0xA1, 0x00, 0x41, 0xCB, 0x06, 0x99, 0x1B, 0x29, 0x88, 0xA6,
+        0xB0, 0x00, 0x02, 0x8E, 0x31, 0x4A, 0x2F, 0x80, 0x81, 0x1D, 0xC3, 0x18,
+        0xC3, 0x02, 0xD0, 0x93, 0x08, 0x11, 0x2A, 0x0D, 0x21, 0x1D, 0x92, 0x6A,
+        0x0A, 0xA2, 0x11, 0x8B, 0x3A, 0x98, 0x16, 0x1F, 0x29, 0x0B, 0x02, 0x88,
+        0x22, 0x9F, 0x18, 0xB4, 0x00, 0xD3, 0x80, 0xA2, 0x6B, 0x3A, 0xBA, 0x81,
+        0xA1, 0x95, 0xB2, 0xB6, 0xB2, 0x03, 0xAC, 0x13,
+        0x34, 0xF4, 0x40, 0x00,
+        0x7A, 0x00, 0x90, 0xC2, 0xB2, 0x69, 0x99, 0xB4, 0x80, 0x91, 0x05, 0x8A,
+        0x83, 0x0E, 0xC4, 0xA3, 0x92, 0x0A, 0x94, 0xA1, 0x01, 0x08, 0x0C, 0xA8,
+        0x90, 0x87, 0x99, 0x18, 0xC0, 0x31, 0x93, 0xDC, 0x94, 0xC3, 0x91, 0xA8,
+        0x11, 0x04, 0x0F, 0x10, 0x10, 0x0C, 0xC4, 0x01, 0x80, 0x02, 0x3C, 0x98,
+        0xD0, 0x68, 0x2A, 0x90, 0x99, 0x83, 0xA4, 0x80, 0x18, 0xB0, 0x7A, 0x80,
+        0x0D, 0xA2, 0xB4, 0xB4, 0xC3, 0x12, 0x98, 0xB1, 0x7C, 0x1B, 0xA0, 0x84,
+        0x89, 0xC1, 0x11, 0x2A, 0x3B, 0x81, 0x2A, 0xCC, 0x28, 0x25, 0x0B, 0x3B,
+        0x5B, 0x5A, 0x1C, 0x38, 0x3F, 0x9A, 0x94, 0x90, 0x93, 0x01, 0x8E, 0x83,
+        0x18, 0x98, 0xC1, 0x02, 0x2A, 0xB5, 0x11, 0x3E, 0x80, 0x80, 0xB0, 0xB3,
+        0x2E, 0x92, 0x01, 0x5D, 0x0B, 0xC3, 0x81, 0x29, 0x4E, 0x0A, 0x01, 0x0C,
+        0xA3, 0x19, 0xA2, 0x0C, 0x80, 0x13, 0xD3, 0xE4,
+        0xBF, 0xF9, 0x45, 0x00,
+        0x98, 0xA4, 0x20, 0xB0, 0x83, 0xF2, 0x10, 0xA0, 0xC4, 0x11, 0x2A, 0x0B,
+        0x96, 0x08, 0x90, 0xD3, 0x30, 0x2B, 0x28, 0x08, 0x0F, 0x39, 0x81, 0x9A,
+        0xA3, 0x85, 0x0D, 0x48, 0xAB, 0xA4, 0x10, 0x20, 0x1B, 0xCA, 0x00, 0x7B,
+        0xA0, 0x30, 0x10, 0x1F, 0x3A, 0x1C, 0x38, 0xD8, 0x30, 0x4C, 0xB0, 0x93,
+        0xB0, 0x12, 0x80, 0x7A, 0xC0, 0x10, 0x81, 0x8B, 0x59, 0xD2, 0x81, 0x59,
+        0xA8, 0x82, 0xC8, 0x95, 0x00, 0x2C, 0x09, 0x38, 0x00, 0x3F, 0xA0, 0x3A,
+        0x4C, 0xA8, 0x18, 0xC2, 0x18, 0xA3, 0x3D, 0xA0, 0xC1, 0x50, 0x2B, 0xE1,
+        0x30, 0xB0, 0x31, 0xA9, 0x1B, 0x78, 0x90, 0xB8, 0x95, 0x28, 0x2A, 0xBA,
+        0xA7, 0x08, 0x84, 0x99, 0x68, 0x8B, 0x11, 0x4A, 0x8B, 0x38, 0x19, 0x8A,
+        0x6A, 0xE2, 0x20, 0xB0, 0x10, 0xA8, 0xC7, 0x18, 0x02, 0x19, 0xA9, 0x08,
+        0x23, 0xBB, 0x05, 0x0F, 0x82, 0x90, 0x4B, 0x1B,
+        0xDD, 0xFA, 0x3A, 0x00,
+        0xD4, 0x02, 0x89, 0x03, 0x2D, 0x1B, 0x94, 0x01, 0xA9, 0x7A, 0x9A, 0xA4,
+        0x19, 0x84, 0x2B, 0x10, 0xB1, 0x81, 0xF2, 0x92, 0xE3, 0x93, 0x4B, 0x0B,
+        0x58, 0x88, 0xC0, 0x90, 0xB5, 0x38, 0xA8, 0x04, 0x3C, 0x3C, 0x9A, 0x83,
+        0x39, 0x89, 0x8F, 0xA3, 0x68, 0x89, 0x08, 0x10, 0x1D, 0x02, 0xBA, 0x84,
+        0xA8, 0x83, 0xA2, 0x22, 0x2D, 0x92, 0xC2, 0x11, 0x9F, 0xB5, 0x04, 0x2C,
+        0xB0, 0x84, 0x0A, 0x83, 0x9A, 0xC5, 0x01, 0xA9, 0xA6, 0x90, 0x11, 0x80,
+        0xD2, 0x38, 0x4C, 0xD0, 0x38, 0xA8, 0xC2, 0x94, 0x80, 0xB2, 0x80, 0x2A,
+        0x6B, 0x89, 0x89, 0xB5, 0x41, 0x19, 0xD0, 0x83, 0x0C, 0x11, 0x08, 0x5B,
+        0xD0, 0x83, 0x8B, 0x92, 0xC6, 0x01, 0x19, 0xA0, 0x94, 0x10, 0x0C, 0x11,
+        0xC2, 0x3A, 0xF2, 0x10, 0x00, 0x80, 0xE0, 0x93, 0x2A, 0x5B, 0x3B, 0xB8,
+        0x95, 0x3B, 0x6B, 0x98, 0x01, 0x08, 0x2E, 0x91,
+        0x33, 0x01, 0x3A, 0x00,
+        0xA9, 0xB4, 0x13, 0x8D, 0x48, 0xC0, 0x40, 0x99, 0xA1, 0xA5, 0x10, 0x1A,
+        0x81, 0x3B, 0xB9, 0x97, 0x8A, 0xB5, 0x22, 0x09, 0x4C, 0x18, 0x98, 0x4D,
+        0x09, 0x1B, 0x85, 0x9A, 0xB4, 0x08, 0xB4, 0x59, 0x89, 0x98, 0x02, 0x90,
+        0x30, 0x3F, 0xAB, 0x22, 0xC2, 0xA0, 0x04, 0x8D, 0x03, 0x1D, 0x18, 0x19,
+        0x7B, 0x98, 0xC2, 0x00, 0x10, 0xD2, 0x02, 0x8A, 0x94, 0x89, 0xB6, 0xC3,
+        0x30, 0x2B, 0x08, 0xA1, 0x83, 0x0F, 0x18, 0x88, 0x20, 0x5D, 0x8B, 0xB4,
+        0x18, 0x01, 0x01, 0xAC, 0x50, 0x0C, 0x08, 0xC4, 0x38, 0xB1, 0x92, 0x5B,
+        0x3A, 0xA9, 0xB5, 0x49, 0x4B, 0x2B, 0x99, 0x20, 0x28, 0x2A, 0x4A, 0x2E,
+        0xB9, 0x97, 0x18, 0x4A, 0x8B, 0xA2, 0x04, 0xA0, 0x5B, 0x4B, 0x0A, 0xB2,
+        0x58, 0xD8, 0xB3, 0x20, 0x99, 0x50, 0x3C, 0xA8, 0xC2, 0x30, 0x8B, 0x78,
+        0x0B, 0xC3, 0xA1, 0xA2, 0x95, 0x88, 0x20, 0x00,
+        0x6B, 0xFC, 0x31, 0x00,
+        0x24, 0x3B, 0x8D, 0xD4, 0x01, 0x80, 0x81, 0x59, 0x8B, 0xC2, 0x58, 0x08,
+        0x98, 0x92, 0x39, 0x10, 0x9F, 0x05, 0x3C, 0xB8, 0x81, 0x90, 0x32, 0xC1,
+        0x28, 0x3A, 0x9F, 0x81, 0x01, 0x20, 0xF1, 0xB3, 0x84, 0xBA, 0x94, 0x3A,
+        0x5C, 0xC0, 0xB3, 0xC3, 0x30, 0x80, 0x08, 0x0D, 0xB2, 0xB3, 0x29, 0x19,
+        0x70, 0xA0, 0x5B, 0x1B, 0x20, 0xA0, 0xF3, 0xB2, 0x12, 0x1C, 0x28, 0xA2,
+        0x83, 0x98, 0x89, 0x97, 0x1E, 0x08, 0xC3, 0xD3, 0x02, 0x39, 0xF0, 0x80,
+        0x10, 0x18, 0x01, 0xA9, 0x48, 0x3F, 0x2A, 0x9A, 0xC3, 0x02, 0x5A, 0x0C,
+        0x20, 0xB0, 0x90, 0xA5, 0xA0, 0x18, 0xD4, 0xA4, 0x81, 0x99, 0x13, 0xF1,
+        0xA3, 0x18, 0x91, 0x19, 0x99, 0x79, 0x8A, 0x50, 0xB8, 0x93, 0x02, 0xD8,
+        0x84, 0xB9, 0xB3, 0x92, 0x79, 0x3A, 0x1B, 0xB0, 0x84, 0xA9, 0x18, 0xA6,
+        0x4A, 0x4B, 0x1B, 0x93, 0xAB, 0x58, 0xA1, 0xC1,
+        0x16, 0x01, 0x2F, 0x00,
+        0xA8, 0x8A, 0x97, 0xD2, 0x02, 0x1A, 0x98, 0x22, 0x3E, 0x8A, 0x18, 0x82,
+        0xF3, 0xC3, 0x00,
+};
+
+const adpcm_clip DRUM_SNARE = {DRUM_SNARE_DATA, 2343}; // 1207 bytes
+
+static const uint8_t DRUM_HAT_DATA[] = {
+        0xAE, 0x35, 0x00, 0x00,
+        0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xB9, 0xC0, 0xA7, 0x08, 0xA4, 0x08, 0x2B,
+        0xE5, 0x22, 0x2C, 0x98, 0x93, 0xB9, 0x22, 0xE4, 0xB2, 0x20, 0xB2, 0x28,
+        0x0B, 0xE2, 0x94, 0x29, 0x98, 0xA1, 0xA7, 0x90, 0x92, 0x5B, 0xD1, 0xB3,
+        0x92, 0xD3, 0xA3, 0x30, 0xAA, 0x21, 0x4F, 0x8A, 0xA1, 0x22, 0xA8, 0x2B,
+        0xB4, 0x28, 0x48, 0x1D, 0xA8, 0x13, 0xC9, 0x01, 0xB6, 0xC0, 0x33, 0x0B,
+        0x6C, 0x2B, 0x29, 0xA9, 0xB3, 0xB3, 0x94, 0x99, 0xA6, 0x48, 0x1D, 0x81,
+        0x18, 0x9A, 0x82, 0xE3, 0x11, 0x8A, 0x92, 0x50, 0x0C, 0x39, 0xB0, 0xD2,
+        0x23, 0x8D, 0x32, 0x2F, 0x2A, 0x90, 0xA8, 0xB5, 0xC4, 0xA4, 0x08, 0x91,
+        0x10, 0xB0, 0x58, 0x9A, 0x93, 0xA8, 0xA7, 0x80, 0x90, 0xB4, 0xD3, 0x92,
+        0x10, 0x98, 0x91, 0x31, 0x0C, 0x88, 0xB0, 0xB7, 0xB3, 0xA3, 0x03, 0x1D,
+        0xA0, 0xE3, 0xA5, 0x18, 0x10, 0x2D, 0xB0, 0x22,
+        0xFA, 0xEC, 0x49, 0x00,
+        0x82, 0xE3, 0xB3, 0x01, 0xC2, 0xA1, 0xB5, 0x11, 0x88, 0x09, 0xB8, 0x87,
+        0xA9, 0xB7, 0xA3, 0x10, 0x1A, 0xA1, 0xC0, 0xA6, 0xB2, 0x22, 0x3D, 0x1B,
+        0x20, 0x2D, 0x3A, 0x4C, 0x0A, 0xB0, 0x95, 0x18, 0x99, 0x82, 0x00, 0x6C,
+        0x2C, 0x28, 0xBA, 0x84, 0x08, 0xB1, 0x11, 0x0B, 0x78, 0xAA, 0x03, 0x3A,
+        0xC9, 0x84, 0x98, 0xC3, 0x01, 0x5C, 0xC0, 0x22, 0x8B, 0x20, 0x3C, 0x9A,
+        0x41, 0xBB, 0x87, 0x1A, 0xF3, 0x92, 0x10, 0x3A, 0xAA, 0xB6, 0x92, 0x90,
+        0x92, 0xB4, 0x98, 0x32, 0xAC, 0x96, 0x39, 0x2C, 0x80, 0x2B, 0xB3, 0x5B,
+        0xB0, 0x94, 0x4B, 0x88, 0xA0, 0x01, 0x6A, 0x9B, 0x85, 0x88, 0x3C, 0xE3,
+        0x11, 0x89, 0x6A, 0x0A, 0x39, 0x2C, 0xA1, 0x08, 0xB3, 0x5A, 0xB0, 0x91,
+        0xF3, 0x22, 0x1B, 0x0A, 0x92, 0x10, 0x2A, 0xF1, 0x82, 0xF3, 0x81, 0x11,
+        0x3C, 0x0A, 0x4A, 0x99, 0xA2, 0xC5, 0x82, 0x89,
+        0x99, 0x03, 0x3E, 0x00,
+        0x0B, 0x92, 0x91, 0x83, 0x09, 0xF0, 0x92, 0x92, 0x03, 0xFB, 0x83, 0x02,
+        0x2D, 0x3B, 0x09, 0x00, 0x3A, 0xE9, 0x23, 0x2A, 0xAA, 0x7E, 0x98, 0x80,
+        0xC2, 0x02, 0xA8, 0xA2, 0x93, 0xC5, 0x4A, 0x90, 0xB1, 0x83, 0x3E, 0xC1,
+        0xA2, 0xC3, 0x04, 0x1D, 0x01, 0x3B, 0x09, 0xD0, 0xA5, 0x10, 0x4B, 0x4B,
+        0x2B, 0x3A, 0x8A, 0x40, 0x2E, 0xB0, 0x93, 0x90, 0xC3, 0x11, 0x88, 0x89,
+        0xE5, 0x02, 0x08, 0x89, 0x92, 0x49, 0xF0, 0x12, 0x8A, 0x00, 0x39, 0x4B,
+        0x8B, 0xA5, 0x1A, 0xA3, 0xB2, 0x4A, 0x20, 0x3F, 0x1B, 0x18, 0xF1, 0x22,
+        0x1C, 0x29, 0x98, 0x10, 0x99, 0xE5, 0xA4, 0x91, 0x80, 0xA2, 0x81, 0x1A,
+        0x92, 0x00, 0xAA, 0x87, 0x99, 0x12, 0x2F, 0x91, 0x88, 0x01, 0xD8, 0x23,
+        0x3D, 0x3D, 0x09, 0x5A, 0x1B, 0x18, 0x88, 0x09, 0xD4, 0xB3, 0x93, 0x08,
+        0x4A, 0x2A, 0xC8, 0x40, 0xB9, 0xB7, 0x82, 0x2A,
+        0xF3, 0xFE, 0x33, 0x00,
+        0xA3, 0x00, 0xB9, 0x97, 0x08,
+};
+
+const adpcm_clip DRUM_HAT = {DRUM_HAT_DATA, 781}; // 405 bytes
+
@@ -0,0 +1,117 @@
+/**
+ * @file echo.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a feedback delay send effect on the mixer output
+ */
+
+# include <stm32f446xx.h>
+# include "echo.h"
+# include "cycle_counter.h"
+
+/**
+ * The delay line
+ */
+static int16_t echo_line[ECHO_MAX_SAMPLES];
+
+static int echo_enabled = 0;
+static int echo_length = ECHO_MAX_SAMPLES;
+static int echo_position = 0;
+static int32_t echo_feedback = 0;
+static int32_t echo_send = 0;
+static int32_t echo_wet = 0;
+
+/**
+ * Enables the echo with new settings, clearing the delay line
+ * @param delay_ms - the echo time in ms, at most ECHO_MAX_DELAY_MS
+ * @param feedback - the fraction of each echo fed back into the line in Q15
+ * @param send - the fraction of the mix sent into the line in Q15
+ * @param wet - the level the echoes are added back to the mix at in Q15
+ */
+void echo_enable(int delay_ms, int32_t feedback, int32_t send, int32_t wet) {
+
+    // bypass the effect while the line changes
+    echo_enabled = 0;
+
+    int length = (delay_ms * AUDIO_RATE) / 1000;
+    if (length < 1) length = 1;
+    if (length > ECHO_MAX_SAMPLES) length = ECHO_MAX_SAMPLES;
+
+    for (int i = 0; i < length; i++) echo_line[i] = 0;
+
+    echo_length = length;
+    echo_position = 0;
+    echo_feedback = feedback;
+    echo_send = send;
+    echo_wet = wet;
+
+    echo_enabled = 1;
+}
+
+/**
+ * Bypasses the echo
+ */
+void echo_disable(void) {
+    echo_enabled = 0;
+}
+
+/**
+ * Adds echoes onto a block of the mix in place
+ * @param mix - the mix to process
+ * @param n - the number of samples in the mix
+ */
+void echo_process(int32_t *mix, int n) {
+
+    if (!echo_enabled) return;
+
+    int position = echo_position;
+
+    while (n > 0) {
+
+        // process up to the end of the line so the wrap is only checked once per run
+        int run = echo_length - position;
+        if (run > n) run = n;
+
+        int16_t *line = &echo_line[position];
+
+        for (int i = 0; i < run; i++) {
+            int32_t dry = mix[i];
+            int32_t delayed = line[i];
+
+            // feed the dry send and the fed-back echo into the line, then add the echo to the mix
+            int32_t sent = (__SSAT(dry, 16) * echo_send) >> 15;
+            line[i] = (int16_t) __SSAT(sent + ((delayed * echo_feedback) >> 15), 16);
+            mix[i] = dry + ((delayed * echo_wet) >> 15);
+        }
+
+        mix += run;
+        n -= run;
+        position += run;
+        if (position == echo_length) position = 0;
+    }
+
+    echo_position = position;
+}
+
+/**
+ * Benchmarks echo_process using the cycle counter
+ * Runs one block through the live delay line, so call it while audio is stopped
+ * @return the number of core cycles one AUDIO_BLOCK_SIZE block takes with the echo enabled
+ */
+int echo_cycles_per_block(void) {
+
+    static int32_t mix[AUDIO_BLOCK_SIZE];
+
+    int enabled = echo_enabled;
+    echo_enabled = 1;
+
+    cyc_init();
+    uint32_t start = cyc_now();
+    echo_process(mix, AUDIO_BLOCK_SIZE);
+    uint32_t cycles = cyc_now() - start;
+
+    echo_enabled = enabled;
+
+    return (int) cycles;
+}
@@ -0,0 +1,100 @@
+/**
+ * @file fm_voice.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a two-operator FM voice using fixed-point phase accumulators and a Q15 sine table
+ */
+
+# include "fm_voice.h"
+# include "sine_table.h"
+# include "cycle_counter.h"
+# include "audio_driver.h"
+
+# define FM_INDEX_SHIFT 5 // Q15 sine times Q12 index is Q27, and one cycle is Q32
+# define FM_BENCH_SAMPLES 256
+
+/**
+ * The patch MP_INSTR_FM notes play with, a bright electric piano
+ */
+const fm_patch FM_PATCH_EPIANO = {
+        .ratio = 1 << 8,
+        .index_peak = FM_INDEX(5.0),
+        .index_sustain = FM_INDEX(0.8),
+        .decay = 32433 // about a 100 ms time constant at 16-sample steps
+};
+
+/**
+ * Starts a note on an FM voice
+ * @param v - the voice to start
+ * @param patch - the patch to play the note with
+ * @param carrier - the oscillator the note is rendered with, already set to the note frequency
+ */
+void fm_start(fm_voice *v, const fm_patch *patch, const dds_osc *carrier) {
+    v->patch = patch;
+    v->mod_phase = 0;
+    v->mod_inc = (uint32_t) (((uint64_t) carrier->inc * patch->ratio) >> 8);
+    v->index = patch->index_peak;
+    v->env_count = 0;
+}
+
+/**
+ * Renders an FM voice, adding it onto a mix
+ * @param v - the voice to render
+ * @param carrier - the oscillator the voice was started with
+ * @param mix - the mix to add the samples to
+ * @param n - the number of samples to render
+ * @param amplitude - the amplitude in Q15
+ */
+void fm_render(fm_voice *v, dds_osc *carrier, int32_t *mix, int n, int32_t amplitude) {
+
+    uint32_t phase = carrier->phase;
+    uint32_t inc = carrier->inc;
+    uint32_t mod_phase = v->mod_phase;
+    uint32_t mod_inc = v->mod_inc;
+    int32_t index = v->index;
+    int env_count = v->env_count;
+
+    for (int i = 0; i < n; i++) {
+        phase += inc;
+        mod_phase += mod_inc;
+
+        // the modulator offsets the carrier phase by up to index cycles
+        uint32_t offset = (uint32_t) (SINE_OF(mod_phase) * index) << FM_INDEX_SHIFT;
+
+        mix[i] += (SINE_OF(phase + offset) * amplitude) >> 15;
+
+        // step the index envelope every FM_ENV_PERIOD samples, however the render calls are split
+        if (++env_count == FM_ENV_PERIOD) {
+            index = v->patch->index_sustain + (((index - v->patch->index_sustain) * v->patch->decay) >> 15);
+            env_count = 0;
+        }
+    }
+
+    carrier->phase = phase;
+    v->mod_phase = mod_phase;
+    v->index = index;
+    v->env_count = env_count;
+}
+
+/**
+ * Benchmarks fm_render using the cycle counter
+ * @return the number of core cycles one voice takes per sample
+ */
+int fm_cycles_per_sample(void) {
+
+    static int32_t mix[FM_BENCH_SAMPLES];
+    dds_osc carrier = {0, 0};
+    fm_voice v;
+
+    dds_set(&carrier, DDS_HZ(440), AUDIO_RATE);
+    fm_start(&v, &FM_PATCH_EPIANO, &carrier);
+
+    // time one block of a single voice
+    cyc_init();
+    uint32_t start = cyc_now();
+    fm_render(&v, &carrier, mix, FM_BENCH_SAMPLES, 32767);
+    uint32_t cycles = cyc_now() - start;
+
+    return (int) ((cycles + FM_BENCH_SAMPLES / 2) / FM_BENCH_SAMPLES);
+}
@@ -8,6 +8,10 @@
 
 # include "main.h"
 # include "music_player.h"
+# include "audio_driver.h"
+# include "demo_song.h"
+
+# define BUTTON_DEBOUNCE_MS 20 // how long the button must hold still before a change counts
 
 /**
  * Private variables
@@ -26,6 +30,8 @@ static void MX_TIM2_Init(void);
 static void MX_TIM3_Init(void);
 static void MX_TIM4_Init(void);
 static void MX_TIM5_Init(void);
+static void wait_for_button(int pressed);
+static int play_next_song(int *next_song);
 
 /**
  * The application entry point
@@ -49,143 +55,24 @@ int main(void) {
     GPIOC->MODER |= (GPIO_MODE_INPUT << GPIO_MODER_MODER13_Pos);
     GPIOC->PUPDR |= (GPIO_PULLUP << GPIO_PUPDR_PUPD13_Pos);
 
+    // the position in the song library of the song the button plays next
+    int next_song = 0;
+
     while (1) {
 
-        // wait for the button to be pressed
-        while (GPIOC->IDR & GPIO_IDR_ID13);
+        // act once the button is let go, so one press moves on by one song however long it is held
+        wait_for_button(1);
+        wait_for_button(0);
+
+        if (play_next_song(&next_song)) continue;
 
         // initialize music player
         mp_init();
 
-        // the notes of the song
-        mp_note notes[] = {
-                {MP_INSTR_REST, MP_NOTE_QUARTER, 0,   MP_INSTR_KICK},
-                {MP_INSTR_REST, MP_NOTE_EIGTH,   0,   MP_INSTR_HAT},
-
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   440, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 494, MP_INSTR_NONE},
-                {MP_INSTR_REST, MP_NOTE_EIGTH,   0,   MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   440, MP_INSTR_KICK},
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   440, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   392, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 370, MP_INSTR_KICK},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 370, MP_INSTR_NONE},
-
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 740, MP_INSTR_HAT},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER + MP_NOTE_EIGTH, 370, MP_INSTR_KICK},
-                {MP_INSTR_REST, MP_NOTE_EIGTH,   0,   MP_INSTR_NONE},
-
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   370, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   330, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   294, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   330, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 370, MP_INSTR_KICK},
-
-                {MP_INSTR_KICK, MP_NOTE_QUARTER, 0,   MP_INSTR_NONE},
-                {MP_INSTR_KICK, MP_NOTE_QUARTER, 0,   MP_INSTR_NONE},
-                {MP_INSTR_KICK, MP_NOTE_QUARTER, 0,   MP_INSTR_NONE},
-
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 494, MP_INSTR_NONE},
-                {MP_INSTR_REST, MP_NOTE_QUARTER, 0,   MP_INSTR_NONE},
-
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 494, MP_INSTR_NONE},
-                {MP_INSTR_REST, MP_NOTE_EIGTH,   0,   MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   370, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   440, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   392, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 370, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 370, MP_INSTR_NONE},
-
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   370, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   440, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 370, MP_INSTR_NONE},
-                {MP_INSTR_REST, MP_NOTE_QUARTER, 0,   MP_INSTR_NONE},
-
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   370, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   330, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   294, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   330, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER + MP_NOTE_EIGTH, 370, MP_INSTR_NONE},
-
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   588, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   588, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   588, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   588, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   659, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 740, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 659, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 588, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 494, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 440, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 588, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 494, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 392, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_WHOLE,   370, MP_INSTR_NONE},
-
-                {MP_INSTR_KICK, MP_NOTE_QUARTER, 0,   MP_INSTR_NONE},
-                {MP_INSTR_REST, MP_NOTE_QUARTER, 0,   MP_INSTR_NONE},
-                {MP_INSTR_KICK, MP_NOTE_EIGTH,   0,   MP_INSTR_NONE},
-                {MP_INSTR_KICK, MP_NOTE_EIGTH,   0,   MP_INSTR_NONE},
-                {MP_INSTR_REST, MP_NOTE_EIGTH,   0,   MP_INSTR_NONE},
-
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   659, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 740, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 659, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 588, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 494, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 440, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 588, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 494, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 392, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER + MP_NOTE_EIGTH, 740, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   880, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_HALF,    740, MP_INSTR_NONE},
-
-                {MP_INSTR_KICK, MP_NOTE_EIGTH,   0,   MP_INSTR_NONE},
-                {MP_INSTR_KICK, MP_NOTE_EIGTH,   0,   MP_INSTR_NONE},
-                {MP_INSTR_REST, MP_NOTE_EIGTH,   0,   MP_INSTR_NONE},
-                {MP_INSTR_KICK, MP_NOTE_EIGTH,   0,   MP_INSTR_NONE},
-                {MP_INSTR_KICK, MP_NOTE_EIGTH,   0,   MP_INSTR_NONE},
-                {MP_INSTR_REST, MP_NOTE_QUARTER, 0,   MP_INSTR_NONE},
-
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   659, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 740, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 659, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 588, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 494, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 440, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 588, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 494, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_QUARTER, 392, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_WHOLE,   370, MP_INSTR_NONE},
-
-                {MP_INSTR_KICK, MP_NOTE_EIGTH,   0,   MP_INSTR_NONE},
-                {MP_INSTR_REST, MP_NOTE_QUARTER + MP_NOTE_EIGTH, 0,   MP_INSTR_NONE},
-
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   370, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   330, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   294, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   330, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_WHOLE,   370, MP_INSTR_NONE},
-
-                {MP_INSTR_KICK, MP_NOTE_EIGTH,   0,   MP_INSTR_NONE},
-                {MP_INSTR_KICK, MP_NOTE_EIGTH,   0,   MP_INSTR_NONE},
-                {MP_INSTR_REST, MP_NOTE_QUARTER, 0,   MP_INSTR_NONE},
-
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   370, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   330, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   294, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_EIGTH,   330, MP_INSTR_NONE},
-                {MP_INSTR_KEYS, MP_NOTE_WHOLE,   294, MP_INSTR_NONE},
-                {MP_INSTR_KICK, MP_NOTE_EIGTH,   0,   MP_INSTR_NONE},
-
-                {MP_INSTR_END}
-
-        };
-
-        mp_song song = {notes};
-
-        mp_add_song(&song);
+        // queue the demo song, which was resolved into packed notes while the firmware built
+        sb_reader reader;
+        sb_open(&reader, &SONG_DEMO);
+        mp_feed_resolved(&reader);
 
         mp_play();
 
@@ -193,6 +80,46 @@ int main(void) {
 
 }
 
+/**
+ * Waits for the user button to settle pressed or released, rendering audio and queueing notes
+ * ahead while it does
+ * @param pressed - one to wait for the button to be pressed, zero to wait for it to be released
+ */
+static void wait_for_button(int pressed) {
+
+    uint32_t since = HAL_GetTick();
+
+    // the button reads low while pressed, and any bounce starts the wait again
+    while (HAL_GetTick() - since < BUTTON_DEBOUNCE_MS) {
+        int down = !(GPIOC->IDR & GPIO_IDR_ID13);
+        if (down != pressed) since = HAL_GetTick();
+        mp_feed_library();
+        audio_pump();
+    }
+}
+
+/**
+ * Plays the library's songs in turn, listed from their index entries alone, passing over any that
+ * cannot be played, such as a MIDI file without the sample backend or a song that fails its CRC
+ * @param next_song - the position in the library of the song to try first, moved past the song played
+ * @return one if a song started, zero if no song in the library can be played
+ */
+static int play_next_song(int *next_song) {
+
+    int count = sb_count();
+
+    for (int tried = 0; tried < count; tried++) {
+
+        sb_song song;
+        int index = *next_song;
+        *next_song = (index + 1) % count;
+
+        if (sb_get(index, &song) && sb_verify(&song) && mp_play_library(song.id)) return 1;
+    }
+
+    return 0;
+}
+
 /**
  * Configures the system clock with CubeMX settings
  */
@@ -265,11 +192,11 @@ static void MX_TIM3_Init(void) {
     TIM_OC_InitTypeDef sConfigOC = {0};
 
     htim3.Instance = TIM3;
-    htim3.Init.Prescaler = 400;
+    htim3.Init.Prescaler = 3;
     htim3.Init.CounterMode = TIM_COUNTERMODE_UP;
-    htim3.Init.Period = 91;
+    htim3.Init.Period = 9090;
     htim3.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
-    htim3.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+    htim3.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
     if (HAL_TIM_Base_Init(&htim3) != HAL_OK) {
         Error_Handler();
     }
@@ -310,11 +237,11 @@ static void MX_TIM4_Init(void) {
     TIM_OC_InitTypeDef sConfigOC = {0};
 
     htim4.Instance = TIM4;
-    htim4.Init.Prescaler = 400;
+    htim4.Init.Prescaler = 3;
     htim4.Init.CounterMode = TIM_COUNTERMODE_UP;
-    htim4.Init.Period = 91;
+    htim4.Init.Period = 9090;
     htim4.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
-    htim4.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+    htim4.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
     if (HAL_TIM_Base_Init(&htim4) != HAL_OK) {
         Error_Handler();
     }
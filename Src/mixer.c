@@ -0,0 +1,441 @@
+/**
+ * @file mixer.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a sample-rate voice mixer for the PWM audio backend
+ */
+
+# include <stm32f446xx.h>
+# include "mixer.h"
+# include "dds.h"
+# include "wavetable.h"
+# include "drum_samples.h"
+# include "fm_voice.h"
+# include "pluck_voice.h"
+# include "echo.h"
+# include "biquad.h"
+# include "sfx.h"
+# include "cycle_counter.h"
+# include "audio_driver.h"
+
+# define MIXER_DOWN_LOAD 75 // percent of real time that steps the quality down
+# define MIXER_UP_LOAD 40 // percent of real time that counts towards stepping the quality up
+# define MIXER_CALM_BLOCKS 64 // consecutive calm blocks before stepping the quality up
+# define MIXER_PANIC_SAMPLES (2 * AUDIO_BLOCK_SIZE) // deadline that steps the quality down
+# define MIXER_CALM_SAMPLES ((AUDIO_FIFO_BLOCKS / 2) * AUDIO_BLOCK_SIZE) // deadline needed to step up
+
+// every mixer voice owns the delay line pool slot with its own index
+# if KS_VOICES < MIXER_VOICES
+# error "the pluck delay line pool needs a slot for every mixer voice"
+# endif
+
+/**
+ * Mixer Voice
+ */
+typedef struct {
+    mp_instrument instrument;
+    int active;
+    int32_t amplitude;
+    const int16_t *table;
+    adpcm_player clip;
+    fm_voice fm;
+    ks_voice pluck;
+    sfx_state sfx;
+    int sfx_clock;         // control tick accumulator, ticks each time it passes AUDIO_RATE
+    int32_t sfx_amplitude; // amplitude scaled by the effect level
+    int32_t sfx_hold;      // the held noise sample
+} mixer_voice;
+
+/**
+ * The voices of the mixer and the oscillators that drive them
+ */
+static mixer_voice mixer_voices[MIXER_VOICES];
+static dds_bank mixer_bank;
+
+/**
+ * The tone shaping filter on the mixer output, bypassed until mixer_set_tone is called
+ */
+static biquad_cascade mixer_tone;
+
+/**
+ * The quality the mixer renders at and the blocks in a row it has had headroom for
+ */
+static mixer_quality mixer_tier_state;
+static int mixer_calm = 0;
+
+/**
+ * The cycles and samples of the chunks rendered so far towards the next block the governor judges
+ */
+static uint32_t mixer_spent = 0;
+static int mixer_rendered = 0;
+
+/**
+ * The 32-bit accumulator the voices are summed into before saturating
+ */
+static int32_t mixer_mix[AUDIO_BLOCK_SIZE];
+
+/**
+ * Initializes the mixer with every voice silent
+ */
+void mixer_init(void) {
+
+    dds_init(&mixer_bank, MIXER_VOICES);
+    biquad_init(&mixer_tone, 0, 0);
+
+    // start at full quality and time every chunk with the cycle counter
+    mixer_tier_state.tier = MIXER_TIER_FULL;
+    mixer_tier_state.transitions = 0;
+    mixer_calm = 0;
+    mixer_spent = 0;
+    mixer_rendered = 0;
+    cyc_init();
+
+    for (int i = 0; i < MIXER_VOICES; i++) {
+        mixer_voices[i].instrument = MP_INSTR_KEYS;
+        mixer_voices[i].active = 0;
+        mixer_voices[i].amplitude = MIXER_VOICE_GAIN;
+        mixer_voices[i].table = WT_SQUARE[0];
+    }
+}
+
+/**
+ * Sets the tone shaping filter on the mixer output
+ * @param coefs - the coefficients of each filter section, such as BIQUAD_PIEZO_TONE
+ * @param sections - the number of sections, or zero to bypass the filter
+ */
+void mixer_set_tone(const biquad_coefs *coefs, int sections) {
+    biquad_init(&mixer_tone, coefs, sections);
+}
+
+/**
+ * Starts a note on a mixer voice
+ * @param voice - the voice to play the note on
+ * @param instrument - the instrument to play the note with
+ * @param frequency - the frequency of the note in Q16.16 Hz, or zero for a rest
+ */
+void mixer_note_on(int voice, mp_instrument instrument, uint32_t frequency) {
+
+    // ignore voices that do not exist
+    if (voice < 0 || voice >= MIXER_VOICES) return;
+
+    // a rest silences the voice
+    if (frequency == 0) {
+        mixer_note_off(voice);
+        return;
+    }
+
+    mixer_voice *v = &mixer_voices[voice];
+
+    // silence the voice while it changes so the render loop never sees it half set
+    v->active = 0;
+    v->instrument = instrument;
+    dds_set(&mixer_bank.osc[voice], frequency, AUDIO_RATE);
+
+    // pick the band-limited table for the octave once per note rather than per sample
+    v->table = wt_select(instrument == MP_INSTR_SAW ? WT_WAVE_SAW : WT_WAVE_SQUARE, mixer_bank.osc[voice].inc);
+
+    // drums play their recordings from the start, FM voices restart their envelope, and plucks
+    // excite their string
+    switch (instrument) {
+
+        case MP_INSTR_FM:
+            fm_start(&v->fm, &FM_PATCH_EPIANO, &mixer_bank.osc[voice]);
+            break;
+
+        case MP_INSTR_HAT:
+            adpcm_start(&v->clip, &DRUM_HAT);
+            break;
+
+        case MP_INSTR_KICK:
+            adpcm_start(&v->clip, &DRUM_KICK);
+            break;
+
+        case MP_INSTR_PLUCK:
+            ks_start(&v->pluck, voice, frequency);
+            break;
+
+        case MP_INSTR_SNARE:
+            adpcm_start(&v->clip, &DRUM_SNARE);
+            break;
+
+        default:
+            break;
+    }
+
+    v->active = 1;
+}
+
+/**
+ * Starts a sound effect on a mixer voice, which frees itself when the effect ends
+ * @param voice - the voice to play the effect on
+ * @param params - the effect to play
+ */
+void mixer_sfx_on(int voice, const sfx_params *params) {
+
+    // ignore voices that do not exist
+    if (voice < 0 || voice >= MIXER_VOICES) return;
+
+    mixer_voice *v = &mixer_voices[voice];
+
+    // silence the voice while it changes so the render loop never sees it half set
+    v->active = 0;
+    if (!params) return;
+
+    v->instrument = MP_INSTR_SFX;
+    sfx_start(&v->sfx, params);
+    dds_set(&mixer_bank.osc[voice], DDS_HZ(v->sfx.frequency), AUDIO_RATE);
+    v->sfx_clock = 0;
+    v->sfx_amplitude = (v->amplitude * v->sfx.level) >> 15;
+    v->sfx_hold = 0;
+
+    v->active = 1;
+}
+
+/**
+ * Renders a sound effect voice, adding it onto a mix
+ * The effect is advanced at SFX_TICK_FREQ, spreading the ticks evenly over the samples
+ * @param v - the voice to render
+ * @param osc - the oscillator of the voice
+ * @param mix - the mix to add the samples to
+ * @param n - the number of samples to render
+ * @return one while the effect is playing, zero once it has finished
+ */
+static int mixer_render_sfx(mixer_voice *v, dds_osc *osc, int32_t *mix, int n) {
+
+    uint32_t phase = osc->phase;
+    int noise = v->sfx.params->noise;
+
+    for (int i = 0; i < n; i++) {
+
+        // advance the effect on each control tick
+        v->sfx_clock += SFX_TICK_FREQ;
+        if (v->sfx_clock >= AUDIO_RATE) {
+            v->sfx_clock -= AUDIO_RATE;
+            if (!sfx_tick(&v->sfx)) {
+                osc->phase = phase;
+                return 0;
+            }
+            dds_set(osc, DDS_HZ(v->sfx.frequency), AUDIO_RATE);
+            v->sfx_amplitude = (v->amplitude * v->sfx.level) >> 15;
+        }
+
+        uint32_t last = phase;
+        phase += osc->inc;
+
+        if (noise) {
+            // hold a fresh noise sample for each thirty-second of a cycle
+            if ((last ^ phase) >> 27) v->sfx_hold = (int32_t) sfx_noise() - 32768;
+            mix[i] += (v->sfx_hold * v->sfx_amplitude) >> 15;
+        } else {
+            // the top byte of the phase is compared against the duty cycle in 256ths
+            mix[i] += (int) (phase >> 24) < v->sfx.duty ? v->sfx_amplitude : -v->sfx_amplitude;
+        }
+    }
+
+    osc->phase = phase;
+    return 1;
+}
+
+/**
+ * Silences a mixer voice
+ * @param voice - the voice to silence
+ */
+void mixer_note_off(int voice) {
+    if (voice >= 0 && voice < MIXER_VOICES) mixer_voices[voice].active = 0;
+}
+
+/**
+ * Checks whether a mixer voice is sounding
+ * @param voice - the voice to check
+ * @return one if the voice is sounding, zero otherwise
+ */
+int mixer_active(int voice) {
+    return (voice >= 0 && voice < MIXER_VOICES) ? mixer_voices[voice].active : 0;
+}
+
+/**
+ * Estimates how loud a mixer voice is
+ * Drums fade over their recording, so they are scaled by how much of the clip is left
+ * @param voice - the voice to check
+ * @return the estimated peak amplitude of the voice, or zero if it is silent
+ */
+int mixer_level(int voice) {
+
+    if (!mixer_active(voice)) return 0;
+
+    mixer_voice *v = &mixer_voices[voice];
+
+    switch (v->instrument) {
+
+        case MP_INSTR_HAT:
+        case MP_INSTR_KICK:
+        case MP_INSTR_SNARE:
+            return (int) (((int64_t) v->amplitude * (v->clip.clip->samples - v->clip.position)) / v->clip.clip->samples);
+
+        case MP_INSTR_SFX:
+            return v->sfx_amplitude;
+
+        default:
+            return v->amplitude;
+    }
+}
+
+/**
+ * Reads the active quality tier and how often it has changed
+ * @param quality - the counters to fill
+ */
+void mixer_get_quality(mixer_quality *quality) {
+    *quality = mixer_tier_state;
+}
+
+/**
+ * Moves the quality tier once a block's worth of chunks has rendered, based on their cost and the
+ * time left before the DMA deadline
+ * The player splits blocks at every note and event, so a chunk may be a few samples whose budget
+ * the fixed cost of a call alone would use up
+ * @param cycles - the core cycles the chunk took to render
+ * @param n - the number of samples in the chunk
+ */
+static void mixer_govern(uint32_t cycles, int n) {
+
+    mixer_spent += cycles;
+    mixer_rendered += n;
+    if (mixer_rendered < AUDIO_BLOCK_SIZE) return;
+
+    cycles = mixer_spent;
+    n = mixer_rendered;
+    mixer_spent = 0;
+    mixer_rendered = 0;
+
+    uint32_t budget = (SystemCoreClock / AUDIO_RATE) * n;
+    uint32_t deadline = audio_deadline();
+
+    // step down straight away when rendering cannot keep up or the FIFO is nearly dry
+    if (cycles * 100 > budget * MIXER_DOWN_LOAD || deadline < MIXER_PANIC_SAMPLES) {
+        mixer_calm = 0;
+        if (mixer_tier_state.tier < MIXER_TIER_CULL) {
+            mixer_tier_state.tier++;
+            mixer_tier_state.transitions++;
+        }
+        return;
+    }
+
+    // step up only after a long run of cheap blocks with a healthy FIFO
+    if (cycles * 100 < budget * MIXER_UP_LOAD && deadline >= MIXER_CALM_SAMPLES) {
+        if (++mixer_calm >= MIXER_CALM_BLOCKS && mixer_tier_state.tier > MIXER_TIER_FULL) {
+            mixer_tier_state.tier--;
+            mixer_tier_state.transitions++;
+            mixer_calm = 0;
+        }
+        return;
+    }
+
+    mixer_calm = 0;
+}
+
+/**
+ * Silences the quietest voices until at most MIXER_CULL_VOICES are sounding
+ */
+static void mixer_cull(void) {
+
+    int sounding = 0;
+    for (int v = 0; v < MIXER_VOICES; v++) sounding += mixer_voices[v].active;
+
+    while (sounding > MIXER_CULL_VOICES) {
+
+        // find the quietest sounding voice
+        int quietest = -1;
+        int lowest = 0;
+        for (int v = 0; v < MIXER_VOICES; v++) {
+            int level = mixer_level(v);
+            if (mixer_voices[v].active && (quietest < 0 || level < lowest)) {
+                quietest = v;
+                lowest = level;
+            }
+        }
+
+        mixer_voices[quietest].active = 0;
+        sounding--;
+    }
+}
+
+/**
+ * Renders and mixes every sounding voice
+ * @param out - the buffer to render the signed 16-bit samples into
+ * @param n - the number of samples to render
+ */
+void mixer_render(int16_t *out, int n) {
+
+    while (n > 0) {
+
+        // mix at most one accumulator's worth of samples at a time
+        int chunk = n < AUDIO_BLOCK_SIZE ? n : AUDIO_BLOCK_SIZE;
+        mixer_tier tier = mixer_tier_state.tier;
+        uint32_t start = cyc_now();
+
+        if (tier >= MIXER_TIER_CULL) mixer_cull();
+
+        for (int i = 0; i < chunk; i++) mixer_mix[i] = 0;
+
+        // add each sounding voice onto the mix
+        for (int v = 0; v < MIXER_VOICES; v++) {
+
+            if (!mixer_voices[v].active) continue;
+
+            switch (mixer_voices[v].instrument) {
+
+                case MP_INSTR_FM:
+                    fm_render(&mixer_voices[v].fm, &mixer_bank.osc[v], mixer_mix, chunk, mixer_voices[v].amplitude);
+                    break;
+
+                case MP_INSTR_SFX:
+                    // effects are one-shots that free their voice when they end
+                    if (!mixer_render_sfx(&mixer_voices[v], &mixer_bank.osc[v], mixer_mix, chunk)) {
+                        mixer_voices[v].active = 0;
+                    }
+                    break;
+
+                case MP_INSTR_PLUCK:
+                    ks_render(&mixer_voices[v].pluck, mixer_mix, chunk, mixer_voices[v].amplitude);
+                    break;
+
+                case MP_INSTR_HAT:
+                case MP_INSTR_KICK:
+                case MP_INSTR_SNARE:
+                    // drums are one-shots that free their voice when the clip ends
+                    if (!adpcm_render(&mixer_voices[v].clip, mixer_mix, chunk, mixer_voices[v].amplitude)) {
+                        mixer_voices[v].active = 0;
+                    }
+                    break;
+
+                default:
+                    // keys and sawtooth voices play their band-limited table
+                    if (tier >= MIXER_TIER_NEAREST) {
+                        wt_render_nearest(&mixer_bank.osc[v], mixer_voices[v].table, mixer_mix, chunk,
+                                          mixer_voices[v].amplitude);
+                    } else {
+                        wt_render(&mixer_bank.osc[v], mixer_voices[v].table, mixer_mix, chunk,
+                                  mixer_voices[v].amplitude);
+                    }
+                    break;
+            }
+        }
+
+        // run the mix through the send effects
+        echo_process(mixer_mix, chunk);
+
+        // saturate the mix to 16 bits
+        for (int i = 0; i < chunk; i++) out[i] = (int16_t) __SSAT(mixer_mix[i], 16);
+
+        // shape the tone for the output transducer
+        if (tier >= MIXER_TIER_LEAN_FX) biquad_process_limited(&mixer_tone, out, chunk, 1);
+        else biquad_process(&mixer_tone, out, chunk);
+
+        mixer_govern(cyc_now() - start, chunk);
+
+        out += chunk;
+        n -= chunk;
+    }
+
+}
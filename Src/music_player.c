@@ -6,14 +6,471 @@
   * @brief an API for playing music using two piezo buzzers
   */
 
+# include <stm32f446xx.h>
 # include "music_player.h"
 # include "piezo_driver.h"
+# include "pitch_fx.h"
+# include "audio_driver.h"
+# include "mixer.h"
+# include "dds.h"
+# include "voice_alloc.h"
+# include "sfx.h"
+# include "tuning.h"
+# include "tempo_map.h"
+# include "bitbang_driver.h"
+
+# define MP_MS_TO_SAMPLES(ms) ((int) (((long long) (ms) * AUDIO_RATE) / 1000))
+# define MP_US_TO_SAMPLES(us) (((uint64_t) (us) * AUDIO_RATE) / 1000000)
+# define MP_SMF_CHANNELS 16
+# define MP_SMF_DRUM_CHANNEL 9 // channel 10 in General MIDI numbering
+# define MP_BANG_LOAD 50 // percent of the core the bit-bang interrupt may use
 
 /**
  * The queue of notes to be played
  */
 note_buffer note_queue;
 
+/**
+ * The output the music player plays through
+ */
+static mp_backend active_backend = MP_BACKEND_PIEZO;
+
+/**
+ * Samples left until the next note starts, and until each mixer voice releases its note
+ */
+static int pcm_remaining = 0;
+static int pcm_gate[MIXER_VOICES] = {0};
+static mp_instrument pcm_instrument[MIXER_VOICES];
+
+/**
+ * Assigns the parts of each note to the mixer voices
+ */
+static voice_allocator pcm_voices;
+static va_policy pcm_policy = VA_STEAL_OLDEST;
+
+/**
+ * Milliseconds left until the next note starts, and until each bit-bang voice releases its note
+ */
+static int bang_remaining = 0;
+static int bang_gate[BB_MAX_VOICES] = {0};
+
+/**
+ * Assigns the parts of each note to the bit-bang voices
+ */
+static voice_allocator bang_voices;
+
+/**
+ * Times the notes whose durations are in ticks
+ */
+static tm_map mp_tempo = {0, 0, MP_TEMPO, 0, 0, 0, 0};
+
+/**
+ * The MIDI file the sample backend plays in place of the note queue, the next event of the file,
+ * the program of each channel, and the samples played since the file started
+ */
+static smf_player *pcm_smf = 0;
+static smf_event pcm_smf_event;
+static uint8_t pcm_smf_program[MP_SMF_CHANNELS];
+static uint64_t pcm_smf_clock = 0;
+
+/**
+ * The song mp_play_library started, and the reader of whichever format it is in
+ * A MIDI file is never fed, so mp_init leaves the format at SB_FORMAT_SMF until a song of notes starts
+ */
+static sb_format library_format = SB_FORMAT_SMF;
+static union {
+    sb_reader song;
+    sc_decoder compressed;
+    seq_vm sequence;
+    smf_player smf;
+} library;
+
+/**
+ * Sets a buzzer to play one part of a note and starts its pitch effect
+ * Sound effects carry their preset in place of a frequency and drive the pitch themselves
+ * @param buzzer - the buzzer to play the part on
+ * @param instrument - the instrument of the part
+ * @param duration - the duration of the part in ms
+ * @param frequency - the frequency or pitch of the part, or the preset of a sound effect
+ * @param fx - the pitch effect of the part
+ * @param next_frequency - the frequency or pitch of the following part, or zero if there is none
+ */
+static void mp_set_part(piezo_buzzer buzzer, mp_instrument instrument, int duration, int frequency, mp_fx fx,
+                        int next_frequency) {
+
+    if (instrument == MP_INSTR_SFX) {
+        const sfx_params *sfx = sfx_preset(frequency);
+        piezo_set(buzzer, duration, sfx ? sfx->frequency : 0);
+        fx_start_sfx(buzzer, sfx);
+        return;
+    }
+
+    // pitches are tuned once here, so the buzzers and their effects only ever see Hz
+    frequency = tn_hz(frequency);
+    piezo_set(buzzer, duration, frequency);
+    fx_start(buzzer, fx, duration, frequency, tn_hz(next_frequency));
+}
+
+/**
+ * Times a note as it starts, making any tempo change it carries first
+ * @param n - the note, whose durations in ticks are replaced by their lengths in ms
+ */
+static void mp_time_note(mp_note * n) {
+    if (n->tempo) tm_set_tempo(&mp_tempo, n->tempo);
+    tm_resolve(&mp_tempo, &n->duration, &n->dual_duration);
+}
+
+/**
+ * Sets both buzzers to play a note and starts their pitch effects
+ * @param n - the note to play
+ */
+static void mp_set_note(mp_note * n) {
+
+    // durations in ticks are timed as the note starts, so tempo changes land where they should
+    mp_time_note(n);
+
+    // portamento glides towards the note queued after this one
+    mp_note * next = nb_peek(&note_queue);
+
+    // set the notes
+    mp_set_part(BUZZER0, n->instrument, n->duration, n->frequency, n->fx, next ? next->frequency : 0);
+    mp_set_part(BUZZER1, n->dual_instrument, n->dual_duration, n->dual_frequency, n->dual_fx,
+                next ? next->dual_frequency : 0);
+}
+
+
+/**
+ * Checks whether an instrument is one of the preset drums
+ * @param instrument - the instrument to check
+ * @return one if the instrument is a drum, zero otherwise
+ */
+static int mp_is_drum(mp_instrument instrument) {
+    return instrument == MP_INSTR_HAT || instrument == MP_INSTR_KICK || instrument == MP_INSTR_SNARE;
+}
+
+/**
+ * Starts one part of a note on whichever mixer voice the allocator gives it
+ * @param instrument - the instrument of the part
+ * @param frequency - the frequency of the part in Hz or a pitch, or zero for a rest
+ * @param duration - the duration of the part in milliseconds
+ */
+static void mp_pcm_start_part(mp_instrument instrument, int frequency, int duration) {
+
+    // sound effects carry their preset in place of a frequency
+    if (instrument == MP_INSTR_SFX) {
+        const sfx_params *sfx = sfx_preset(frequency);
+        if (!sfx || duration <= 0) return;
+        int voice = va_note_on(&pcm_voices, -1, MIXER_VOICE_GAIN);
+        if (voice < 0) return;
+        mixer_sfx_on(voice, sfx);
+        pcm_gate[voice] = MP_MS_TO_SAMPLES(duration);
+        pcm_instrument[voice] = instrument;
+        return;
+    }
+
+    // rests do not need a voice
+    if (frequency <= 0 || duration <= 0) return;
+
+    int voice = va_note_on(&pcm_voices, frequency, MIXER_VOICE_GAIN);
+    if (voice < 0) return;
+    mixer_note_on(voice, instrument, tn_q16(frequency));
+    pcm_gate[voice] = MP_MS_TO_SAMPLES(duration);
+    pcm_instrument[voice] = instrument;
+}
+
+/**
+ * Frees the mixer voices that have gone silent and lets the rest report how loud they are, so the
+ * allocator steals sensibly
+ */
+static void mp_pcm_sync_voices(void) {
+    for (int v = 0; v < MIXER_VOICES; v++) {
+        int level = mixer_level(v);
+        if (level == 0) va_free(&pcm_voices, v);
+        else va_set_level(&pcm_voices, v, level);
+    }
+}
+
+/**
+ * Starts a note on the mixer voices
+ * @param n - the note to play
+ */
+static void mp_pcm_set_note(mp_note * n) {
+
+    mp_pcm_sync_voices();
+    mp_time_note(n);
+
+    mp_pcm_start_part(n->instrument, n->frequency, n->duration);
+    mp_pcm_start_part(n->dual_instrument, n->dual_frequency, n->dual_duration);
+
+    // the next note starts once both parts have finished
+    int duration = MP_MS_TO_SAMPLES(n->duration);
+    int dual_duration = MP_MS_TO_SAMPLES(n->dual_duration);
+    pcm_remaining = duration > dual_duration ? duration : dual_duration;
+}
+
+/**
+ * Starts one part of a note on whichever bit-bang voice the allocator gives it
+ * Sound effects play the starting frequency of their preset, as the voices are plain squares
+ * @param instrument - the instrument of the part
+ * @param frequency - the frequency of the part in Hz or a pitch, or the preset of a sound effect
+ * @param duration - the duration of the part in milliseconds
+ */
+static void mp_bang_start_part(mp_instrument instrument, int frequency, int duration) {
+
+    if (instrument == MP_INSTR_SFX) {
+        const sfx_params *sfx = sfx_preset(frequency);
+        frequency = sfx ? sfx->frequency : 0;
+    }
+
+    // rests do not need a voice
+    if (instrument == MP_INSTR_REST || frequency <= 0 || duration <= 0) return;
+
+    // there may be no voices if the core is too slow for any
+    int voice = va_note_on(&bang_voices, frequency, 1);
+    if (voice < 0) return;
+    bb_set(voice, tn_q16(frequency));
+    bang_gate[voice] = duration;
+}
+
+/**
+ * Starts a note on the bit-bang voices
+ * @param n - the note to play
+ */
+static void mp_bang_set_note(mp_note * n) {
+
+    mp_time_note(n);
+
+    mp_bang_start_part(n->instrument, n->frequency, n->duration);
+    mp_bang_start_part(n->dual_instrument, n->dual_frequency, n->dual_duration);
+
+    // the next note starts once both parts have finished
+    bang_remaining = n->duration > n->dual_duration ? n->duration : n->dual_duration;
+}
+
+/**
+ * Sequences the queued notes onto the bit-bang voices, called by the bit-bang interrupt every ms
+ */
+static void mp_bang_control(void) {
+
+    // release the voices whose notes just ended, silencing them at once as squares have no tail
+    for (int v = 0; v < bang_voices.voices; v++) {
+        if (bang_gate[v] > 0 && --bang_gate[v] == 0) {
+            bb_set(v, 0);
+            va_free(&bang_voices, v);
+        }
+    }
+
+    if (bang_remaining > 0) bang_remaining--;
+
+    // start the next note when the current one ends, waiting for the queue if it has run dry
+    while (bang_remaining <= 0 && !nb_isempty(&note_queue)) {
+        mp_note note = nb_pull(&note_queue);
+        mp_bang_set_note(&note);
+    }
+}
+
+/**
+ * Picks the instrument a MIDI note plays with
+ * @param channel - the channel of the note
+ * @param key - the note number
+ * @return the instrument, or MP_INSTR_NONE for a drum that has no recording
+ */
+static mp_instrument mp_smf_instrument(int channel, int key) {
+
+    // the drum channel picks a drum per key, using the General MIDI kit layout
+    if (channel == MP_SMF_DRUM_CHANNEL) {
+        switch (key) {
+
+            case 35: // acoustic bass drum
+            case 36: // bass drum
+                return MP_INSTR_KICK;
+
+            case 37: // side stick
+            case 38: // acoustic snare
+            case 39: // hand clap
+            case 40: // electric snare
+                return MP_INSTR_SNARE;
+
+            case 42: // closed hi-hat
+            case 44: // pedal hi-hat
+            case 46: // open hi-hat
+                return MP_INSTR_HAT;
+
+            // every other drum has no recording, so it is not played
+            default:
+                return MP_INSTR_NONE;
+        }
+    }
+
+    // the other channels pick an instrument per General MIDI program family of eight
+    switch (pcm_smf_program[channel] >> 3) {
+
+        case 0: // pianos
+        case 1: // chromatic percussion
+            return MP_INSTR_FM;
+
+        case 3: // guitars
+        case 4: // basses
+        case 13: // ethnic plucked strings
+            return MP_INSTR_PLUCK;
+
+        case 10: // synth leads
+        case 11: // synth pads
+            return MP_INSTR_SAW;
+
+        // organs and every other family play on the keys
+        default:
+            return MP_INSTR_KEYS;
+    }
+}
+
+/**
+ * Plays one MIDI event on the mixer voices
+ * @param e - the event to play
+ */
+static void mp_smf_dispatch(smf_event *e) {
+
+    // the allocator tells notes apart by channel and note number
+    int key = (e->channel << 7) | e->key;
+    mp_instrument instrument;
+    int voice;
+
+    switch (e->type) {
+
+        case SMF_NOTE_ON:
+            instrument = mp_smf_instrument(e->channel, e->key);
+            if (instrument == MP_INSTR_NONE) break;
+
+            mp_pcm_sync_voices();
+            voice = va_note_on(&pcm_voices, key, (int) (MIXER_VOICE_GAIN * e->value / 127));
+            if (voice < 0) break;
+            mixer_note_on(voice, instrument, smf_note_frequency(e->key));
+            pcm_gate[voice] = 0;
+            pcm_instrument[voice] = instrument;
+            break;
+
+        case SMF_NOTE_OFF:
+            // drums ring out their recordings once released
+            voice = va_note_off(&pcm_voices, key);
+            if (voice >= 0 && !mp_is_drum(pcm_instrument[voice])) mixer_note_off(voice);
+            break;
+
+        case SMF_PROGRAM:
+            pcm_smf_program[e->channel] = e->key;
+            break;
+
+        // control changes and pitch bends are not played, and smf_next applies tempo changes itself
+        default:
+            break;
+    }
+}
+
+/**
+ * Renders a block of the MIDI file, playing each event on the sample it falls on
+ * @param block - the block of samples to fill
+ * @param n - the number of samples in the block
+ */
+static void mp_render_smf(int16_t *block, int n) {
+
+    while (n > 0 && pcm_smf) {
+
+        // play every event that is due, stopping at the end of the file
+        uint64_t due;
+        while ((due = MP_US_TO_SAMPLES(pcm_smf_event.time_us)) <= pcm_smf_clock) {
+            mp_smf_dispatch(&pcm_smf_event);
+            if (!smf_next(pcm_smf, &pcm_smf_event)) {
+                pcm_smf = 0;
+                break;
+            }
+        }
+
+        // render up to the next event
+        int chunk = n;
+        if (pcm_smf && due - pcm_smf_clock < (uint64_t) chunk) chunk = (int) (due - pcm_smf_clock);
+
+        mixer_render(block, chunk);
+        block += chunk;
+        n -= chunk;
+        pcm_smf_clock += chunk;
+    }
+
+    // keep rendering whatever is still sounding once the file ends
+    if (n > 0) mixer_render(block, n);
+}
+
+/**
+ * Renders a block of the queued notes, sequencing them to the sample
+ * @param block - the block of samples to fill
+ * @param n - the number of samples in the block
+ */
+static void mp_render(int16_t *block, int n) {
+
+    // a MIDI file plays in place of the note queue
+    if (pcm_smf) {
+        mp_render_smf(block, n);
+        return;
+    }
+
+    while (n > 0) {
+
+        // start the next note when the current one ends
+        if (pcm_remaining <= 0) {
+
+            // keep rendering whatever is still sounding once the queue runs dry
+            if (nb_isempty(&note_queue)) {
+                mixer_render(block, n);
+                return;
+            }
+
+            mp_note note = nb_pull(&note_queue);
+            mp_pcm_set_note(&note);
+            continue;
+        }
+
+        // render up to the next voice release or note change
+        int chunk = n < pcm_remaining ? n : pcm_remaining;
+        for (int v = 0; v < MIXER_VOICES; v++) {
+            if (pcm_gate[v] > 0 && pcm_gate[v] < chunk) chunk = pcm_gate[v];
+        }
+
+        mixer_render(block, chunk);
+        block += chunk;
+        n -= chunk;
+        pcm_remaining -= chunk;
+
+        // release the voices whose notes just ended, letting drums and effects ring out
+        for (int v = 0; v < MIXER_VOICES; v++) {
+            if (pcm_gate[v] > 0) {
+                pcm_gate[v] -= chunk;
+                if (pcm_gate[v] == 0) {
+                    va_release(&pcm_voices, v);
+                    if (!mp_is_drum(pcm_instrument[v]) && pcm_instrument[v] != MP_INSTR_SFX) mixer_note_off(v);
+                }
+            }
+        }
+    }
+
+}
+
+/**
+ * Selects the output the music player plays through
+ * Takes effect at the next call to mp_init
+ * @param backend - the output backend
+ */
+void mp_set_backend(mp_backend backend) {
+    mp_stop();
+    active_backend = backend;
+}
+
+/**
+ * Selects which sounding voice the sample backend steals when a note starts and every
+ * mixer voice is busy
+ * Takes effect at the next call to mp_init
+ * @param policy - the voice stealing policy
+ */
+void mp_set_steal_policy(va_policy policy) {
+    pcm_policy = policy;
+}
 
 /**
  * Initializes the internal note buffer
@@ -21,24 +478,100 @@ note_buffer note_queue;
 void mp_init(void) {
     mp_stop(ALL);
     note_queue = nb_init();
+    tm_rewind(&mp_tempo);
+    library_format = SB_FORMAT_SMF;
+
+    // prepare the sample backend
+    if (active_backend == MP_BACKEND_PCM) {
+        pcm_remaining = 0;
+        pcm_smf = 0;
+        for (int v = 0; v < MIXER_VOICES; v++) pcm_gate[v] = 0;
+        va_init(&pcm_voices, MIXER_VOICES, pcm_policy);
+        mixer_init();
+        audio_init(mp_render);
+    }
+
+    // prepare the bit-bang backend with as many voices as the measured cost of a voice allows
+    if (active_backend == MP_BACKEND_BITBANG) {
+        int voices = bb_max_voices(BB_TICK_RATE, SystemCoreClock, MP_BANG_LOAD);
+        bang_remaining = 0;
+        for (int v = 0; v < BB_MAX_VOICES; v++) bang_gate[v] = 0;
+        va_init(&bang_voices, voices, pcm_policy);
+        bb_init(voices, mp_bang_control);
+    }
+}
+
+/**
+ * Sets the tempo that notes with durations in ticks play at
+ * Takes effect at the next note, and starts the song over at the start of the tempo map
+ * @param tempo - the tempo in quarter notes per minute
+ */
+void mp_set_tempo(int tempo) {
+    mp_set_tempo_map(tempo, 0, 0);
+}
+
+/**
+ * Sets the tempo map that notes with durations in ticks play by, such as one read from a song
+ * Takes effect at the next note, and starts the song over at the start of the map
+ * @param tempo - the tempo in quarter notes per minute until the first change
+ * @param changes - the tempo changes, in order of their ticks, which must stay in place
+ * @param count - the number of changes
+ */
+void mp_set_tempo_map(int tempo, const tm_change *changes, int count) {
+
+    // the piezo and bit-bang backends time notes from their interrupts, so change the map with them held off
+    __disable_irq();
+    tm_init(&mp_tempo, tempo, changes, count);
+    __enable_irq();
 }
 
 /**
  * Starts playing the notes currently queued in the internal note buffer
  */
 void mp_play(void) {
+
+    // the sample backend sequences the queue from its render callback
+    if (active_backend == MP_BACKEND_PCM) {
+        audio_start();
+        return;
+    }
+
+    // the bit-bang backend sequences the queue from its control callback
+    if (active_backend == MP_BACKEND_BITBANG) {
+        bb_start();
+        return;
+    }
+
     if (!nb_isempty(&note_queue)) {
         mp_note n = nb_pull(&note_queue);
-        piezo_set(BUZZER0, n.duration, n.frequency);
-        piezo_set(BUZZER1, n.dual_duration, n.dual_frequency);
+        mp_set_note(&n);
         piezo_play(ALL);
     }
 }
 
+/**
+ * Plays a MIDI file through the sample backend in place of the note queue
+ * Call after mp_init with the sample backend selected, from the same context as audio_pump
+ * @param p - the reader of the file, opened with smf_open, which must stay in place while it plays
+ */
+void mp_play_smf(smf_player *p) {
+
+    if (active_backend != MP_BACKEND_PCM) return;
+
+    for (int c = 0; c < MP_SMF_CHANNELS; c++) pcm_smf_program[c] = 0;
+    pcm_smf_clock = 0;
+    pcm_smf = smf_next(p, &pcm_smf_event) ? p : 0;
+
+    audio_start();
+}
+
 /**
  * Stops playing notes
  */
 void mp_stop() {
+    if (active_backend == MP_BACKEND_PCM) audio_stop();
+    if (active_backend == MP_BACKEND_BITBANG) bb_stop();
+    fx_stop(ALL);
     piezo_stop(ALL);
 }
 
@@ -51,9 +584,18 @@ void mp_add_note(mp_note * n) {
     // if there is room in the note queue
     if (!nb_isfull(&note_queue)) {
 
+        mp_instrument instrument = n->instrument;
+        mp_instrument dual_instrument = n->dual_instrument;
+
         // convert the note to keys in case its not already
         mp_conv_to_keys(n);
 
+        // the sample backend plays drums from their recordings, so it keeps the drum instruments
+        if (active_backend == MP_BACKEND_PCM) {
+            if (mp_is_drum(instrument)) n->instrument = instrument;
+            if (mp_is_drum(dual_instrument)) n->dual_instrument = dual_instrument;
+        }
+
         // push the note into the note queue
         nb_push(&note_queue, *n);
 
@@ -72,6 +614,222 @@ void mp_add_song(mp_song * s) {
     }
 }
 
+/**
+ * Reads the next note of an RTTTL song for mp_feed
+ * @param reader - the parser reading the song
+ * @param n - the note to fill
+ * @return one if a note was read, zero at the end of the song
+ */
+static int mp_next_rtttl(void *reader, mp_note *n) {
+    return rtttl_next(reader, n);
+}
+
+/**
+ * Reads the next note of a packed song for mp_feed
+ * @param reader - the reader of the song
+ * @param n - the note to fill
+ * @return one if a note was read, zero at the end of the song
+ */
+static int mp_next_song(void *reader, mp_note *n) {
+    return sb_next(reader, n);
+}
+
+/**
+ * Reads the next note of a compressed song for mp_feed
+ * @param reader - the decoder of the song
+ * @param n - the note to fill
+ * @return one if a note was read, zero at the end of the song
+ */
+static int mp_next_compressed(void *reader, mp_note *n) {
+    return sc_next(reader, n);
+}
+
+/**
+ * Runs a sequence up to its next note for mp_feed
+ * @param reader - the sequencer playing the song
+ * @param n - the note to fill
+ * @return one if a note was played, zero at the end of the song
+ */
+static int mp_next_sequence(void *reader, mp_note *n) {
+    return seq_next(reader, n);
+}
+
+/**
+ * Reads the next note of an ABC tune for mp_feed
+ * @param reader - the parser of the tune
+ * @param n - the note to fill
+ * @return one if a note was read, zero at the end of the tune
+ */
+static int mp_next_abc(void *reader, mp_note *n) {
+    return abc_next(reader, n);
+}
+
+/**
+ * Queues the notes a reader produces as space frees up in the note queue
+ * @param next - reads the next note from the reader, returning zero at the end of the song
+ * @param reader - the reader
+ * @param resolved - whether the notes were already resolved for the note queue, such as by song_dsl.hpp
+ * @return one while the song has notes left to queue, zero once they have all been queued
+ */
+static int mp_feed(int (*next)(void *, mp_note *), void *reader, int resolved) {
+
+    mp_note n;
+
+    // only read a note once there is room for it, so the song resumes where it left off
+    while (!nb_isfull(&note_queue)) {
+
+        if (!next(reader, &n)) return 0;
+
+        // the piezo and bit-bang backends pull notes from their interrupts, so push with them held off
+        __disable_irq();
+        if (resolved) nb_push(&note_queue, n);
+        else mp_add_note(&n);
+        __enable_irq();
+    }
+
+    return 1;
+}
+
+/**
+ * Queues the notes of an RTTTL song as space frees up in the note queue, never holding more
+ * of the song than the queue does
+ * Call repeatedly, such as from the idle loop, until it returns zero
+ * @param p - the parser reading the song, opened with rtttl_open
+ * @return one while the song has notes left to queue, zero once they have all been queued
+ */
+int mp_feed_rtttl(rtttl_parser *p) {
+    return mp_feed(mp_next_rtttl, p, 0);
+}
+
+/**
+ * Queues the notes of a packed song from a song bank as space frees up in the note queue, reading
+ * them in place from flash
+ * Call repeatedly, such as from the idle loop, until it returns zero
+ * @param r - the reader of the song, opened with sb_open
+ * @return one while the song has notes left to queue, zero once they have all been queued
+ */
+int mp_feed_song(sb_reader *r) {
+    return mp_feed(mp_next_song, r, 0);
+}
+
+/**
+ * Queues the notes of a packed song that song_dsl.hpp resolved while the firmware built, as space
+ * frees up in the note queue, without converting them again
+ * Call repeatedly, such as from the idle loop, until it returns zero
+ * @param r - the reader of the song, opened with sb_open
+ * @return one while the song has notes left to queue, zero once they have all been queued
+ */
+int mp_feed_resolved(sb_reader *r) {
+    return mp_feed(mp_next_song, r, 1);
+}
+
+/**
+ * Queues the notes of a compressed song from a song bank as space frees up in the note queue,
+ * decoding them in place from flash
+ * Call repeatedly, such as from the idle loop, until it returns zero
+ * @param d - the decoder of the song, opened with sc_open
+ * @return one while the song has notes left to queue, zero once they have all been queued
+ */
+int mp_feed_compressed(sc_decoder *d) {
+    return mp_feed(mp_next_compressed, d, 0);
+}
+
+/**
+ * Queues the notes of a sequence from a song bank as space frees up in the note queue, running
+ * its patterns and loops in place from flash
+ * Call repeatedly, such as from the idle loop, until it returns zero, which a looping song never does
+ * @param vm - the sequencer playing the song, opened with seq_open
+ * @return one while the song has notes left to queue, zero once they have all been queued
+ */
+int mp_feed_sequence(seq_vm *vm) {
+    return mp_feed(mp_next_sequence, vm, 0);
+}
+
+/**
+ * Queues the notes of an ABC tune as space frees up in the note queue, reading the text in place
+ * Call repeatedly, such as from the idle loop, until it returns zero
+ * @param p - the parser of the tune, opened with abc_open
+ * @return one while the tune has notes left to queue, zero once they have all been queued
+ */
+int mp_feed_abc(abc_parser *p) {
+    return mp_feed(mp_next_abc, p, 0);
+}
+
+/**
+ * Reads the next note of the song mp_play_library started for mp_feed_library
+ * @param reader - unused, the song is in library
+ * @param n - the note to fill
+ * @return one if a note was read, zero at the end of the song
+ */
+static int mp_next_library(void *reader, mp_note *n) {
+
+    (void) reader;
+
+    switch (library_format) {
+        case SB_FORMAT_NOTES:
+            return sb_next(&library.song, n);
+        case SB_FORMAT_COMPRESSED:
+            return sc_next(&library.compressed, n);
+        case SB_FORMAT_SEQUENCE:
+            return seq_next(&library.sequence, n);
+        default:
+            // do nothing if we receive an invalid value
+            return 0;
+    }
+}
+
+/**
+ * Starts playing a song from the linked song banks by its id, found through the bank's index in
+ * constant time, at the tempo the index gives for it
+ * MIDI files play through the sample backend, so it must be selected for them
+ * @param id - the id of the song
+ * @return one if the song started, zero if there is no such song or it cannot be played
+ */
+int mp_play_library(int id) {
+
+    sb_song song;
+
+    if (!sb_find_id(id, &song)) return 0;
+
+    mp_init();
+    mp_set_tempo(song.tempo ? song.tempo : MP_TEMPO);
+
+    switch (song.format) {
+        case SB_FORMAT_NOTES:
+            sb_open(&library.song, &song);
+            break;
+        case SB_FORMAT_COMPRESSED:
+            if (!sc_open(&library.compressed, &song)) return 0;
+            break;
+        case SB_FORMAT_SEQUENCE:
+            if (!seq_open(&library.sequence, &song)) return 0;
+            break;
+        case SB_FORMAT_SMF:
+            if (active_backend != MP_BACKEND_PCM || !smf_open(&library.smf, song.data, song.length)) return 0;
+            mp_play_smf(&library.smf);
+            return 1;
+        default:
+            // do nothing if we receive an invalid value
+            return 0;
+    }
+
+    // fill the queue before starting, so the first notes are ready when the timers fire
+    library_format = song.format;
+    mp_feed(mp_next_library, 0, 0);
+    mp_play();
+
+    return 1;
+}
+
+/**
+ * Queues more of the song mp_play_library started as space frees up in the note queue
+ * Call repeatedly, such as from the idle loop, until it returns zero
+ * @return one while the song has notes left to queue, zero once they have all been queued
+ */
+int mp_feed_library(void) {
+    return library_format != SB_FORMAT_SMF && mp_feed(mp_next_library, 0, 0);
+}
+
 /**
  * Clears all notes from the note queue
  */
@@ -81,6 +839,7 @@ void mp_clear(void) {
 
 /**
  * Converts a non-keys note to a keys note
+ * Drums take their preset length, in ticks if their part is in ticks and in ms otherwise
  * @param n - the note to convert
  * @return the converted note
  */
@@ -92,7 +851,7 @@ void mp_conv_to_keys(mp_note * n) {
         case MP_INSTR_HAT:
             n->instrument = MP_INSTR_KEYS;
             n->frequency = MP_INSTR_HAT_FREQ;
-            n->duration = MP_INSTR_HAT_DURATION;
+            n->duration = TM_IS_TICKS(n->duration) ? MP_INSTR_HAT_TICKS : MP_INSTR_HAT_DURATION;
             break;
 
         case MP_INSTR_KEYS:
@@ -102,7 +861,7 @@ void mp_conv_to_keys(mp_note * n) {
         case MP_INSTR_KICK:
             n->instrument = MP_INSTR_KEYS;
             n->frequency = MP_INSTR_KICK_FREQ;
-            n->duration = MP_INSTR_KICK_DURATION;
+            n->duration = TM_IS_TICKS(n->duration) ? MP_INSTR_KICK_TICKS : MP_INSTR_KICK_DURATION;
             break;
 
         case MP_INSTR_REST:
@@ -110,10 +869,22 @@ void mp_conv_to_keys(mp_note * n) {
             n->frequency = MP_INSTR_REST_FREQ;
             break;
 
+        case MP_INSTR_FM:
+        case MP_INSTR_PLUCK:
+        case MP_INSTR_SAW:
+            // sample backend instruments keep their pitch and play as keys on the piezos
+            break;
+
+        case MP_INSTR_SFX:
+            // sound effects keep their preset and last as long as their envelope
+            if (sfx_preset(n->frequency)) n->duration = sfx_duration(sfx_preset(n->frequency));
+            else n->duration = 0;
+            break;
+
         case MP_INSTR_SNARE:
             n->instrument = MP_INSTR_KEYS;
             n->frequency = MP_INSTR_SNARE_FREQ;
-            n->duration = MP_INSTR_SNARE_DURATION;
+            n->duration = TM_IS_TICKS(n->duration) ? MP_INSTR_SNARE_TICKS : MP_INSTR_SNARE_DURATION;
             break;
 
         default:
@@ -129,7 +900,7 @@ void mp_conv_to_keys(mp_note * n) {
         case MP_INSTR_HAT:
             n->dual_instrument = MP_INSTR_KEYS;
             n->dual_frequency = MP_INSTR_HAT_FREQ;
-            n->dual_duration = MP_INSTR_HAT_DURATION;
+            n->dual_duration = TM_IS_TICKS(n->dual_duration) ? MP_INSTR_HAT_TICKS : MP_INSTR_HAT_DURATION;
             break;
 
         case MP_INSTR_KEYS:
@@ -139,7 +910,7 @@ void mp_conv_to_keys(mp_note * n) {
         case MP_INSTR_KICK:
             n->dual_instrument = MP_INSTR_KEYS;
             n->dual_frequency = MP_INSTR_KICK_FREQ;
-            n->dual_duration = MP_INSTR_KICK_DURATION;
+            n->dual_duration = TM_IS_TICKS(n->dual_duration) ? MP_INSTR_KICK_TICKS : MP_INSTR_KICK_DURATION;
             break;
 
         case MP_INSTR_REST:
@@ -147,10 +918,22 @@ void mp_conv_to_keys(mp_note * n) {
             n->dual_frequency = MP_INSTR_REST_FREQ;
             break;
 
+        case MP_INSTR_FM:
+        case MP_INSTR_PLUCK:
+        case MP_INSTR_SAW:
+            // sample backend instruments keep their pitch and play as keys on the piezos
+            break;
+
+        case MP_INSTR_SFX:
+            // sound effects keep their preset and last as long as their envelope
+            if (sfx_preset(n->dual_frequency)) n->dual_duration = sfx_duration(sfx_preset(n->dual_frequency));
+            else n->dual_duration = 0;
+            break;
+
         case MP_INSTR_SNARE:
             n->dual_instrument = MP_INSTR_KEYS;
             n->dual_frequency = MP_INSTR_SNARE_FREQ;
-            n->dual_duration = MP_INSTR_SNARE_DURATION;
+            n->dual_duration = TM_IS_TICKS(n->dual_duration) ? MP_INSTR_SNARE_TICKS : MP_INSTR_SNARE_DURATION;
             break;
 
         default:
@@ -174,8 +957,7 @@ void TIM2_IRQHandler(void) {
         mp_note n = nb_pull(&note_queue);
 
         // set the next note
-        piezo_set(BUZZER0, n.duration, n.frequency);
-        piezo_set(BUZZER1, n.dual_duration, n.dual_frequency);
+        mp_set_note(&n);
 
         // restart BUZZER1 because it has stopped
         piezo_play(BUZZER1);
@@ -201,8 +983,7 @@ void TIM5_IRQHandler(void) {
         mp_note n = nb_pull(&note_queue);
 
         // set the next note
-        piezo_set(BUZZER0, n.duration, n.frequency);
-        piezo_set(BUZZER1, n.dual_duration, n.dual_frequency);
+        mp_set_note(&n);
 
         // restart BUZZER0 because it has stopped
         piezo_play(BUZZER0);
@@ -68,6 +68,15 @@ mp_note nb_pull(note_buffer *nb) {
     return n;
 }
 
+/**
+ * Returns the next element of the note buffer without pulling it
+ * @param nb - the note buffer to peek into
+ * @return a pointer to the next note, or NULL if the buffer is empty
+ */
+mp_note * nb_peek(note_buffer *nb) {
+    return nb->isempty ? NULL : &(nb->buffer[nb->puller]);
+}
+
 /**
  * Clears all values from the note buffer
  * @param nb - the note buffer to clear
@@ -0,0 +1,224 @@
+/**
+ * @file pcm_stream.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief plays PCM streamed over USART2, resampling to track the sender's clock
+ */
+
+# include "pcm_stream.h"
+# include "uart_driver.h"
+# include "audio_driver.h"
+# include "adpcm.h"
+
+# define STREAM_PPM 4295 // one part per million of the Q32 step
+# define STREAM_MAX_ADJUST (STREAM_MAX_DRIFT_PPM * STREAM_PPM)
+# define STREAM_ERROR_SHIFT 5 // fill error smoothing, about 32 blocks
+# define STREAM_KP (8 * STREAM_PPM) // step trim per sample of smoothed fill error, about 8 s to settle
+# define STREAM_KI_SHIFT 6 // integral gain, critically damping the loop
+
+/**
+ * The format being received and the decoder state for ADPCM streams
+ */
+static stream_format stream_mode = STREAM_PCM_U8;
+static adpcm_decoder stream_decoder;
+static int stream_nibble = -1; // the undecoded high nibble of the last ADPCM byte, or -1
+
+/**
+ * Resampler state
+ * The output sits a fraction (the low 32 bits of the phase) of the way from s0 to s1, and
+ * advances by one input sample plus the trim per output sample
+ */
+static int stream_playing = 0;
+static uint64_t stream_phase = 0;
+static int32_t stream_s0 = 0;
+static int32_t stream_s1 = 0;
+static int32_t stream_adjust = 0;
+
+/**
+ * Fill control loop state
+ */
+static int32_t stream_error = 0;     // smoothed fill error in Q8 samples
+static int64_t stream_integral = 0;  // accumulated trim
+
+static stream_stats stream_counters;
+static uint32_t stream_overruns_seen = 0;
+
+/**
+ * Counts the samples waiting in the UART ring
+ * @return the number of samples ready to decode
+ */
+static uint32_t stream_fill(void) {
+
+    uint32_t bytes = uart_available();
+
+    // a lapped ring has lost bytes, so the ADPCM decoder must resynchronize from silence
+    if (uart_overruns() != stream_overruns_seen) {
+        stream_overruns_seen = uart_overruns();
+        adpcm_reset(&stream_decoder);
+        stream_nibble = -1;
+    }
+
+    if (stream_mode == STREAM_ADPCM) return 2 * bytes + (stream_nibble >= 0);
+    return bytes;
+}
+
+/**
+ * Decodes the next sample from the UART ring
+ * Only call once stream_fill has reported the sample is ready
+ * @return the sample as a signed 16-bit value
+ */
+static int32_t stream_next(void) {
+
+    if (stream_mode == STREAM_ADPCM) {
+
+        int code;
+
+        // each byte holds two codes, low nibble first
+        if (stream_nibble >= 0) {
+            code = stream_nibble;
+            stream_nibble = -1;
+        } else {
+            uint8_t byte = uart_read();
+            code = byte & 0x0F;
+            stream_nibble = byte >> 4;
+        }
+
+        return adpcm_decode(&stream_decoder, code);
+    }
+
+    return ((int32_t) uart_read() - 128) << 8;
+}
+
+/**
+ * Trims the playback rate so the fill converges on its target
+ * @param fill - the samples currently buffered
+ */
+static void stream_trim(uint32_t fill) {
+
+    int32_t error = ((int32_t) fill - STREAM_TARGET_FILL) << 8;
+
+    // smooth out the burstiness of the sender before steering on it
+    stream_error += (error - stream_error) >> STREAM_ERROR_SHIFT;
+
+    // the integral learns the steady drift, the proportional term pulls the fill back to target
+    stream_integral += stream_error;
+    int64_t adjust = (((int64_t) stream_error * STREAM_KP) >> 8) + (stream_integral >> STREAM_KI_SHIFT);
+
+    // hold the integral back once the trim saturates so it recovers quickly
+    if (adjust > STREAM_MAX_ADJUST) {
+        adjust = STREAM_MAX_ADJUST;
+        stream_integral -= stream_error;
+    } else if (adjust < -STREAM_MAX_ADJUST) {
+        adjust = -STREAM_MAX_ADJUST;
+        stream_integral -= stream_error;
+    }
+
+    stream_adjust = (int32_t) adjust;
+}
+
+/**
+ * Renders a block of the stream, buffering silence until enough of it has arrived
+ * @param block - the block of samples to fill
+ * @param n - the number of samples in the block
+ */
+static void stream_render(int16_t *block, int n) {
+
+    uint32_t fill = stream_fill();
+    int i = 0;
+
+    // wait for the buffer to reach its target before playing so it can absorb jitter
+    if (!stream_playing) {
+
+        if (fill < STREAM_TARGET_FILL) {
+            for (; i < n; i++) block[i] = 0;
+            return;
+        }
+
+        stream_s0 = stream_next();
+        stream_s1 = stream_next();
+        stream_phase = 0;
+        fill -= 2;
+        stream_playing = 1;
+    }
+
+    stream_trim(fill);
+    uint64_t step = (1ULL << 32) + (int64_t) stream_adjust;
+
+    for (; i < n; i++) {
+
+        // interpolate linearly between the two input samples around the output
+        int32_t frac = (int32_t) ((uint32_t) stream_phase >> 17);
+        block[i] = (int16_t) (stream_s0 + (((stream_s1 - stream_s0) * frac) >> 15));
+
+        // step forward, pulling in however many input samples the step crossed
+        stream_phase += step;
+        uint32_t crossed = (uint32_t) (stream_phase >> 32);
+        stream_phase &= 0xFFFFFFFFULL;
+
+        while (crossed--) {
+
+            // the buffer ran dry, so play silence and start buffering again
+            if (fill == 0) {
+                stream_counters.underruns++;
+                stream_playing = 0;
+                for (i++; i < n; i++) block[i] = 0;
+                return;
+            }
+
+            stream_s0 = stream_s1;
+            stream_s1 = stream_next();
+            fill--;
+        }
+    }
+
+}
+
+/**
+ * Starts receiving and playing a stream through the PWM audio output
+ * audio_pump must be called from the idle loop while the stream plays
+ * @param format - the format the sender streams in
+ */
+void stream_start(stream_format format) {
+
+    stream_mode = format;
+    adpcm_reset(&stream_decoder);
+    stream_nibble = -1;
+
+    stream_playing = 0;
+    stream_adjust = 0;
+    stream_error = 0;
+    stream_integral = 0;
+    stream_counters.underruns = 0;
+    stream_overruns_seen = 0;
+
+    uart_init(STREAM_BAUD);
+    audio_init(stream_render);
+    audio_start();
+}
+
+/**
+ * Stops receiving and playing the stream
+ */
+void stream_stop(void) {
+    audio_stop();
+    uart_stop();
+    stream_playing = 0;
+}
+
+/**
+ * Reads the stream counters
+ * @param stats - the counters to fill
+ */
+void stream_get_stats(stream_stats *stats) {
+
+    uint32_t fill = stream_fill();
+    uint32_t queued = audio_deadline();
+
+    stream_counters.overruns = uart_overruns();
+    stream_counters.fill = fill;
+    stream_counters.latency = fill + (queued == UINT32_MAX ? 0 : queued);
+    stream_counters.drift_ppm = stream_adjust / STREAM_PPM;
+
+    *stats = stream_counters;
+}
@@ -0,0 +1,347 @@
+/**
+ * @file pitch_fx.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief control-rate pitch effects (vibrato, portamento, and bends) for the piezo buzzers
+ */
+
+# include "pitch_fx.h"
+
+# define FX_VOICES 2
+# define FX_RATIO_SHIFT 15
+# define FX_RATIO_HALF (1 << (FX_RATIO_SHIFT - 1))
+# define FX_PHASE_MASK 0xFFFF
+# define FX_LFO_SIZE 64
+# define FX_LFO_INDEX_SHIFT 10
+# define FX_LFO_AMPLITUDE_SHIFT 7
+# define FX_MAX_OCTAVES 16
+# define FX_MAX_PERIOD 0xFFFF
+
+/**
+ * Tone period ratios for each step of an octave, 2^(-step / 192) in Q15
+ */
+static const unsigned short FX_RATIOS[FX_STEPS_PER_OCTAVE] = {
+        32768, 32650, 32532, 32415, 32298, 32182, 32066, 31950, 31835, 31720, 31606, 31492,
+        31379, 31266, 31153, 31041, 30929, 30817, 30706, 30596, 30485, 30376, 30266, 30157,
+        30048, 29940, 29832, 29725, 29618, 29511, 29405, 29299, 29193, 29088, 28983, 28879,
+        28774, 28671, 28567, 28464, 28362, 28260, 28158, 28056, 27955, 27855, 27754, 27654,
+        27554, 27455, 27356, 27258, 27159, 27062, 26964, 26867, 26770, 26674, 26577, 26482,
+        26386, 26291, 26196, 26102, 26008, 25914, 25821, 25728, 25635, 25543, 25451, 25359,
+        25268, 25177, 25086, 24995, 24905, 24816, 24726, 24637, 24548, 24460, 24372, 24284,
+        24196, 24109, 24022, 23936, 23849, 23763, 23678, 23593, 23507, 23423, 23338, 23254,
+        23170, 23087, 23004, 22921, 22838, 22756, 22674, 22592, 22511, 22430, 22349, 22268,
+        22188, 22108, 22028, 21949, 21870, 21791, 21713, 21634, 21556, 21479, 21401, 21324,
+        21247, 21171, 21095, 21019, 20943, 20867, 20792, 20717, 20643, 20568, 20494, 20420,
+        20347, 20273, 20200, 20127, 20055, 19983, 19911, 19839, 19767, 19696, 19625, 19554,
+        19484, 19414, 19344, 19274, 19205, 19135, 19066, 18998, 18929, 18861, 18793, 18725,
+        18658, 18591, 18524, 18457, 18390, 18324, 18258, 18192, 18127, 18061, 17996, 17931,
+        17867, 17802, 17738, 17674, 17611, 17547, 17484, 17421, 17358, 17296, 17233, 17171,
+        17109, 17048, 16986, 16925, 16864, 16803, 16743, 16682, 16622, 16562, 16503, 16443
+};
+
+/**
+ * One cycle of the vibrato LFO, sin(2 * pi * i / 64) in Q7
+ */
+static const signed char FX_LFO[FX_LFO_SIZE] = {
+           0,   12,   25,   37,   49,   60,   71,   81,   90,   98,  106,  112,  117,  122,  125,  126,
+         127,  126,  125,  122,  117,  112,  106,   98,   90,   81,   71,   60,   49,   37,   25,   12,
+           0,  -12,  -25,  -37,  -49,  -60,  -71,  -81,  -90,  -98, -106, -112, -117, -122, -125, -126,
+        -127, -126, -125, -122, -117, -112, -106,  -98,  -90,  -81,  -71,  -60,  -49,  -37,  -25,  -12
+};
+
+/**
+ * Pitch effect state of a buzzer
+ */
+typedef struct {
+    volatile mp_fx_type type;
+    int period;             // unmodulated tone period of the note
+    int frequency;          // unmodulated frequency of the note
+    int target;             // target frequency or pitch offset in steps
+    int depth;              // vibrato depth in steps
+    unsigned int phase;     // vibrato LFO phase
+    unsigned int phase_inc; // vibrato LFO phase increment per tick
+    int elapsed;            // ticks since the start of the ramp
+    int ramp;               // length of the ramp in ticks
+    int current;            // tone period last written to the buzzer
+} fx_voice;
+
+/**
+ * The pitch effect state of each buzzer
+ */
+static fx_voice fx_voices[FX_VOICES];
+
+/**
+ * The sound effect playing on each buzzer, idle while its parameters are zero
+ */
+static sfx_state fx_sfx[FX_VOICES];
+
+/**
+ * Advances the sound effect of a buzzer by one control tick
+ * @param s - the sound effect to advance
+ * @return the tone period for this tick, or zero once the effect is silent
+ */
+static int fx_sfx_tick(sfx_state *s) {
+
+    int noise = s->params->noise;
+
+    if (!sfx_tick(s) || s->level == 0) return 0;
+
+    int period = piezo_period(s->frequency);
+
+    // the buzzers cannot play noise, so hop to a random pitch within an octave each tick
+    if (noise) return fx_scale(period, (int) (sfx_noise() % (2 * FX_STEPS_PER_OCTAVE)) - FX_STEPS_PER_OCTAVE);
+
+    return period;
+}
+
+/**
+ * Starts the pitch effect of a note on a buzzer
+ * @param buzzer - the buzzer the note is playing on
+ * @param fx - the pitch effect of the note
+ * @param duration - the duration of the note in ms
+ * @param frequency - the frequency of the note
+ * @param next_frequency - the frequency of the following note, or zero if there is none
+ */
+void fx_start(piezo_buzzer buzzer, mp_fx fx, int duration, int frequency, int next_frequency) {
+
+    // only individual buzzers carry effects
+    if (buzzer != BUZZER0 && buzzer != BUZZER1) return;
+
+    fx_voice *v = &fx_voices[buzzer];
+
+    // disable the voice while its parameters change
+    v->type = MP_FX_NONE;
+    fx_sfx[buzzer].params = 0;
+
+    // rests cannot be modulated
+    if (frequency <= 0) return;
+
+    v->period = piezo_period(frequency);
+    v->frequency = frequency;
+    v->current = v->period;
+    v->elapsed = 0;
+    v->phase = 0;
+
+    // precompute everything the control tick needs so it never has to derive it
+    switch (fx.type) {
+
+        case MP_FX_VIBRATO:
+            v->depth = fx.depth;
+            v->phase_inc = ((unsigned int) fx.rate << 16) / (10 * FX_TICK_FREQ);
+            if (v->depth == 0 || v->phase_inc == 0) return;
+            break;
+
+        case MP_FX_PORTA_LINEAR:
+            // glide linearly in frequency to the next note over the whole note
+            if (next_frequency <= 0 || duration <= 0) return;
+            v->target = next_frequency;
+            v->ramp = duration;
+            break;
+
+        case MP_FX_PORTA_EXP:
+            // glide linearly in pitch to the next note over the whole note
+            if (next_frequency <= 0 || duration <= 0) return;
+            v->target = fx_interval(v->period, piezo_period(next_frequency));
+            v->ramp = duration;
+            break;
+
+        case MP_FX_BEND:
+            // bend by the effect depth over the effect time
+            if (fx.depth == 0) return;
+            v->target = fx.depth;
+            v->ramp = fx.rate > 0 ? fx.rate : 1;
+            break;
+
+        default:
+            // no effect
+            return;
+    }
+
+    // enable the voice once its parameters are valid
+    v->type = fx.type;
+}
+
+/**
+ * Starts a sound effect on a buzzer, which drives its pitch until the effect ends
+ * The buzzer plays the frequency and envelope gate of the effect, since it has no duty or level
+ * @param buzzer - the buzzer the effect is playing on
+ * @param params - the effect to play
+ */
+void fx_start_sfx(piezo_buzzer buzzer, const sfx_params *params) {
+
+    // only individual buzzers carry effects
+    if (buzzer != BUZZER0 && buzzer != BUZZER1) return;
+
+    // the effect replaces any pitch effect on the buzzer
+    fx_voices[buzzer].type = MP_FX_NONE;
+    fx_sfx[buzzer].params = 0;
+
+    if (!params) return;
+
+    // the first tick is loaded by the caller with the starting frequency of the effect
+    sfx_start(&fx_sfx[buzzer], params);
+    fx_voices[buzzer].current = piezo_period(fx_sfx[buzzer].frequency);
+}
+
+/**
+ * Stops the pitch effects of a buzzer
+ * @param buzzer - the buzzer to stop the effects of
+ */
+void fx_stop(piezo_buzzer buzzer) {
+
+    // switch on buzzer to disable its voice
+    switch (buzzer) {
+
+        case BUZZER0:
+        case BUZZER1:
+            fx_voices[buzzer].type = MP_FX_NONE;
+            fx_sfx[buzzer].params = 0;
+            break;
+
+        case ALL:
+            fx_voices[BUZZER0].type = MP_FX_NONE;
+            fx_voices[BUZZER1].type = MP_FX_NONE;
+            fx_sfx[BUZZER0].params = 0;
+            fx_sfx[BUZZER1].params = 0;
+            break;
+
+        default:
+            // do nothing if we receive an invalid value
+            break;
+    }
+
+}
+
+/**
+ * Advances all running pitch effects by one control tick
+ * Must be called at FX_TICK_FREQ
+ */
+void fx_tick(void) {
+
+    for (int i = 0; i < FX_VOICES; i++) {
+
+        fx_voice *v = &fx_voices[i];
+        int period;
+
+        // sound effects drive the buzzer on their own
+        if (fx_sfx[i].params) {
+            period = fx_sfx_tick(&fx_sfx[i]);
+            if (period != v->current) {
+                v->current = period;
+                piezo_set_period((piezo_buzzer) i, period);
+            }
+            continue;
+        }
+
+        // switch on the effect to compute the period for this tick
+        switch (v->type) {
+
+            case MP_FX_VIBRATO:
+                v->phase = (v->phase + v->phase_inc) & FX_PHASE_MASK;
+                period = fx_scale(v->period,
+                                  (FX_LFO[v->phase >> FX_LFO_INDEX_SHIFT] * v->depth) >> FX_LFO_AMPLITUDE_SHIFT);
+                break;
+
+            case MP_FX_PORTA_LINEAR:
+                v->elapsed++;
+                period = piezo_period(v->frequency + (v->target - v->frequency) * v->elapsed / v->ramp);
+                break;
+
+            case MP_FX_PORTA_EXP:
+            case MP_FX_BEND:
+                v->elapsed++;
+                period = fx_scale(v->period, v->target * v->elapsed / v->ramp);
+                break;
+
+            default:
+                // skip idle voices
+                continue;
+        }
+
+        // ramps hold their final pitch once they finish
+        if ((v->type != MP_FX_VIBRATO) && (v->elapsed >= v->ramp)) v->type = MP_FX_NONE;
+
+        // only touch the timer when the period actually changes
+        if (period != v->current) {
+            v->current = period;
+            piezo_set_period((piezo_buzzer) i, period);
+        }
+    }
+
+}
+
+/**
+ * Scales a tone period by a pitch offset
+ * @param period - the tone period to scale
+ * @param steps - the pitch offset in sixteenths of a semitone, positive is higher
+ * @return the scaled tone period
+ */
+int fx_scale(int period, int steps) {
+
+    // split the offset into whole octaves (rounding down) and a step within the octave
+    int octaves = steps >= 0 ? steps / FX_STEPS_PER_OCTAVE
+                             : -((FX_STEPS_PER_OCTAVE - 1 - steps) / FX_STEPS_PER_OCTAVE);
+    int step = steps - octaves * FX_STEPS_PER_OCTAVE;
+
+    // scale within the octave using the ratio table
+    unsigned int scaled = ((unsigned int) period * FX_RATIOS[step]) >> FX_RATIO_SHIFT;
+
+    // each octave up halves the period
+    if (octaves >= 0) {
+        return octaves >= FX_MAX_OCTAVES ? 0 : (int) (scaled >> octaves);
+    }
+
+    // each octave down doubles the period
+    octaves = -octaves;
+    if (octaves >= FX_MAX_OCTAVES || scaled > (unsigned int) (FX_MAX_PERIOD >> octaves)) return FX_MAX_PERIOD;
+    return (int) (scaled << octaves);
+}
+
+/**
+ * Measures the interval between two tone periods
+ * @param from - the starting tone period
+ * @param to - the ending tone period
+ * @return the interval in sixteenths of a semitone, positive is higher
+ */
+int fx_interval(int from, int to) {
+
+    // there is no interval to or from a rest
+    if (from <= 0 || to <= 0) return 0;
+
+    unsigned int a = from;
+    unsigned int b = to;
+    int octaves = 0;
+
+    // normalize so that b <= a < 2b, counting the octaves removed
+    while (a >= 2 * b) {
+        b <<= 1;
+        octaves++;
+    }
+    while (a < b) {
+        a <<= 1;
+        octaves--;
+    }
+
+    // the remaining ratio lies in (0.5, 1]
+    int ratio = (int) ((b << FX_RATIO_SHIFT) / a);
+
+    // binary search the descending ratio table for the first step at or below the ratio
+    int lo = 0;
+    int hi = FX_STEPS_PER_OCTAVE - 1;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (FX_RATIOS[mid] > ratio) lo = mid + 1;
+        else hi = mid;
+    }
+
+    // round to the nearest step, which may be the start of the next octave
+    if (lo > 0 && FX_RATIOS[lo - 1] - ratio < ratio - FX_RATIOS[lo]) {
+        lo--;
+    } else if (FX_RATIOS[lo] > ratio && FX_RATIOS[lo] - ratio > ratio - FX_RATIO_HALF) {
+        lo = 0;
+        octaves++;
+    }
+
+    return octaves * FX_STEPS_PER_OCTAVE + lo;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file pluck_voice.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a Karplus-Strong plucked string voice with delay lines in a fixed SRAM pool
+ */
+
+# include "pluck_voice.h"
+# include "audio_driver.h"
+
+# define KS_DECAY 32604 // loop gain per period in Q15, about 0.995
+# define KS_NOISE_AMPLITUDE 16384
+# define KS_ONE_Q16 65536
+# define KS_FILTER_DELAY_Q16 (KS_ONE_Q16 / 2) // the averaging filter shortens the loop by half a sample
+# define KS_MIN_FRAC_Q16 (KS_ONE_Q16 / 10) // keeps the all-pass delay within its accurate range
+
+/**
+ * The delay line pool, one full-length line per voice
+ */
+static int16_t ks_pool[KS_VOICES][KS_MAX_DELAY];
+
+/**
+ * The noise generator state used to excite the strings
+ */
+static uint32_t ks_noise = 0x2545F491;
+
+/**
+ * Plucks a string, filling its delay line with noise
+ * @param v - the voice to pluck
+ * @param slot - the delay line pool slot the voice uses, below KS_VOICES
+ * @param frequency - the frequency in Q16.16 Hz
+ */
+void ks_start(ks_voice *v, int slot, uint32_t frequency) {
+
+    if (slot < 0 || slot >= KS_VOICES || frequency == 0) {
+        v->line = 0;
+        return;
+    }
+
+    // the loop period in Q16 samples, plus the half sample the averaging filter takes off
+    uint32_t period = (uint32_t) (((uint64_t) AUDIO_RATE << 32) / frequency) + KS_FILTER_DELAY_Q16;
+
+    // split the period into a whole delay line and a fractional all-pass delay
+    int length = (int) ((period - KS_MIN_FRAC_Q16) >> 16);
+    if (length < 2) length = 2;
+    if (length > KS_MAX_DELAY) length = KS_MAX_DELAY;
+    int32_t frac = (int32_t) period - (length << 16);
+    if (frac < 0) frac = 0;
+    if (frac > KS_ONE_Q16) frac = KS_ONE_Q16;
+
+    v->line = ks_pool[slot];
+    v->length = length;
+    v->position = 0;
+    v->coef = (int32_t) (((int64_t) (KS_ONE_Q16 - frac) << 15) / (KS_ONE_Q16 + frac));
+    v->ap_in = 0;
+    v->ap_out = 0;
+
+    // excite the string with a burst of white noise
+    for (int i = 0; i < length; i++) {
+        ks_noise = ks_noise * 1664525 + 1013904223;
+        v->line[i] = (int16_t) ((((int32_t) (ks_noise >> 16) - 32768) * KS_NOISE_AMPLITUDE) >> 15);
+    }
+}
+
+/**
+ * Renders a plucked string, adding it onto a mix
+ * The cost per sample is the same at every pitch
+ * @param v - the voice to render
+ * @param mix - the mix to add the samples to
+ * @param n - the number of samples to render
+ * @param amplitude - the amplitude in Q15
+ */
+void ks_render(ks_voice *v, int32_t *mix, int n, int32_t amplitude) {
+
+    if (!v->line) return;
+
+    int16_t *line = v->line;
+    int length = v->length;
+    int position = v->position;
+    int32_t coef = v->coef;
+    int32_t ap_in = v->ap_in;
+    int32_t ap_out = v->ap_out;
+
+    for (int i = 0; i < n; i++) {
+
+        int next = position + 1 == length ? 0 : position + 1;
+        int32_t out = line[position];
+
+        // average the two oldest samples and apply the loop loss in one multiply, rounding
+        // towards zero so a small DC offset cannot sustain itself in the loop
+        int32_t filtered = ((out + line[next]) * KS_DECAY) / (1 << 16);
+
+        // a first-order all-pass supplies the fractional part of the delay
+        ap_out = ((coef * (filtered - ap_out)) >> 15) + ap_in;
+        ap_in = filtered;
+
+        line[position] = (int16_t) ap_out;
+        position = next;
+
+        mix[i] += (out * amplitude) >> 15;
+    }
+
+    v->position = position;
+    v->ap_in = ap_in;
+    v->ap_out = ap_out;
+}
@@ -0,0 +1,228 @@
+/**
+ * @file resampler.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a sample playback voice that resamples one recording to any pitch
+ */
+
+# include <string.h>
+# include <stm32f446xx.h>
+# include "resampler.h"
+# include "sine_table.h"
+# include "cycle_counter.h"
+# include "audio_driver.h"
+
+# define RS_ONE (1 << 14) // interpolation weights are Q14 so a pair of them packs into one word
+# define RS_BENCH_SAMPLES 256
+# define RS_BENCH_PITCH 0x15EB8 // 1.37 Hz against a 1 Hz root, so every output lands between samples
+
+/**
+ * The recording rs_cycles_per_sample plays, one looped cycle of the sine table
+ */
+static const rs_sample RS_BENCH = {
+        .data = SINE_Q15 + 1,
+        .length = SINE_SIZE - 3,
+        .loop_start = 0,
+        .loop_length = SINE_SIZE - 3,
+        .root = 1 << 16,
+        .rate = AUDIO_RATE
+};
+
+/**
+ * Loads two neighbouring samples as one word, the first in the low half
+ * @param x - the first sample, which need not be word aligned
+ * @return the packed pair
+ */
+static inline uint32_t rs_pair(const int16_t *x) {
+    uint32_t pair;
+    memcpy(&pair, x, sizeof(pair));
+    return pair;
+}
+
+/**
+ * Interpolates linearly between the two samples around a position
+ * @param data - the recording
+ * @param phase - the position in 16.16 samples
+ * @return the sample at the position
+ */
+static inline int32_t rs_linear(const int16_t *data, uint32_t phase) {
+
+    int32_t f = (int32_t) ((phase & 0xFFFF) >> 2);
+
+    // both taps in one dual multiply-accumulate
+    return (int32_t) __SMUAD(rs_pair(data + (phase >> 16)), __PKHBT(RS_ONE - f, f, 16)) >> 14;
+}
+
+/**
+ * Interpolates a Catmull-Rom (4-point Hermite) curve through the four samples around a position
+ * @param data - the recording
+ * @param phase - the position in 16.16 samples
+ * @return the sample at the position
+ */
+static inline int32_t rs_hermite(const int16_t *data, uint32_t phase) {
+
+    const int16_t *x = data + (phase >> 16);
+    int32_t f = (int32_t) ((phase & 0xFFFF) >> 2);
+    int32_t f2 = (f * f) >> 14;
+    int32_t f3 = (f2 * f) >> 14;
+
+    // the cubic's weight on each of x[-1], x[0], x[1] and x[2], summing to one
+    int32_t wm1 = (-f3 + 2 * f2 - f) >> 1;
+    int32_t w0 = (3 * f3 - 5 * f2 + 2 * RS_ONE) >> 1;
+    int32_t w1 = (-3 * f3 + 4 * f2 + f) >> 1;
+    int32_t w2 = (f3 - f2) >> 1;
+
+    // two taps per dual multiply-accumulate
+    uint32_t acc = __SMUAD(rs_pair(x + 1), __PKHBT(w1, w2, 16));
+    return (int32_t) __SMLAD(rs_pair(x - 1), __PKHBT(wm1, w0, 16), acc) >> 14;
+}
+
+/**
+ * Renders a run that stays inside the recording, two samples per pass
+ * @param v - the voice to render
+ * @param mix - the mix to add the samples to
+ * @param n - the number of samples to render
+ * @param amplitude - the amplitude in Q15
+ */
+static void rs_render_run(rs_voice *v, int32_t *mix, int n, int32_t amplitude) {
+
+    const int16_t *data = v->sample->data;
+    uint32_t phase = v->phase;
+    uint32_t step = v->step;
+    int32_t a, b;
+
+    switch (v->interp) {
+
+        case RS_NEAREST:
+            for (; n >= 2; n -= 2) {
+                a = data[(phase + 0x8000) >> 16];
+                b = data[(phase + step + 0x8000) >> 16];
+                phase += 2 * step;
+                *mix++ += (a * amplitude) >> 15;
+                *mix++ += (b * amplitude) >> 15;
+            }
+            if (n) {
+                *mix += (data[(phase + 0x8000) >> 16] * amplitude) >> 15;
+                phase += step;
+            }
+            break;
+
+        case RS_LINEAR:
+            for (; n >= 2; n -= 2) {
+                a = rs_linear(data, phase);
+                b = rs_linear(data, phase + step);
+                phase += 2 * step;
+                *mix++ += (a * amplitude) >> 15;
+                *mix++ += (b * amplitude) >> 15;
+            }
+            if (n) {
+                *mix += (rs_linear(data, phase) * amplitude) >> 15;
+                phase += step;
+            }
+            break;
+
+        case RS_HERMITE:
+            for (; n >= 2; n -= 2) {
+                a = rs_hermite(data, phase);
+                b = rs_hermite(data, phase + step);
+                phase += 2 * step;
+                *mix++ += (a * amplitude) >> 15;
+                *mix++ += (b * amplitude) >> 15;
+            }
+            if (n) {
+                *mix += (rs_hermite(data, phase) * amplitude) >> 15;
+                phase += step;
+            }
+            break;
+
+        // do nothing if we receive an invalid value
+        default:
+            phase += n * step;
+            break;
+    }
+
+    v->phase = phase;
+}
+
+/**
+ * Starts playing a recording from its beginning at a pitch
+ * @param v - the voice to start
+ * @param sample - the recording to play
+ * @param frequency - the pitch to play at in Q16.16 Hz
+ * @param rate - the rate the voice is rendered at in Hz
+ * @param interp - the interpolation to resample with
+ */
+void rs_start(rs_voice *v, const rs_sample *sample, uint32_t frequency, uint32_t rate, rs_interp interp) {
+
+    // recording samples per output sample, scaled by the pitch over the recording's root
+    uint64_t step = (((uint64_t) frequency * sample->rate / rate) << 16) / sample->root;
+    if (step < 1) step = 1;
+    if (step > RS_MAX_STEP) step = RS_MAX_STEP;
+
+    v->sample = sample;
+    v->phase = 0;
+    v->step = (uint32_t) step;
+    v->interp = interp;
+}
+
+/**
+ * Resamples the next samples of a recording, adding them onto a mix
+ * @param v - the voice to render
+ * @param mix - the mix to add the samples to
+ * @param n - the number of samples to render
+ * @param amplitude - the amplitude in Q15
+ * @return one while the recording has samples left, zero once it has finished
+ */
+int rs_render(rs_voice *v, int32_t *mix, int n, int32_t amplitude) {
+
+    const rs_sample *s = v->sample;
+    if (!s) return 0;
+
+    uint32_t end = (s->loop_length ? s->loop_start + s->loop_length : s->length) << 16;
+
+    while (n > 0) {
+
+        // render up to the loop point in one run so the inner loops need no bounds checks
+        int run = (int) ((end - v->phase + v->step - 1) / v->step);
+        if (run > n) run = n;
+
+        rs_render_run(v, mix, run, amplitude);
+        mix += run;
+        n -= run;
+
+        if (v->phase >= end) {
+
+            // a one-shot has finished
+            if (!s->loop_length) {
+                v->sample = 0;
+                return 0;
+            }
+
+            while (v->phase >= end) v->phase -= s->loop_length << 16;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * Benchmarks rs_render using the cycle counter
+ * @param interp - the interpolation to benchmark
+ * @return the number of core cycles the voice takes per output sample
+ */
+int rs_cycles_per_sample(rs_interp interp) {
+
+    static int32_t mix[RS_BENCH_SAMPLES];
+    rs_voice v;
+
+    rs_start(&v, &RS_BENCH, RS_BENCH_PITCH, AUDIO_RATE, interp);
+
+    // time one block of a single voice
+    cyc_init();
+    uint32_t start = cyc_now();
+    rs_render(&v, mix, RS_BENCH_SAMPLES, 32767);
+    uint32_t cycles = cyc_now() - start;
+
+    return (int) ((cycles + RS_BENCH_SAMPLES / 2) / RS_BENCH_SAMPLES);
+}
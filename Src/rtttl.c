@@ -0,0 +1,229 @@
+/**
+ * @file rtttl.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a resumable parser that reads RTTTL ringtone text one note at a time
+ */
+
+# include "rtttl.h"
+# include "tuning.h"
+
+# define RTTTL_MAX_OCTAVE 8
+# define RTTTL_MAX_DURATION 64
+# define RTTTL_MAX_BPM 900
+# define RTTTL_WHOLE_TICKS (4 * TM_PPQ)
+
+/**
+ * The semitone of each note letter above C, from a to h
+ */
+static const int RTTTL_SEMITONES[8] = {9, 11, 0, 2, 4, 5, 7, 11};
+
+/**
+ * Skips spaces and line breaks
+ * @param s - the text to skip from
+ * @return the first other character
+ */
+static const char * rtttl_skip(const char *s) {
+    while (*s == ' ' || *s == '\t' || *s == '\r' || *s == '\n') s++;
+    return s;
+}
+
+/**
+ * Reads an unsigned decimal number
+ * @param s - the text to read, advanced past the number
+ * @return the number, or -1 if there is no number
+ */
+static int rtttl_number(const char **s) {
+
+    const char *c = *s;
+    int value = 0;
+
+    if (*c < '0' || *c > '9') return -1;
+
+    // stop accumulating once the value is out of range so long runs of digits cannot overflow
+    while (*c >= '0' && *c <= '9') {
+        if (value < 10000) value = value * 10 + (*c - '0');
+        c++;
+    }
+
+    *s = c;
+    return value;
+}
+
+/**
+ * Checks that a duration is a power of two note length
+ * @param d - the duration, as a fraction of a whole note
+ * @return one if the duration is valid, zero otherwise
+ */
+static int rtttl_valid_duration(int d) {
+    return d > 0 && d <= RTTTL_MAX_DURATION && !(d & (d - 1));
+}
+
+/**
+ * Opens an RTTTL song, reading its name and defaults
+ * The text must stay in place until the last note has been read
+ * @param p - the parser to open the song with
+ * @param text - the null terminated song
+ * @return one if the song has a valid header, zero otherwise
+ */
+int rtttl_open(rtttl_parser *p, const char *text) {
+
+    const char *s = text;
+
+    p->duration = RTTTL_DEFAULT_DURATION;
+    p->octave = RTTTL_DEFAULT_OCTAVE;
+    p->bpm = RTTTL_DEFAULT_BPM;
+    p->retimed = 1;
+    p->errors = 0;
+
+    // an invalid song has no notes to read
+    p->next = "";
+
+    // the name runs up to the first colon
+    p->name = s;
+    while (*s && *s != ':') s++;
+    p->name_length = (int) (s - text);
+    if (!*s++) return 0;
+
+    // the defaults section is a comma separated list of key=value pairs ending at the second colon
+    for (;;) {
+
+        s = rtttl_skip(s);
+        if (*s == ':') break;
+
+        char key = *s++;
+        s = rtttl_skip(s);
+        if (*s++ != '=') return 0;
+        s = rtttl_skip(s);
+
+        int value = rtttl_number(&s);
+
+        switch (key) {
+
+            case 'd':
+            case 'D':
+                if (!rtttl_valid_duration(value)) return 0;
+                p->duration = value;
+                break;
+
+            case 'o':
+            case 'O':
+                if (value < 0 || value > RTTTL_MAX_OCTAVE) return 0;
+                p->octave = value;
+                break;
+
+            case 'b':
+            case 'B':
+                if (value < 1 || value > RTTTL_MAX_BPM) return 0;
+                p->bpm = value;
+                break;
+
+            // do nothing if we receive an invalid value
+            default:
+                return 0;
+        }
+
+        s = rtttl_skip(s);
+        if (*s == ',') s++;
+        else if (*s != ':') return 0;
+    }
+
+    p->next = s + 1;
+    return 1;
+}
+
+/**
+ * Reads the next note of a song, skipping any malformed notes
+ * @param p - the parser reading the song
+ * @param n - the note to fill
+ * @return one if a note was read, zero at the end of the song
+ */
+int rtttl_next(rtttl_parser *p, mp_note *n) {
+
+    const char *s = p->next;
+
+    for (;;) {
+
+        s = rtttl_skip(s);
+        if (!*s) {
+            p->next = s;
+            return 0;
+        }
+
+        // an optional duration
+        int duration = rtttl_number(&s);
+        if (duration < 0) duration = p->duration;
+
+        // the note letter
+        char letter = *s | 0x20;
+        int rest = (letter == 'p');
+        int semitone = 0;
+        int valid = rtttl_valid_duration(duration) && (rest || (letter >= 'a' && letter <= 'h'));
+        if (valid) {
+            if (!rest) semitone = RTTTL_SEMITONES[letter - 'a'];
+            s++;
+        }
+
+        // an optional sharp, then the dot and octave in either order
+        if (*s == '#') {
+            semitone++;
+            s++;
+        }
+
+        int dotted = 0;
+        if (*s == '.') {
+            dotted = 1;
+            s++;
+        }
+
+        int octave = rtttl_number(&s);
+        if (octave < 0) octave = p->octave;
+
+        if (*s == '.') {
+            dotted = 1;
+            s++;
+        }
+
+        // a sharp b is the next octave's c
+        if (semitone == 12) {
+            semitone = 0;
+            octave++;
+        }
+
+        if (octave > RTTTL_MAX_OCTAVE) valid = 0;
+
+        // the note must end at a comma or the end of the song
+        s = rtttl_skip(s);
+        if (*s && *s != ',') valid = 0;
+
+        // skip the rest of a malformed note
+        if (!valid) {
+            while (*s && *s != ',') s++;
+        }
+
+        if (*s == ',') s++;
+
+        if (!valid) {
+            p->errors++;
+            continue;
+        }
+
+        // a whole note lasts four beats, and a dot adds half of the note again, which is a whole number
+        // of ticks for every valid duration, so no note is longer than a dotted whole note's ticks
+        *n = (mp_note) {0};
+        n->instrument = rest ? MP_INSTR_REST : MP_INSTR_KEYS;
+        n->duration = TM_TICKS(RTTTL_WHOLE_TICKS * (dotted ? 3 : 2) / (duration * 2));
+        n->dual_instrument = MP_INSTR_NONE;
+
+        // the first note sets the song's tempo
+        if (p->retimed) n->tempo = p->bpm;
+        p->retimed = 0;
+
+        // octave 4 starts at MIDI note 60
+        if (!rest) n->frequency = TN_PITCH(12 * (octave + 1) + semitone, 0);
+
+        p->next = s;
+        return 1;
+    }
+}
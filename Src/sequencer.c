@@ -0,0 +1,183 @@
+/**
+ * @file sequencer.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a tracker style sequencer that plays songs written as bytecode, one note at a time
+ */
+
+# include "sequencer.h"
+
+/**
+ * The number of operand bytes after each opcode
+ */
+static const uint8_t SEQ_OPERANDS[SEQ_TEMPO + 1] = {0, 4, 8, 1, 2, 3, 0, 2, 2};
+
+/**
+ * Reads a little-endian halfword
+ * @param s - the bytes to read
+ * @return the halfword
+ */
+static int seq_half(const uint8_t *s) {
+    return s[0] | (s[1] << 8);
+}
+
+/**
+ * Converts a length in the program's ticks to the player's
+ * @param ticks - the length in SEQ_TICKS_PER_QUARTER ticks
+ * @return the length in TM_PPQ ticks, tagged with TM_TICKS
+ */
+static int seq_ticks(int ticks) {
+    return TM_TICKS(ticks * (TM_PPQ / SEQ_TICKS_PER_QUARTER));
+}
+
+/**
+ * Reads one part of a note
+ * @param s - the part's operands, an instrument, a length in ticks, and a frequency
+ * @param instrument - receives the instrument
+ * @param duration - receives the length in the player's ticks
+ * @param frequency - receives the frequency
+ */
+static void seq_part(const uint8_t *s, mp_instrument *instrument, int *duration, int *frequency) {
+    *instrument = (mp_instrument) s[0];
+    *duration = seq_ticks(s[1]);
+    *frequency = seq_half(s + 2);
+}
+
+/**
+ * Hands a tempo change made since the last note to the note about to play
+ * @param vm - the sequencer
+ * @param n - the note about to play
+ */
+static void seq_retime(seq_vm *vm, mp_note *n) {
+    if (vm->retimed) n->tempo = vm->tempo;
+    vm->retimed = 0;
+}
+
+/**
+ * Moves to another part of the program, which has to be inside it
+ * @param vm - the sequencer
+ * @param offset - where to move to
+ * @return one if the offset is inside the program, zero otherwise
+ */
+static int seq_goto(seq_vm *vm, uint32_t offset) {
+    vm->pc = offset;
+    return offset < vm->length;
+}
+
+/**
+ * Starts playing a sequence
+ * @param vm - the sequencer to start
+ * @param song - a song in the SB_FORMAT_SEQUENCE format
+ * @return one if the song is a sequence, zero otherwise
+ */
+int seq_open(seq_vm *vm, const sb_song *song) {
+
+    vm->program = song->data;
+    vm->length = song->format == SB_FORMAT_SEQUENCE ? song->length : 0;
+    vm->pc = 0;
+    vm->tempo = MP_TEMPO;
+    vm->retimed = 1;
+    vm->depth = 0;
+    vm->errors = 0;
+
+    return vm->length > 0;
+}
+
+/**
+ * Runs a sequence up to its next note
+ * @param vm - the sequencer playing the song
+ * @param n - the note to fill
+ * @return one if a note was played, zero at the end of the song
+ */
+int seq_next(seq_vm *vm, mp_note *n) {
+
+    int whole = 1;
+
+    for (int step = 0; step < SEQ_MAX_STEPS && vm->pc < vm->length; step++) {
+
+        const uint8_t *s = vm->program + vm->pc;
+        int op = s[0];
+
+        if (op > SEQ_TEMPO || vm->length - vm->pc < 1u + SEQ_OPERANDS[op]) {
+            whole = 0;
+            break;
+        }
+        vm->pc += 1 + SEQ_OPERANDS[op];
+        s++;
+
+        switch (op) {
+
+            case SEQ_END:
+                vm->pc = vm->length;
+                return 0;
+
+            case SEQ_NOTE:
+            case SEQ_DUAL:
+                *n = (mp_note) {0};
+                seq_part(s, &n->instrument, &n->duration, &n->frequency);
+                n->dual_instrument = MP_INSTR_NONE;
+                if (op == SEQ_DUAL) seq_part(s + 4, &n->dual_instrument, &n->dual_duration, &n->dual_frequency);
+                seq_retime(vm, n);
+                return 1;
+
+            case SEQ_REST:
+                *n = (mp_note) {0};
+                n->instrument = MP_INSTR_REST;
+                n->duration = seq_ticks(s[0]);
+                n->dual_instrument = MP_INSTR_NONE;
+                seq_retime(vm, n);
+                return 1;
+
+            case SEQ_CALL:
+            case SEQ_REPEAT:
+                // a pattern played no times is skipped
+                if (op == SEQ_REPEAT && !s[0]) break;
+                if (vm->depth == SEQ_MAX_DEPTH) {
+                    whole = 0;
+                    break;
+                }
+                vm->stack[vm->depth].back = (uint16_t) vm->pc;
+                vm->stack[vm->depth].start = (uint16_t) seq_half(op == SEQ_CALL ? s : s + 1);
+                vm->stack[vm->depth].left = op == SEQ_CALL ? 0 : (uint8_t) (s[0] - 1);
+                whole = seq_goto(vm, vm->stack[vm->depth].start);
+                vm->depth++;
+                break;
+
+            case SEQ_RETURN:
+                if (!vm->depth) {
+                    whole = 0;
+                } else if (vm->stack[vm->depth - 1].left) {
+                    // play the pattern again
+                    vm->stack[vm->depth - 1].left--;
+                    vm->pc = vm->stack[vm->depth - 1].start;
+                } else {
+                    vm->depth--;
+                    vm->pc = vm->stack[vm->depth].back;
+                }
+                break;
+
+            case SEQ_JUMP:
+                whole = seq_goto(vm, (uint32_t) seq_half(s));
+                break;
+
+            case SEQ_TEMPO:
+                vm->tempo = seq_half(s);
+                vm->retimed = 1;
+                whole = vm->tempo > 0;
+                break;
+
+            // do nothing if we receive an invalid value
+            default:
+                break;
+        }
+
+        if (!whole) break;
+    }
+
+    // end the song on a malformed program, or one that runs too long without a note
+    if (vm->pc < vm->length || !whole) vm->errors = 1;
+    vm->pc = vm->length;
+
+    return 0;
+}
@@ -0,0 +1,147 @@
+/**
+ * @file sfx.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a parametric sound effect generator evaluated at control rate
+ */
+
+# include "sfx.h"
+# include "pitch_fx.h"
+# include "sine_table.h"
+
+# define SFX_Q16 65536LL
+# define SFX_MIN_DUTY 1
+# define SFX_MAX_DUTY (SFX_DUTY_MAX - 1)
+
+/**
+ * Sound effect presets, indexed by sfx_preset_id
+ */
+const sfx_params SFX_PRESETS[SFX_PRESET_COUNT] = {
+        // frequency, slide, slide_accel, duty, duty_sweep, vibrato_depth, vibrato_rate, noise, attack, sustain, decay
+        [SFX_BLIP]      = {1760,     0,      0, 128,    0,  0,   0, 0, 0,  30,  20},
+        [SFX_COIN]      = {1319,   960,  -4000,  64,    0,  0,   0, 0, 0,  60, 180},
+        [SFX_EXPLOSION] = { 400, -1200,      0, 128,    0,  0,   0, 1, 0,  50, 450},
+        [SFX_HIT]       = { 800, -2400,      0, 128, -600,  0,   0, 1, 0,  20, 100},
+        [SFX_JUMP]      = { 440,  1600,  -3000,  96,  400,  0,   0, 0, 5,  80, 120},
+        [SFX_LASER]     = {2400, -3200,   4000,  32,  800,  0,   0, 0, 0,  40, 120},
+        [SFX_POWERUP]   = { 523,   900,      0, 128,    0, 24, 120, 0, 5, 300, 200}
+};
+
+/**
+ * The noise generator state, a 32-bit xorshift that must never be zero
+ */
+static uint32_t sfx_lfsr = 0x2545F491;
+
+/**
+ * Computes the outputs of an effect for its current tick
+ * @param s - the effect to update
+ */
+static void sfx_update(sfx_state *s) {
+
+    const sfx_params *p = s->params;
+    int t = s->elapsed;
+
+    // the pitch is the slid offset plus the vibrato, scaled onto the starting frequency
+    int32_t steps = s->pitch / (int32_t) SFX_Q16;
+    if (p->vibrato_depth) steps += (SINE_OF(s->lfo_phase) * p->vibrato_depth) >> 15;
+    s->frequency = fx_scale(p->frequency, -steps);
+
+    s->duty = s->duty_q16 >> 16;
+
+    // linear attack, hold, then linear decay to silence
+    if (t < p->attack) {
+        s->level = (SFX_LEVEL_MAX * t) / p->attack;
+    } else if (t < p->attack + p->sustain) {
+        s->level = SFX_LEVEL_MAX;
+    } else if (t < p->attack + p->sustain + p->decay) {
+        s->level = (SFX_LEVEL_MAX * (p->attack + p->sustain + p->decay - t)) / p->decay;
+    } else {
+        s->level = 0;
+    }
+}
+
+/**
+ * Looks up a preset effect
+ * @param id - the preset to look up
+ * @return the parameters of the preset, or zero if there is no such preset
+ */
+const sfx_params * sfx_preset(int id) {
+    return (id >= 0 && id < SFX_PRESET_COUNT) ? &SFX_PRESETS[id] : 0;
+}
+
+/**
+ * Measures how long an effect plays for if it does not slide out of range first
+ * @param params - the effect to measure
+ * @return the duration of the effect in ms
+ */
+int sfx_duration(const sfx_params *params) {
+    return params->attack + params->sustain + params->decay;
+}
+
+/**
+ * Starts an effect from its first tick
+ * @param s - the state to start
+ * @param params - the effect to play
+ */
+void sfx_start(sfx_state *s, const sfx_params *params) {
+
+    s->params = params;
+    s->pitch = 0;
+    s->slide = (int32_t) ((params->slide * SFX_Q16) / SFX_TICK_FREQ);
+    s->duty_q16 = params->duty << 16;
+    s->lfo_phase = 0;
+    s->lfo_inc = (uint32_t) (((uint64_t) params->vibrato_rate << 32) / (10 * SFX_TICK_FREQ));
+    s->elapsed = 0;
+
+    sfx_update(s);
+}
+
+/**
+ * Advances an effect by one control tick and updates its outputs
+ * Must be called at SFX_TICK_FREQ
+ * @param s - the effect to advance
+ * @return one while the effect is playing, zero once it has finished
+ */
+int sfx_tick(sfx_state *s) {
+
+    const sfx_params *p = s->params;
+
+    if (!p) return 0;
+
+    // slide the pitch, then accelerate the slide
+    s->pitch += s->slide;
+    s->slide += (int32_t) ((p->slide_accel * SFX_Q16) / ((long long) SFX_TICK_FREQ * SFX_TICK_FREQ));
+
+    // sweep the duty cycle, keeping both halves of the wave present
+    s->duty_q16 += (int32_t) ((p->duty_sweep * SFX_Q16) / SFX_TICK_FREQ);
+    if (s->duty_q16 < (SFX_MIN_DUTY << 16)) s->duty_q16 = SFX_MIN_DUTY << 16;
+    if (s->duty_q16 > (SFX_MAX_DUTY << 16)) s->duty_q16 = SFX_MAX_DUTY << 16;
+
+    s->lfo_phase += s->lfo_inc;
+    s->elapsed++;
+
+    sfx_update(s);
+
+    // the effect ends when its envelope does, or when it slides out of the audible range
+    if (s->elapsed >= p->attack + p->sustain + p->decay || s->frequency < SFX_MIN_FREQ) {
+        s->level = 0;
+        s->params = 0;
+        return 0;
+    }
+
+    return 1;
+}
+
+/**
+ * Steps the noise generator shared by every effect
+ * @return sixteen fresh pseudo-random bits
+ */
+uint32_t sfx_noise(void) {
+
+    sfx_lfsr ^= sfx_lfsr << 13;
+    sfx_lfsr ^= sfx_lfsr >> 17;
+    sfx_lfsr ^= sfx_lfsr << 5;
+
+    return sfx_lfsr >> 16;
+}
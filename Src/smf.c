@@ -0,0 +1,371 @@
+/**
+ * @file smf.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a streaming Standard MIDI File reader that merges every track into one event stream
+ */
+
+# include "smf.h"
+# include "cycle_counter.h"
+# include "tuning.h"
+
+# define SMF_HEADER_LENGTH 6
+# define SMF_META_END 0x2F
+# define SMF_META_TEMPO 0x51
+# define SMF_TRACK_DONE -1
+
+/**
+ * Reads a big-endian number
+ * @param s - the bytes to read
+ * @param bytes - the number of bytes, at most four
+ * @return the number
+ */
+static uint32_t smf_big_endian(const uint8_t *s, int bytes) {
+    uint32_t value = 0;
+    while (bytes--) value = (value << 8) | *s++;
+    return value;
+}
+
+/**
+ * Reads a variable-length quantity, seven bits per byte with the high bit set on all but the last
+ * @param t - the track to read from, advanced past the quantity
+ * @param value - receives the quantity
+ * @return one if the quantity was read, zero if the track ended first
+ */
+static int smf_vlq(smf_track *t, uint32_t *value) {
+
+    uint32_t v = 0;
+
+    // a quantity is at most four bytes long
+    for (int i = 0; i < 4; i++) {
+        if (t->pos >= t->end) return 0;
+        uint8_t byte = *t->pos++;
+        v = (v << 7) | (byte & 0x7F);
+        if (!(byte & 0x80)) {
+            *value = v;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Checks whether one track's next event comes before another's, keeping earlier tracks first on ties
+ * so a type 1 file's tempo track leads
+ * @param p - the reader
+ * @param a - the first track
+ * @param b - the second track
+ * @return one if track a comes first, zero otherwise
+ */
+static int smf_before(smf_player *p, int a, int b) {
+    uint32_t ta = p->track[a].tick;
+    uint32_t tb = p->track[b].tick;
+    return ta < tb || (ta == tb && a < b);
+}
+
+/**
+ * Moves a heap entry towards the leaves until both of its children come after it
+ * @param p - the reader
+ * @param i - the index of the entry in the heap
+ */
+static void smf_sift_down(smf_player *p, int i) {
+
+    for (;;) {
+
+        int first = i;
+        int left = 2 * i + 1;
+        int right = left + 1;
+
+        if (left < p->tracks && smf_before(p, p->heap[left], p->heap[first])) first = left;
+        if (right < p->tracks && smf_before(p, p->heap[right], p->heap[first])) first = right;
+        if (first == i) return;
+
+        uint8_t swap = p->heap[i];
+        p->heap[i] = p->heap[first];
+        p->heap[first] = swap;
+        i = first;
+    }
+}
+
+/**
+ * Moves a heap entry towards the root until its parent comes before it
+ * @param p - the reader
+ * @param i - the index of the entry in the heap
+ */
+static void smf_sift_up(smf_player *p, int i) {
+
+    while (i > 0) {
+
+        int parent = (i - 1) / 2;
+        if (!smf_before(p, p->heap[i], p->heap[parent])) return;
+
+        uint8_t swap = p->heap[i];
+        p->heap[i] = p->heap[parent];
+        p->heap[parent] = swap;
+        i = parent;
+    }
+}
+
+/**
+ * Converts a tick to microseconds from the start of the file at the current tempo
+ * @param p - the reader
+ * @param tick - the tick to convert, no earlier than the last tempo change
+ * @return the time of the tick in microseconds
+ */
+static uint64_t smf_time(smf_player *p, uint32_t tick) {
+    return p->tempo_us + (uint64_t) (tick - p->tempo_tick) * p->tempo / p->division;
+}
+
+/**
+ * Counts a malformed event, which ends its track since nothing after it can be trusted
+ * @param p - the reader
+ * @return SMF_TRACK_DONE
+ */
+static int smf_malformed(smf_player *p) {
+    p->errors++;
+    return SMF_TRACK_DONE;
+}
+
+/**
+ * Decodes the event at a track's read position
+ * @param p - the reader
+ * @param t - the track to decode from, advanced past the event
+ * @param e - the event to fill
+ * @return one if the event should be reported, zero if it was skipped, or SMF_TRACK_DONE if the
+ * track has ended
+ */
+static int smf_decode(smf_player *p, smf_track *t, smf_event *e) {
+
+    if (t->pos >= t->end) return SMF_TRACK_DONE;
+
+    uint8_t status = *t->pos;
+    uint32_t length;
+
+    // system exclusive messages are skipped, and like meta events they cancel running status
+    if (status == 0xF0 || status == 0xF7) {
+        t->pos++;
+        t->status = 0;
+        if (!smf_vlq(t, &length) || length > (uint32_t) (t->end - t->pos)) return smf_malformed(p);
+        t->pos += length;
+        return 0;
+    }
+
+    if (status == 0xFF) {
+
+        t->pos++;
+        t->status = 0;
+        if (t->pos >= t->end) return smf_malformed(p);
+        uint8_t type = *t->pos++;
+        if (!smf_vlq(t, &length) || length > (uint32_t) (t->end - t->pos)) return smf_malformed(p);
+
+        const uint8_t *data = t->pos;
+        t->pos += length;
+
+        if (type == SMF_META_END) return SMF_TRACK_DONE;
+
+        // later events are timed from the tick of the tempo change
+        if (type == SMF_META_TEMPO && length == 3) {
+            p->tempo_us = smf_time(p, t->tick);
+            p->tempo_tick = t->tick;
+            p->tempo = smf_big_endian(data, 3);
+            e->type = SMF_TEMPO;
+            e->channel = 0;
+            e->key = 0;
+            e->value = p->tempo;
+            return 1;
+        }
+
+        return 0;
+    }
+
+    // a data byte in place of a status byte repeats the last status
+    if (status & 0x80) {
+        if (status >= 0xF0) return smf_malformed(p);
+        t->status = status;
+        t->pos++;
+    } else if (!t->status) {
+        return smf_malformed(p);
+    }
+
+    // program changes and channel pressure carry one data byte, the rest carry two
+    int kind = t->status >> 4;
+    int bytes = (kind == 0xC || kind == 0xD) ? 1 : 2;
+    if (t->end - t->pos < bytes) return smf_malformed(p);
+
+    uint8_t d1 = t->pos[0] & 0x7F;
+    uint8_t d2 = bytes == 2 ? t->pos[1] & 0x7F : 0;
+    t->pos += bytes;
+
+    e->channel = t->status & 0x0F;
+    e->key = d1;
+    e->value = d2;
+
+    switch (kind) {
+
+        case 0x8:
+            e->type = SMF_NOTE_OFF;
+            return 1;
+
+        case 0x9:
+            // a note on with no velocity is a note off
+            e->type = d2 ? SMF_NOTE_ON : SMF_NOTE_OFF;
+            return 1;
+
+        case 0xB:
+            e->type = SMF_CONTROL;
+            return 1;
+
+        case 0xC:
+            e->type = SMF_PROGRAM;
+            return 1;
+
+        case 0xE:
+            e->type = SMF_PITCH_BEND;
+            e->key = 0;
+            e->value = d1 | (d2 << 7);
+            return 1;
+
+        // poly and channel pressure are skipped, as nothing plays them
+        default:
+            return 0;
+    }
+}
+
+/**
+ * Opens a MIDI file held in memory
+ * The file must stay in place until its last event has been read
+ * @param p - the reader to open the file with
+ * @param data - the contents of the file
+ * @param length - the length of the file in bytes
+ * @return one if the file is a type 0 or 1 file with a ticks per quarter note division, zero otherwise
+ */
+int smf_open(smf_player *p, const uint8_t *data, uint32_t length) {
+
+    const uint8_t *end = data + length;
+
+    p->tracks = 0;
+    p->tempo = SMF_DEFAULT_TEMPO;
+    p->tempo_tick = 0;
+    p->tempo_us = 0;
+    p->errors = 0;
+
+    // the header chunk
+    if (length < 8 + SMF_HEADER_LENGTH || smf_big_endian(data, 4) != 0x4D546864) return 0;
+
+    uint32_t header_length = smf_big_endian(data + 4, 4);
+    if (header_length < SMF_HEADER_LENGTH || header_length > length - 8) return 0;
+
+    uint32_t format = smf_big_endian(data + 8, 2);
+    uint32_t division = smf_big_endian(data + 12, 2);
+
+    // type 2 files hold independent sequences, and SMPTE divisions time events in frames
+    if (format > 1 || division == 0 || (division & 0x8000)) return 0;
+    p->division = (uint16_t) division;
+
+    // start a reader on each track chunk, skipping chunks of any other type
+    const uint8_t *s = data + 8 + header_length;
+
+    while (end - s >= 8 && p->tracks < SMF_MAX_TRACKS) {
+
+        uint32_t id = smf_big_endian(s, 4);
+        uint32_t chunk = smf_big_endian(s + 4, 4);
+        s += 8;
+
+        // a truncated chunk is read as far as it goes
+        if (chunk > (uint32_t) (end - s)) chunk = (uint32_t) (end - s);
+
+        if (id == 0x4D54726B) {
+
+            int i = p->tracks;
+            smf_track *t = &p->track[i];
+            t->pos = s;
+            t->end = s + chunk;
+            t->status = 0;
+
+            // tracks with no events are left out of the heap
+            if (smf_vlq(t, &t->tick)) {
+                p->heap[i] = (uint8_t) i;
+                p->tracks++;
+                smf_sift_up(p, i);
+            }
+        }
+
+        s += chunk;
+    }
+
+    return 1;
+}
+
+/**
+ * Reads the next event of the file in time order
+ * @param p - the reader reading the file
+ * @param e - the event to fill
+ * @return one if an event was read, zero at the end of the file
+ */
+int smf_next(smf_player *p, smf_event *e) {
+
+    while (p->tracks > 0) {
+
+        // the root of the heap is the track whose next event comes first
+        int i = p->heap[0];
+        smf_track *t = &p->track[i];
+
+        e->track = (uint8_t) i;
+        e->tick = t->tick;
+        e->time_us = (uint32_t) smf_time(p, t->tick);
+
+        int result = smf_decode(p, t, e);
+
+        // move on to the track's next event, or drop the track once it has ended
+        uint32_t delta;
+        if (result != SMF_TRACK_DONE && smf_vlq(t, &delta)) {
+            t->tick += delta;
+        } else {
+            p->heap[0] = p->heap[--p->tracks];
+        }
+        smf_sift_down(p, 0);
+
+        if (result == 1) return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * Converts a MIDI note number to a frequency in the build's temperament, where note 69 is A4
+ * @param note - the note number, from 0 to 127
+ * @return the frequency of the note in Q16.16 Hz
+ */
+uint32_t smf_note_frequency(int note) {
+
+    if (note < 0) note = 0;
+    if (note > 127) note = 127;
+
+    return TN_TABLE[note];
+}
+
+/**
+ * Benchmarks smf_next using the cycle counter
+ * @param data - the contents of a file to read
+ * @param length - the length of the file in bytes
+ * @return the average number of core cycles it takes to read one event, or zero if the file has none
+ */
+int smf_cycles_per_event(const uint8_t *data, uint32_t length) {
+
+    smf_player p;
+    smf_event e;
+    uint32_t events = 0;
+
+    if (!smf_open(&p, data, length)) return 0;
+
+    // time reading the whole file
+    cyc_init();
+    uint32_t start = cyc_now();
+    while (smf_next(&p, &e)) events++;
+    uint32_t cycles = cyc_now() - start;
+
+    if (!events) return 0;
+    return (int) ((cycles + events / 2) / events);
+}
@@ -0,0 +1,261 @@
+/**
+ * @file song_bank.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief reads the song banks Tools/songc links into the .songs flash section, in place
+ */
+
+# include "song_bank.h"
+
+/**
+ * The bounds of the .songs section, from the linker script
+ */
+extern const uint8_t _ssongs[];
+extern const uint8_t _esongs[];
+
+/**
+ * The CRC-32 of each nibble, which keeps the table small enough to leave in flash
+ */
+static const uint32_t SB_CRC_NIBBLE[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+/**
+ * Checks that a bank is whole and fits in what is left of the section
+ * @param bank - the bank to check
+ * @return one if the bank can be read, zero otherwise
+ */
+static int sb_valid(const sb_header *bank) {
+
+    uint32_t left = (uint32_t) (_esongs - (const uint8_t *) bank);
+
+    if (left < sizeof(sb_header) || bank->magic != SB_MAGIC || bank->version != SB_VERSION) return 0;
+    return bank->size >= sizeof(sb_header) + bank->count * sizeof(sb_entry) + bank->slots * sizeof(uint16_t) &&
+           bank->size <= left;
+}
+
+/**
+ * Finds the slot table of a bank, which follows its index
+ * @param bank - the bank
+ * @return the slot table
+ */
+static const uint16_t * sb_slots(const sb_header *bank) {
+    return (const uint16_t *) &bank->entry[bank->count];
+}
+
+/**
+ * Fills a song from its index entry
+ * @param bank - the bank holding the song
+ * @param e - the song's index entry
+ * @param song - the song to fill
+ * @return one if the song lies inside its bank, zero otherwise
+ */
+static int sb_fill(const sb_header *bank, const sb_entry *e, sb_song *song) {
+
+    if (e->offset > bank->size || e->length > bank->size - e->offset) return 0;
+
+    song->data = (const uint8_t *) bank + e->offset;
+    song->length = e->length;
+    song->format = (sb_format) e->format;
+    song->name = e->name;
+    song->id = e->id;
+    song->tempo = e->tempo;
+    song->voices = e->voices;
+    song->duration = e->duration;
+    song->crc = e->crc;
+
+    return 1;
+}
+
+/**
+ * Moves on to the bank after another
+ * @param bank - the current bank
+ * @return the next bank
+ */
+static const sb_header * sb_following(const sb_header *bank) {
+    return (const sb_header *) ((const uint8_t *) bank + ((bank->size + 3) & ~3u));
+}
+
+/**
+ * Reads a little-endian halfword
+ * @param s - the bytes to read
+ * @return the halfword
+ */
+static int sb_half(const uint8_t *s) {
+    return s[0] | (s[1] << 8);
+}
+
+/**
+ * Counts the songs in every linked bank
+ * @return the number of songs
+ */
+int sb_count(void) {
+
+    int count = 0;
+
+    for (const sb_header *bank = (const sb_header *) _ssongs; sb_valid(bank); bank = sb_following(bank)) {
+        count += bank->count;
+    }
+
+    return count;
+}
+
+/**
+ * Looks up a song by its position in the linked banks
+ * @param index - the position of the song
+ * @param song - the song to fill
+ * @return one if the song exists, zero otherwise
+ */
+int sb_get(int index, sb_song *song) {
+
+    if (index < 0) return 0;
+
+    for (const sb_header *bank = (const sb_header *) _ssongs; sb_valid(bank); bank = sb_following(bank)) {
+
+        // skip whole banks until the one holding the song
+        if (index >= bank->count) {
+            index -= bank->count;
+            continue;
+        }
+
+        return sb_fill(bank, &bank->entry[index], song);
+    }
+
+    return 0;
+}
+
+/**
+ * Looks up a song by its id in constant time, without reading any other song
+ * @param id - the id of the song
+ * @param song - the song to fill
+ * @return one if there is a song with that id, zero otherwise
+ */
+int sb_find_id(int id, sb_song *song) {
+
+    if (id < 0 || id >= SB_MAX_ID) return 0;
+
+    // each bank maps its ids straight to its index, so only the banks themselves are walked
+    for (const sb_header *bank = (const sb_header *) _ssongs; sb_valid(bank); bank = sb_following(bank)) {
+        if (id >= bank->slots) continue;
+        uint16_t slot = sb_slots(bank)[id];
+        if (slot != SB_NO_SONG && slot < bank->count) return sb_fill(bank, &bank->entry[slot], song);
+    }
+
+    return 0;
+}
+
+/**
+ * Looks up a song by name
+ * @param name - the name of the song
+ * @param song - the song to fill
+ * @return the position of the song, or -1 if there is no song by that name
+ */
+int sb_find(const char *name, sb_song *song) {
+
+    int count = sb_count();
+
+    for (int i = 0; i < count; i++) {
+
+        if (!sb_get(i, song)) return -1;
+
+        // compare up to the padded name length, since a full length name has no terminator
+        int c = 0;
+        while (c < SB_NAME_LENGTH && name[c] && name[c] == song->name[c]) c++;
+        if (c == SB_NAME_LENGTH || (!name[c] && !song->name[c])) return i;
+    }
+
+    return -1;
+}
+
+/**
+ * Computes the CRC-32 of some bytes, as zlib and the song bank compiler do
+ * @param crc - the CRC of the bytes before these, or zero to start
+ * @param data - the bytes
+ * @param length - the number of bytes
+ * @return the CRC of all the bytes so far
+ */
+uint32_t sb_crc(uint32_t crc, const uint8_t *data, uint32_t length) {
+
+    crc = ~crc;
+
+    // low nibble first, as the CRC is reflected
+    for (uint32_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ SB_CRC_NIBBLE[crc & 0xF];
+        crc = (crc >> 4) ^ SB_CRC_NIBBLE[crc & 0xF];
+    }
+
+    return ~crc;
+}
+
+/**
+ * Checks a song against the CRC in its index entry
+ * @param song - the song to check
+ * @return one if the song is whole, zero otherwise
+ */
+int sb_verify(const sb_song *song) {
+    return sb_crc(0, song->data, song->length) == song->crc;
+}
+
+/**
+ * Checks the index and slot table of every linked bank against their CRCs, and every song against
+ * its own
+ * @return the number of banks and songs that failed, or zero if the whole library is whole
+ */
+int sb_check(void) {
+
+    int failed = 0;
+    sb_song song;
+
+    for (const sb_header *bank = (const sb_header *) _ssongs; sb_valid(bank); bank = sb_following(bank)) {
+
+        // the index and slot table run from the first entry to the end of the slots
+        uint32_t length = bank->count * sizeof(sb_entry) + bank->slots * sizeof(uint16_t);
+        if (sb_crc(0, (const uint8_t *) bank->entry, length) != bank->crc) {
+            failed++;
+            continue;
+        }
+
+        for (int i = 0; i < bank->count; i++) {
+            if (!sb_fill(bank, &bank->entry[i], &song) || !sb_verify(&song)) failed++;
+        }
+    }
+
+    return failed;
+}
+
+/**
+ * Starts reading the packed notes of a song
+ * @param r - the reader to start
+ * @param song - a song in the SB_FORMAT_NOTES format
+ */
+void sb_open(sb_reader *r, const sb_song *song) {
+    r->pos = song->data;
+    r->end = song->format == SB_FORMAT_NOTES ? song->data + song->length : song->data;
+}
+
+/**
+ * Reads the next packed note of a song
+ * @param r - the reader reading the song
+ * @param n - the note to fill
+ * @return one if a note was read, zero at the end of the song
+ */
+int sb_next(sb_reader *r, mp_note *n) {
+
+    if (r->end - r->pos < SB_NOTE_SIZE) return 0;
+
+    const uint8_t *s = r->pos;
+    r->pos += SB_NOTE_SIZE;
+
+    *n = (mp_note) {0};
+    n->duration = sb_half(s);
+    n->frequency = sb_half(s + 2);
+    n->dual_duration = sb_half(s + 4);
+    n->dual_frequency = sb_half(s + 6);
+    n->instrument = (mp_instrument) s[8];
+    n->dual_instrument = (mp_instrument) s[9];
+
+    return 1;
+}
@@ -0,0 +1,429 @@
+/**
+ * @file song_codec.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a compressed song format and a streaming decoder that reads it one note at a time
+ */
+
+# include "song_codec.h"
+# include "cycle_counter.h"
+
+# define SC_MAX_SEEN 64 // distinct durations the encoder tallies for the dictionary
+
+/**
+ * The instrument of each three bit code
+ */
+static const mp_instrument SC_CODES[8] = {
+        MP_INSTR_KEYS, MP_INSTR_REST, MP_INSTR_KICK, MP_INSTR_HAT,
+        MP_INSTR_SNARE, MP_INSTR_FM, MP_INSTR_PLUCK, MP_INSTR_SAW
+};
+
+/**
+ * Checks whether an instrument's parts carry a pitch
+ * @param instrument - the instrument to check
+ * @return one if the instrument has a pitch, zero otherwise
+ */
+static int sc_pitched(mp_instrument instrument) {
+    return instrument == MP_INSTR_KEYS || instrument == MP_INSTR_FM || instrument == MP_INSTR_PLUCK ||
+           instrument == MP_INSTR_SAW;
+}
+
+/**
+ * Reads a little-endian halfword
+ * @param s - the bytes to read
+ * @return the halfword
+ */
+static int sc_half(const uint8_t *s) {
+    return s[0] | (s[1] << 8);
+}
+
+/**
+ * Decodes one part of a note
+ * @param d - the decoder reading the song
+ * @param op - the part's token, already read
+ * @param instrument - receives the instrument of the part
+ * @param duration - receives the duration of the part
+ * @param frequency - receives the frequency of the part
+ * @param previous - the previous pitch of the part's voice, updated if the part has a pitch
+ * @return one if the part was whole, zero if it was malformed
+ */
+static int sc_part(sc_decoder *d, int op, mp_instrument *instrument, int *duration, int *frequency,
+                   int *previous) {
+
+    int index = op & 0x0F;
+
+    *instrument = SC_CODES[(op >> 4) & 0x07];
+    *frequency = 0;
+
+    // look the duration up, or read it in full
+    if (index == SC_ESCAPE) {
+        if (d->end - d->pos < 2) return 0;
+        *duration = sc_half(d->pos);
+        d->pos += 2;
+    } else {
+        if (index >= d->duration_count) return 0;
+        *duration = sc_half(d->durations + 2 * index);
+    }
+
+    if (!sc_pitched(*instrument)) return 1;
+
+    // the pitch change is at most seventeen bits, so it never takes more than three bytes
+    uint32_t zigzag = 0;
+    for (int shift = 0; ; shift += 7) {
+        if (shift > 14 || d->pos == d->end) return 0;
+        int byte = *d->pos++;
+        zigzag |= (uint32_t) (byte & 0x7F) << shift;
+        if (!(byte & 0x80)) break;
+    }
+
+    int change = (int) (zigzag >> 1) ^ -(int) (zigzag & 1);
+    if (*previous + change < 0 || *previous + change > 0xFFFF) return 0;
+
+    *previous += change;
+    *frequency = *previous;
+
+    return 1;
+}
+
+/**
+ * Starts decoding a compressed song
+ * @param d - the decoder to start
+ * @param song - a song in the SB_FORMAT_COMPRESSED format
+ * @return one if the song has a valid dictionary, zero otherwise
+ */
+int sc_open(sc_decoder *d, const sb_song *song) {
+
+    d->pos = song->data;
+    d->end = song->data;
+    d->duration_count = 0;
+    d->frequency = 0;
+    d->dual_frequency = 0;
+    d->repeats = 0;
+    d->previous = (mp_note) {0};
+    d->previous.instrument = MP_INSTR_END;
+    d->errors = 0;
+
+    if (song->format != SB_FORMAT_COMPRESSED || !song->length) return 0;
+
+    // the dictionary comes first
+    int count = song->data[0];
+    if (count > SC_MAX_DURATIONS || song->length < 1 + 2u * count) return 0;
+
+    d->durations = song->data + 1;
+    d->duration_count = count;
+    d->pos = song->data + 1 + 2 * count;
+    d->end = song->data + song->length;
+
+    return 1;
+}
+
+/**
+ * Decodes the next note of a compressed song
+ * @param d - the decoder reading the song
+ * @param n - the note to fill
+ * @return one if a note was read, zero at the end of the song
+ */
+int sc_next(sc_decoder *d, mp_note *n) {
+
+    // finish a run before reading on
+    if (d->repeats) {
+        d->repeats--;
+        *n = d->previous;
+        return 1;
+    }
+
+    if (d->pos == d->end) return 0;
+
+    int op = *d->pos++;
+    int whole = 1;
+    mp_note note = {0};
+
+    if (op < 0x80) {
+        whole = sc_part(d, op, &note.instrument, &note.duration, &note.frequency, &d->frequency);
+        note.dual_instrument = MP_INSTR_NONE;
+    } else if (op < 0xC0) {
+        // a run can only repeat a note that came before it
+        whole = d->previous.instrument != MP_INSTR_END;
+        d->repeats = op & 0x3F;
+        note = d->previous;
+    } else if (op == 0xC0 && d->end - d->pos >= 2 && d->pos[0] < 0x80) {
+        whole = sc_part(d, *d->pos++, &note.instrument, &note.duration, &note.frequency, &d->frequency);
+        whole = whole && d->pos != d->end && *d->pos < 0x80;
+        whole = whole && sc_part(d, *d->pos++, &note.dual_instrument, &note.dual_duration, &note.dual_frequency,
+                                 &d->dual_frequency);
+    } else {
+        whole = 0;
+    }
+
+    // end the song on a malformed token rather than play on from a position that is not a token
+    if (!whole) {
+        d->errors = 1;
+        d->repeats = 0;
+        d->pos = d->end;
+        return 0;
+    }
+
+    d->previous = note;
+    *n = note;
+
+    return 1;
+}
+
+/**
+ * Brings a note to the single form it is compressed in, which plays the same once mp_add_note
+ * converts it
+ * @param n - the note to bring to form
+ * @return one if the note has a compressed form, zero otherwise
+ */
+static int sc_normal(mp_note *n) {
+
+    mp_note in = *n;
+
+    *n = (mp_note) {0};
+    n->instrument = in.instrument;
+    n->duration = in.duration;
+    n->frequency = in.frequency;
+    n->dual_instrument = MP_INSTR_NONE;
+
+    switch (in.instrument) {
+
+        case MP_INSTR_KEYS:
+            // silent keys are a rest
+            if (!in.frequency) n->instrument = MP_INSTR_REST;
+            break;
+
+        case MP_INSTR_REST:
+            n->frequency = 0;
+            break;
+
+        case MP_INSTR_HAT:
+            n->duration = TM_IS_TICKS(in.duration) ? MP_INSTR_HAT_TICKS : MP_INSTR_HAT_DURATION;
+            n->frequency = 0;
+            break;
+
+        case MP_INSTR_KICK:
+            n->duration = TM_IS_TICKS(in.duration) ? MP_INSTR_KICK_TICKS : MP_INSTR_KICK_DURATION;
+            n->frequency = 0;
+            break;
+
+        case MP_INSTR_SNARE:
+            n->duration = TM_IS_TICKS(in.duration) ? MP_INSTR_SNARE_TICKS : MP_INSTR_SNARE_DURATION;
+            n->frequency = 0;
+            break;
+
+        case MP_INSTR_FM:
+        case MP_INSTR_PLUCK:
+        case MP_INSTR_SAW:
+            break;
+
+        // sound effects and invalid instruments have no compressed form
+        default:
+            return 0;
+    }
+
+    // an empty dual part, or one already converted to a silent 1 ms note, is left out
+    if (in.dual_instrument != MP_INSTR_NONE &&
+        (in.dual_instrument != MP_INSTR_KEYS || in.dual_frequency || in.dual_duration > 1)) {
+
+        mp_note dual = {0};
+        dual.instrument = in.dual_instrument;
+        dual.duration = in.dual_duration;
+        dual.frequency = in.dual_frequency;
+        dual.dual_instrument = MP_INSTR_NONE;
+        if (!sc_normal(&dual)) return 0;
+
+        n->dual_instrument = dual.instrument;
+        n->dual_duration = dual.duration;
+        n->dual_frequency = dual.frequency;
+    }
+
+    return n->duration >= 0 && n->duration <= 0xFFFF && n->frequency >= 0 && n->frequency <= 0xFFFF;
+}
+
+/**
+ * Checks whether two notes in compressed form are the same
+ * @param a - a note
+ * @param b - another note
+ * @return one if the notes are the same, zero otherwise
+ */
+static int sc_same(const mp_note *a, const mp_note *b) {
+    return a->instrument == b->instrument && a->duration == b->duration && a->frequency == b->frequency &&
+           a->dual_instrument == b->dual_instrument && a->dual_duration == b->dual_duration &&
+           a->dual_frequency == b->dual_frequency;
+}
+
+/**
+ * Writes one part of a note
+ * @param s - where to write
+ * @param instrument - the instrument of the part
+ * @param duration - the duration of the part
+ * @param frequency - the frequency of the part
+ * @param previous - the previous pitch of the part's voice, updated if the part has a pitch
+ * @param durations - the dictionary
+ * @param count - the number of durations in the dictionary
+ * @return the position after the part
+ */
+static uint8_t * sc_put_part(uint8_t *s, mp_instrument instrument, int duration, int frequency, int *previous,
+                             const int *durations, int count) {
+
+    int code = 0;
+    while (SC_CODES[code] != instrument) code++;
+
+    int index = 0;
+    while (index < count && durations[index] != duration) index++;
+    if (index == count) index = SC_ESCAPE;
+
+    *s++ = (uint8_t) (code << 4 | index);
+
+    if (index == SC_ESCAPE) {
+        *s++ = (uint8_t) duration;
+        *s++ = (uint8_t) (duration >> 8);
+    }
+
+    if (!sc_pitched(instrument)) return s;
+
+    int change = frequency - *previous;
+    uint32_t zigzag = change < 0 ? ((uint32_t) -change << 1) - 1 : (uint32_t) change << 1;
+    *previous = frequency;
+
+    while (zigzag >= 0x80) {
+        *s++ = (uint8_t) (zigzag | 0x80);
+        zigzag >>= 7;
+    }
+    *s++ = (uint8_t) zigzag;
+
+    return s;
+}
+
+/**
+ * Compresses notes, as songc does for the song banks
+ * @param notes - the notes to compress
+ * @param count - the number of notes
+ * @param out - where to write the compressed song
+ * @param capacity - the room in out, in bytes
+ * @return the length of the compressed song, or zero if a note has no compressed form or it does
+ * not fit
+ */
+int sc_encode(const mp_note *notes, int count, uint8_t *out, int capacity) {
+
+    int seen[SC_MAX_SEEN];
+    int uses[SC_MAX_SEEN];
+    int seen_count = 0;
+
+    // tally the durations, leaving any past the first SC_MAX_SEEN distinct ones to be written in full
+    for (int i = 0; i < 2 * count; i++) {
+
+        mp_note n = notes[i / 2];
+        if (!sc_normal(&n)) return 0;
+        if (i & 1 && n.dual_instrument == MP_INSTR_NONE) continue;
+
+        int duration = i & 1 ? n.dual_duration : n.duration;
+        int k = 0;
+        while (k < seen_count && seen[k] != duration) k++;
+
+        if (k < seen_count) {
+            uses[k]++;
+        } else if (seen_count < SC_MAX_SEEN) {
+            seen[seen_count] = duration;
+            uses[seen_count++] = 1;
+        }
+    }
+
+    int durations[SC_MAX_DURATIONS];
+    int duration_count = 0;
+
+    // fill the dictionary with the most used durations, favouring the earliest on a tie
+    while (duration_count < SC_MAX_DURATIONS) {
+
+        int best = -1;
+        for (int k = 0; k < seen_count; k++) {
+            if (uses[k] && (best < 0 || uses[k] > uses[best])) best = k;
+        }
+
+        // a duration used once costs more in the dictionary than written in full
+        if (best < 0 || uses[best] < 2) break;
+
+        durations[duration_count++] = seen[best];
+        uses[best] = 0;
+    }
+
+    if (capacity < 1 + 2 * duration_count) return 0;
+
+    uint8_t *s = out;
+    *s++ = (uint8_t) duration_count;
+    for (int i = 0; i < duration_count; i++) {
+        *s++ = (uint8_t) durations[i];
+        *s++ = (uint8_t) (durations[i] >> 8);
+    }
+
+    int frequency = 0, dual_frequency = 0;
+    mp_note previous = {0};
+
+    for (int i = 0; i < count; ) {
+
+        mp_note n = notes[i];
+        sc_normal(&n);
+
+        // the longest token has to fit before it is written
+        if (out + capacity - s < SC_MAX_TOKEN) return 0;
+
+        // repeat the previous note rather than write it again
+        int run = 0;
+        while (i > 0 && i + run < count && run < SC_MAX_RUN) {
+            mp_note m = notes[i + run];
+            sc_normal(&m);
+            if (!sc_same(&m, &previous)) break;
+            run++;
+        }
+
+        if (run) {
+            *s++ = (uint8_t) (0x80 | (run - 1));
+            i += run;
+            continue;
+        }
+
+        if (n.dual_instrument != MP_INSTR_NONE) *s++ = 0xC0;
+
+        s = sc_put_part(s, n.instrument, n.duration, n.frequency, &frequency, durations, duration_count);
+
+        if (n.dual_instrument != MP_INSTR_NONE) {
+            s = sc_put_part(s, n.dual_instrument, n.dual_duration, n.dual_frequency, &dual_frequency, durations,
+                            duration_count);
+        }
+
+        previous = n;
+        i++;
+    }
+
+    return (int) (s - out);
+}
+
+/**
+ * Measures the slowest note to decode from a compressed song on the target
+ * @param data - the compressed song
+ * @param length - the length of the song in bytes
+ * @return the most core cycles any one call to sc_next took
+ */
+int sc_cycles_worst(const uint8_t *data, uint32_t length) {
+
+    sb_song song = {.data = data, .length = length, .format = SB_FORMAT_COMPRESSED, .name = "bench"};
+    sc_decoder d;
+    mp_note n;
+    uint32_t worst = 0;
+
+    if (!sc_open(&d, &song)) return 0;
+
+    cyc_init();
+
+    // time each note on its own, including the call that finds the end of the song
+    while (1) {
+        uint32_t start = cyc_now();
+        int more = sc_next(&d, &n);
+        uint32_t cycles = cyc_now() - start;
+        if (cycles > worst) worst = cycles;
+        if (!more) break;
+    }
+
+    return (int) worst;
+}
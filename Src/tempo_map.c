@@ -0,0 +1,114 @@
+/**
+ * @file tempo_map.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief note durations written in ticks and timed by a tempo map as they play
+ */
+
+# include "tempo_map.h"
+
+/**
+ * Changes the tempo from where the song has got to, such as for a tempo change a note carries
+ * Any later change in the map's own list still takes over once the song reaches it
+ * @param m - the tempo map
+ * @param tempo - the tempo in quarter notes per minute, which is clamped to a playable range
+ */
+void tm_set_tempo(tm_map *m, int tempo) {
+
+    if (tempo < 1) tempo = 1;
+    if (tempo > TM_MAX_TEMPO) tempo = TM_MAX_TEMPO;
+
+    // the only division, made once per tempo change rather than once per note, and rounded up so
+    // that lengths of a whole number of ms are not floored to one ms less
+    uint32_t ticks_per_minute = (uint32_t) tempo * TM_PPQ;
+    m->ms_per_tick = ((60000ULL << 32) + ticks_per_minute - 1) / ticks_per_minute;
+}
+
+/**
+ * Makes every tempo change the song has reached
+ * @param m - the tempo map
+ */
+static void tm_apply(tm_map *m) {
+    while (m->next < m->count && m->changes[m->next].tick <= m->tick) {
+        tm_set_tempo(m, m->changes[m->next].tempo);
+        m->next++;
+    }
+}
+
+/**
+ * Measures a span of ticks from where the song has got to, moving the map past it
+ * @param m - the tempo map
+ * @param ticks - the number of ticks
+ * @return the length of the span in ms, with what is left of a ms carried in the map
+ */
+static int tm_span(tm_map *m, uint32_t ticks) {
+
+    uint64_t ms = m->fraction;
+
+    while (ticks) {
+
+        // stop at the next tempo change if it lands inside the span
+        uint32_t run = ticks;
+        if (m->next < m->count && m->changes[m->next].tick - m->tick < run) run = m->changes[m->next].tick - m->tick;
+
+        ms += run * m->ms_per_tick;
+        m->tick += run;
+        ticks -= run;
+
+        tm_apply(m);
+    }
+
+    m->fraction = (uint32_t) ms;
+    return (int) (ms >> 32);
+}
+
+/**
+ * Sets up a tempo map and moves it to the start of the song
+ * @param m - the tempo map
+ * @param tempo - the tempo in quarter notes per minute until the first change
+ * @param changes - the tempo changes, in order of their ticks, which must stay in place, or null
+ * @param count - the number of changes
+ */
+void tm_init(tm_map *m, int tempo, const tm_change *changes, int count) {
+    m->changes = changes;
+    m->count = changes ? count : 0;
+    m->start_tempo = tempo;
+    tm_rewind(m);
+}
+
+/**
+ * Moves a tempo map back to the start of the song
+ * @param m - the tempo map
+ */
+void tm_rewind(tm_map *m) {
+    m->next = 0;
+    m->tick = 0;
+    m->fraction = 0;
+    tm_set_tempo(m, m->start_tempo);
+    tm_apply(m);
+}
+
+/**
+ * Converts the durations of a note's parts from ticks to ms and moves the song on past the note
+ * Durations already in ms are left as they are
+ * @param m - the tempo map
+ * @param duration - the duration of the main part, replaced by its length in ms
+ * @param dual_duration - the duration of the dual part, replaced by its length in ms
+ */
+void tm_resolve(tm_map *m, int *duration, int *dual_duration) {
+
+    int ticks = TM_IS_TICKS(*duration) ? TM_TICK_COUNT(*duration) : -1;
+    int dual_ticks = TM_IS_TICKS(*dual_duration) ? TM_TICK_COUNT(*dual_duration) : -1;
+
+    // the shorter part starts with the longer one, so it is measured without moving the song on
+    tm_map from = *m;
+
+    if (dual_ticks > ticks) {
+        if (ticks >= 0) *duration = tm_span(&from, ticks);
+        *dual_duration = tm_span(m, dual_ticks);
+    } else if (ticks >= 0) {
+        if (dual_ticks >= 0) *dual_duration = tm_span(&from, dual_ticks);
+        *duration = tm_span(m, ticks);
+    }
+}
@@ -0,0 +1,55 @@
+/**
+ * @file tuning.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief pitches written as MIDI note numbers, tuned through a table chosen at build time
+ */
+
+# include "tuning.h"
+
+/**
+ * Converts the frequency of a note part to Q16.16 Hz
+ * @param frequency - a number of Hz, or a pitch made with TN_PITCH
+ * @return the frequency in Q16.16 Hz
+ */
+uint32_t tn_q16(int frequency) {
+
+    if (frequency <= 0) return 0;
+    if (!TN_IS_PITCH(frequency)) return (uint32_t) frequency << 16;
+
+    uint32_t q16 = TN_TABLE[TN_NOTE(frequency)];
+
+    // most pitches are on the note, which needs no multiply
+    if (TN_CENTS(frequency)) q16 = (uint32_t) (((uint64_t) q16 * TN_CENTS_RATIO[frequency & 0x7F] + (1 << 14)) >> 15);
+
+    return q16;
+}
+
+/**
+ * Converts the frequency of a note part to a whole number of Hz
+ * @param frequency - a number of Hz, or a pitch made with TN_PITCH
+ * @return the frequency in Hz, rounded to the nearest
+ */
+int tn_hz(int frequency) {
+    if (!TN_IS_PITCH(frequency)) return frequency;
+    return (int) ((tn_q16(frequency) + 0x8000) >> 16);
+}
+
+/**
+ * Transposes the frequency of a note part
+ * Only pitches can be transposed, so frequencies in Hz are returned as they are
+ * @param frequency - a number of Hz, or a pitch made with TN_PITCH
+ * @param semitones - the number of semitones to transpose by, which may be negative
+ * @return the transposed pitch, clamped to the MIDI notes
+ */
+int tn_transpose(int frequency, int semitones) {
+
+    if (!TN_IS_PITCH(frequency)) return frequency;
+
+    int note = TN_NOTE(frequency) + semitones;
+    if (note < 0) note = 0;
+    if (note > TN_NOTES - 1) note = TN_NOTES - 1;
+
+    return TN_PITCH(note, TN_CENTS(frequency));
+}
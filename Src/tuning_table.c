@@ -0,0 +1,170 @@
+/**
+ * @file tuning_table.c
+ * @brief the frequency of every MIDI note in Q16.16 Hz, with A4 at 440 Hz, for the temperament
+ * chosen by TN_TEMPERAMENT, generated by Tools/tuning_gen.c (do not edit)
+ */
+
+# include "tuning.h"
+
+# if TN_TEMPERAMENT == TN_EQUAL
+
+// twelve tone equal temperament
+const uint32_t TN_TABLE[TN_NOTES] = {
+            535809,     567670,     601425,     637188,     675077,     715219,
+            757749,     802807,     850544,     901120,     954703,    1011473,
+           1071618,    1135340,    1202851,    1274376,    1350154,    1430439,
+           1515497,    1605613,    1701088,    1802240,    1909407,    2022946,
+           2143237,    2270680,    2405702,    2548752,    2700309,    2860878,
+           3030994,    3211227,    3402176,    3604480,    3818814,    4045892,
+           4286473,    4541360,    4811404,    5097505,    5400618,    5721755,
+           6061989,    6422453,    6804352,    7208960,    7637627,    8091784,
+           8572947,    9082720,    9622807,   10195009,   10801236,   11443511,
+          12123977,   12844906,   13608704,   14417920,   15275254,   16183568,
+          17145893,   18165441,   19245614,   20390018,   21602472,   22887021,
+          24247954,   25689813,   27217409,   28835840,   30550508,   32367136,
+          34291786,   36330882,   38491228,   40780036,   43204943,   45774043,
+          48495909,   51379626,   54434817,   57671680,   61101017,   64734272,
+          68583572,   72661764,   76982457,   81560072,   86409886,   91548086,
+          96991818,  102759252,  108869635,  115343360,  122202033,  129468544,
+         137167144,  145323527,  153964914,  163120144,  172819773,  183096171,
+         193983636,  205518503,  217739269,  230686720,  244404066,  258937088,
+         274334289,  290647054,  307929828,  326240288,  345639545,  366192342,
+         387967272,  411037006,  435478539,  461373440,  488808132,  517874176,
+         548668578,  581294109,  615859655,  652480576,  691279090,  732384684,
+         775934544,  822074013
+};
+
+# elif TN_TEMPERAMENT == TN_JUST
+
+// five limit just intonation in C
+const uint32_t TN_TABLE[TN_NOTES] = {
+            540672,     576717,     608256,     648806,     675840,     720896,
+            760320,     811008,     865075,     901120,     973209,    1013760,
+           1081344,    1153433,    1216512,    1297612,    1351680,    1441792,
+           1520640,    1622016,    1730150,    1802240,    1946419,    2027520,
+           2162688,    2306866,    2433024,    2595225,    2703360,    2883584,
+           3041280,    3244031,    3460300,    3604480,    3892837,    4055040,
+           4325375,    4613733,    4866047,    5190449,    5406720,    5767167,
+           6082560,    6488063,    6920599,    7208960,    7785674,    8110080,
+           8650751,    9227466,    9732094,   10380899,   10813440,   11534334,
+          12165120,   12976126,   13841199,   14417920,   15571348,   16220160,
+          17301501,   18454931,   19464189,   20761798,   21626880,   23068668,
+          24330240,   25952252,   27682397,   28835840,   31142697,   32440320,
+          34603002,   36909863,   38928378,   41523596,   43253760,   46137336,
+          48660480,   51904503,   55364794,   57671680,   62285394,   64880640,
+          69206005,   73819726,   77856755,   83047192,   86507520,   92274673,
+          97320960,  103809007,  110729589,  115343360,  124570787,  129761280,
+         138412009,  147639452,  155713510,  166094383,  173015040,  184549345,
+         194641920,  207618013,  221459178,  230686720,  249141575,  259522560,
+         276824018,  295278904,  311427020,  332188767,  346030080,  369098691,
+         389283839,  415236027,  442918356,  461373440,  498283150,  519045119,
+         553648036,  590557808,  622854040,  664377533,  692060160,  738197382,
+         778567679,  830472054
+};
+
+# elif TN_TEMPERAMENT == TN_PYTHAGOREAN
+
+// Pythagorean tuning in C, from Eb to G#
+const uint32_t TN_TABLE[TN_NOTES] = {
+            533997,     562565,     600747,     632885,     675840,     711996,
+            760320,     800996,     843847,     901120,     949328,    1013760,
+           1067994,    1125130,    1201493,    1265771,    1351680,    1423992,
+           1520640,    1601991,    1687694,    1802240,    1898656,    2027520,
+           2135988,    2250259,    2402987,    2531542,    2703360,    2847984,
+           3041280,    3203982,    3375389,    3604480,    3797312,    4055040,
+           4271976,    4500518,    4805973,    5063083,    5406720,    5695968,
+           6082560,    6407964,    6750777,    7208960,    7594625,    8110080,
+           8543953,    9001037,    9611947,   10126166,   10813440,   11391937,
+          12165120,   12815929,   13501555,   14417920,   15189249,   16220160,
+          17087905,   18002073,   19223893,   20252332,   21626880,   22783874,
+          24330240,   25631858,   27003110,   28835840,   30378498,   32440320,
+          34175810,   36004146,   38447787,   40504664,   43253760,   45567747,
+          48660480,   51263716,   54006219,   57671680,   60756996,   64880640,
+          68351621,   72008292,   76895573,   81009329,   86507520,   91135495,
+          97320960,  102527431,  108012438,  115343360,  121513993,  129761280,
+         136703242,  144016584,  153791147,  162018657,  173015040,  182270989,
+         194641920,  205054862,  216024876,  230686720,  243027985,  259522560,
+         273406483,  288033168,  307582293,  324037314,  346030080,  364541978,
+         389283839,  410109725,  432049752,  461373440,  486055971,  519045119,
+         546812967,  576066337,  615164587,  648074628,  692060160,  729083956,
+         778567679,  820219450
+};
+
+# elif TN_TEMPERAMENT == TN_MEANTONE
+
+// quarter comma meantone in C, from Eb to G#
+const uint32_t TN_TABLE[TN_NOTES] = {
+            538996,     563200,     602615,     644789,     673745,     720896,
+            753269,     805986,     842180,     901120,     964185,    1007483,
+           1077991,    1126400,    1205231,    1289578,    1347489,    1441793,
+           1506539,    1611972,    1684361,    1802240,    1928369,    2014966,
+           2155982,    2252800,    2410462,    2579157,    2694978,    2883585,
+           3013078,    3223945,    3368721,    3604480,    3856738,    4029931,
+           4311965,    4505601,    4820923,    5158314,    5389957,    5767170,
+           6026155,    6447889,    6737443,    7208960,    7713476,    8059863,
+           8623929,    9011201,    9641847,   10316627,   10779913,   11534341,
+          12052310,   12895779,   13474886,   14417920,   15426952,   16119726,
+          17247858,   18022403,   19283693,   20633254,   21559826,   23068682,
+          24104620,   25791557,   26949772,   28835840,   30853904,   32239452,
+          34495716,   36044806,   38567386,   41266509,   43119652,   46137363,
+          48209241,   51583114,   53899543,   57671680,   61707808,   64478904,
+          68991432,   72089612,   77134773,   82533017,   86239305,   92274726,
+          96418482,  103166229,  107799087,  115343360,  123415616,  128957808,
+         137982865,  144179224,  154269546,  165066034,  172478610,  184549452,
+         192836964,  206332458,  215598173,  230686720,  246831232,  257915615,
+         275965730,  288358448,  308539091,  330132069,  344957219,  369098904,
+         385673928,  412664916,  431196347,  461373440,  493662465,  515831230,
+         551931460,  576716895,  617078183,  660264138,  689914439,  738197808,
+         771347856,  825329832
+};
+
+# elif TN_TEMPERAMENT == TN_WERCKMEISTER
+
+// Werckmeister III
+const uint32_t TN_TABLE[TN_NOTES] = {
+            539452,     568311,     602785,     639350,     675840,     719269,
+            757749,     806441,     852467,     901120,     959026,    1013760,
+           1078904,    1136623,    1205571,    1278701,    1351680,    1438538,
+           1515497,    1612882,    1704934,    1802240,    1918051,    2027520,
+           2157807,    2273246,    2411141,    2557401,    2703360,    2877077,
+           3030994,    3225765,    3409869,    3604480,    3836102,    4055040,
+           4315615,    4546491,    4822282,    5114803,    5406720,    5754153,
+           6061989,    6451529,    6819737,    7208960,    7672204,    8110080,
+           8631230,    9092983,    9644565,   10229606,   10813440,   11508306,
+          12123977,   12903058,   13639474,   14417920,   15344409,   16220160,
+          17262460,   18185966,   19289130,   20459212,   21626880,   23016613,
+          24247954,   25806116,   27278949,   28835840,   30688817,   32440320,
+          34524919,   36371932,   38578259,   40918423,   43253760,   46033226,
+          48495909,   51612233,   54557898,   57671680,   61377635,   64880640,
+          69049839,   72743863,   77156519,   81836846,   86507520,   92066452,
+          96991818,  103224466,  109115795,  115343360,  122755269,  129761280,
+         138099678,  145487727,  154313037,  163673693,  173015040,  184132904,
+         193983636,  206448932,  218231590,  230686720,  245510539,  259522560,
+         276199356,  290975454,  308626075,  327347385,  346030080,  368265808,
+         387967272,  412897864,  436463180,  461373440,  491021077,  519045119,
+         552398711,  581950907,  617252149,  654694770,  692060160,  736531616,
+         775934544,  825795728
+};
+
+# else
+# error "no tuning table for TN_TEMPERAMENT, regenerate Src/tuning_table.c with Tools/tuning_gen.c"
+# endif
+
+const uint16_t TN_CENTS_RATIO[128] = {
+        31579, 31597, 31615, 31634, 31652, 31670, 31688, 31707,
+        31725, 31743, 31762, 31780, 31798, 31817, 31835, 31854,
+        31872, 31890, 31909, 31927, 31946, 31964, 31983, 32001,
+        32020, 32038, 32057, 32075, 32094, 32112, 32131, 32149,
+        32168, 32186, 32205, 32224, 32242, 32261, 32280, 32298,
+        32317, 32336, 32354, 32373, 32392, 32410, 32429, 32448,
+        32467, 32485, 32504, 32523, 32542, 32560, 32579, 32598,
+        32617, 32636, 32655, 32673, 32692, 32711, 32730, 32749,
+        32768, 32787, 32806, 32825, 32844, 32863, 32882, 32901,
+        32920, 32939, 32958, 32977, 32996, 33015, 33034, 33053,
+        33072, 33091, 33110, 33130, 33149, 33168, 33187, 33206,
+        33225, 33245, 33264, 33283, 33302, 33322, 33341, 33360,
+        33379, 33399, 33418, 33437, 33457, 33476, 33495, 33515,
+        33534, 33553, 33573, 33592, 33611, 33631, 33650, 33670,
+        33689, 33709, 33728, 33748, 33767, 33787, 33806, 33826,
+        33845, 33865, 33884, 33904, 33924, 33943, 33963, 33982
+};
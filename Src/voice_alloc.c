@@ -0,0 +1,126 @@
+/**
+ * @file voice_alloc.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief assigns note-on and note-off events to the voices of an output backend
+ */
+
+# include "voice_alloc.h"
+
+/**
+ * Initializes an allocator with every voice free
+ * @param va - the allocator to initialize
+ * @param voices - the number of voices the backend has, at most VA_MAX_VOICES
+ * @param policy - the policy used to steal a voice when none are free
+ */
+void va_init(voice_allocator *va, int voices, va_policy policy) {
+
+    va->voices = voices < VA_MAX_VOICES ? voices : VA_MAX_VOICES;
+    va->policy = policy;
+    va->clock = 0;
+
+    for (int i = 0; i < VA_MAX_VOICES; i++) {
+        va->voice[i].state = VA_FREE;
+        va->voice[i].key = 0;
+        va->voice[i].level = 0;
+        va->voice[i].age = 0;
+    }
+}
+
+/**
+ * Assigns a voice to a note, stealing one if every voice is busy
+ * @param va - the allocator to assign from
+ * @param key - the key identifying the note for va_note_off
+ * @param level - the loudness of the note, compared by VA_STEAL_QUIETEST
+ * @return the voice the note should play on, or -1 if the allocator has no voices
+ */
+int va_note_on(voice_allocator *va, int key, int level) {
+
+    int best = 0;
+
+    // a backend may have no voices at all, such as one too slow for any
+    if (va->voices <= 0) return -1;
+
+    // one pass picks a free voice, then the longest released voice, then the held voice the
+    // policy gives up, with the oldest voice breaking any tie
+    for (int i = 1; i < va->voices; i++) {
+
+        va_voice *v = &va->voice[i];
+        va_voice *b = &va->voice[best];
+
+        // a lower state means the voice is less busy
+        if (v->state != b->state) {
+            if (v->state < b->state) best = i;
+            continue;
+        }
+
+        // held voices are compared by loudness first when stealing the quietest
+        if (v->state == VA_HELD && va->policy == VA_STEAL_QUIETEST && v->level != b->level) {
+            if (v->level < b->level) best = i;
+            continue;
+        }
+
+        // measure ages against the clock so they compare correctly when it wraps
+        if (va->clock - v->age > va->clock - b->age) best = i;
+    }
+
+    va->voice[best].state = VA_HELD;
+    va->voice[best].key = key;
+    va->voice[best].level = level;
+    va->voice[best].age = va->clock++;
+
+    return best;
+}
+
+/**
+ * Releases the held voice playing a note
+ * @param va - the allocator to release from
+ * @param key - the key the note was started with
+ * @return the voice that was released, or -1 if no held voice plays the note
+ */
+int va_note_off(voice_allocator *va, int key) {
+
+    for (int i = 0; i < va->voices; i++) {
+        if (va->voice[i].state == VA_HELD && va->voice[i].key == key) {
+            va_release(va, i);
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * Releases a voice whose note has ended
+ * @param va - the allocator to release from
+ * @param voice - the voice to release
+ */
+void va_release(voice_allocator *va, int voice) {
+
+    // ignore voices that do not exist or are not playing
+    if (voice < 0 || voice >= va->voices || va->voice[voice].state != VA_HELD) return;
+
+    // restart the age so the tail released first is the first reused
+    va->voice[voice].state = VA_RELEASED;
+    va->voice[voice].age = va->clock++;
+}
+
+/**
+ * Frees a voice that has gone silent
+ * @param va - the allocator to free from
+ * @param voice - the voice to free
+ */
+void va_free(voice_allocator *va, int voice) {
+    if (voice >= 0 && voice < va->voices) va->voice[voice].state = VA_FREE;
+}
+
+/**
+ * Updates the loudness of a voice as its envelope moves
+ * @param va - the allocator the voice belongs to
+ * @param voice - the voice to update
+ * @param level - the new loudness of the voice
+ */
+void va_set_level(voice_allocator *va, int voice, int level) {
+    if (voice >= 0 && voice < va->voices) va->voice[voice].level = level;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file wavetable.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief band-limited, mip-mapped wavetable oscillators stored in flash
+ */
+
+# include <stm32f446xx.h>
+# include "wavetable.h"
+
+# define WT_FRAC_BITS 15
+# define WT_FRAC_SHIFT (32 - WT_SIZE_BITS - WT_FRAC_BITS)
+# define WT_FRAC_MASK ((1 << WT_FRAC_BITS) - 1)
+# define WT_BASE_BITS (32 - WT_SIZE_BITS) // increment bits of the lowest octave
+
+/**
+ * Selects the table of a waveform whose harmonics stay below the Nyquist frequency
+ * @param wave - the waveform
+ * @param inc - the phase increment of the oscillator that will play the table
+ * @return the table for the octave the increment falls in
+ */
+const int16_t * wt_select(wt_wave wave, uint32_t inc) {
+
+    // each octave above a fundamental of rate / WT_SIZE adds one bit to the increment
+    int level = (32 - (int) __CLZ(inc)) - WT_BASE_BITS;
+    if (level < 0) level = 0;
+    if (level >= WT_LEVELS) level = WT_LEVELS - 1;
+
+    return wave == WT_WAVE_SAW ? WT_SAW[level] : WT_SQUARE[level];
+}
+
+/**
+ * Renders an oscillator through a table with linear interpolation, adding it onto a mix
+ * @param osc - the oscillator to render
+ * @param table - the table to render, as returned by wt_select
+ * @param mix - the mix to add the samples to
+ * @param n - the number of samples to render
+ * @param amplitude - the amplitude in Q15
+ */
+void wt_render(dds_osc *osc, const int16_t *table, int32_t *mix, int n, int32_t amplitude) {
+
+    uint32_t phase = osc->phase;
+    uint32_t inc = osc->inc;
+
+    while (n-- > 0) {
+        phase += inc;
+
+        // the top bits index the table and the next 15 interpolate between neighbours
+        uint32_t index = phase >> (32 - WT_SIZE_BITS);
+        int32_t frac = (int32_t) ((phase >> WT_FRAC_SHIFT) & WT_FRAC_MASK);
+        int32_t s0 = table[index];
+        int32_t s = s0 + (((table[index + 1] - s0) * frac) >> WT_FRAC_BITS);
+
+        *mix++ += (s * amplitude) >> 15;
+    }
+
+    osc->phase = phase;
+}
+
+/**
+ * Renders an oscillator through a table without interpolation, adding it onto a mix
+ * Cheaper than wt_render at the cost of more aliasing and noise
+ * @param osc - the oscillator to render
+ * @param table - the table to render, as returned by wt_select
+ * @param mix - the mix to add the samples to
+ * @param n - the number of samples to render
+ * @param amplitude - the amplitude in Q15
+ */
+void wt_render_nearest(dds_osc *osc, const int16_t *table, int32_t *mix, int n, int32_t amplitude) {
+
+    uint32_t phase = osc->phase;
+    uint32_t inc = osc->inc;
+
+    while (n-- > 0) {
+        phase += inc;
+        *mix++ += (table[phase >> (32 - WT_SIZE_BITS)] * amplitude) >> 15;
+    }
+
+    osc->phase = phase;
+}
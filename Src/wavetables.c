@@ -0,0 +1,402 @@
+/**
+ * @file wavetables.c
+ * @brief band-limited wavetables, generated by Tools/wavetable_gen.c (do not edit)
+ */
+
+# include "wavetable.h"
+
+/**
+ * Band-limited square wave, one table per octave
+ */
+const int16_t WT_SQUARE[WT_LEVELS][WT_SIZE + 1] = {
+        {
+                     0,  29632,  22689,  26798,  23873,  26146,  24285,  25861,  24494,  25702,  24619,  25601,
+                 24703,  25531,  24762,  25480,  24806,  25441,  24841,  25411,  24868,  25386,  24890,  25366,
+                 24908,  25350,  24923,  25336,  24936,  25324,  24947,  25314,  24956,  25305,  24964,  25298,
+                 24971,  25291,  24977,  25286,  24982,  25281,  24987,  25276,  24991,  25273,  24994,  25269,
+                 24997,  25267,  25000,  25264,  25002,  25262,  25004,  25261,  25005,  25260,  25006,  25259,
+                 25007,  25258,  25008,  25258,  25008,  25258,  25008,  25258,  25007,  25259,  25006,  25260,
+                 25005,  25261,  25004,  25262,  25002,  25264,  25000,  25267,  24997,  25269,  24994,  25273,
+                 24991,  25276,  24987,  25281,  24982,  25286,  24977,  25291,  24971,  25298,  24964,  25305,
+                 24956,  25314,  24947,  25324,  24936,  25336,  24923,  25350,  24908,  25366,  24890,  25386,
+                 24868,  25411,  24841,  25441,  24806,  25480,  24762,  25531,  24703,  25601,  24619,  25702,
+                 24494,  25861,  24285,  26146,  23873,  26798,  22689,  29632,      0, -29632, -22689, -26798,
+                -23873, -26146, -24285, -25861, -24494, -25702, -24619, -25601, -24703, -25531, -24762, -25480,
+                -24806, -25441, -24841, -25411, -24868, -25386, -24890, -25366, -24908, -25350, -24923, -25336,
+                -24936, -25324, -24947, -25314, -24956, -25305, -24964, -25298, -24971, -25291, -24977, -25286,
+                -24982, -25281, -24987, -25276, -24991, -25273, -24994, -25269, -24997, -25267, -25000, -25264,
+                -25002, -25262, -25004, -25261, -25005, -25260, -25006, -25259, -25007, -25258, -25008, -25258,
+                -25008, -25258, -25008, -25258, -25007, -25259, -25006, -25260, -25005, -25261, -25004, -25262,
+                -25002, -25264, -25000, -25267, -24997, -25269, -24994, -25273, -24991, -25276, -24987, -25281,
+                -24982, -25286, -24977, -25291, -24971, -25298, -24964, -25305, -24956, -25314, -24947, -25324,
+                -24936, -25336, -24923, -25350, -24908, -25366, -24890, -25386, -24868, -25411, -24841, -25441,
+                -24806, -25480, -24762, -25531, -24703, -25601, -24619, -25702, -24494, -25861, -24285, -26146,
+                -23873, -26798, -22689, -29632,      0
+        },
+        {
+                     0,  21933,  29633,  25733,  22686,  24894,  26802,  25259,  23866,  25056,  26154,  25185,
+                 24276,  25096,  25872,  25161,  24481,  25111,  25716,  25150,  24603,  25119,  25618,  25144,
+                 24683,  25123,  25552,  25141,  24739,  25126,  25505,  25139,  24779,  25128,  25470,  25137,
+                 24810,  25129,  25444,  25136,  24832,  25130,  25424,  25135,  24849,  25131,  25409,  25135,
+                 24862,  25131,  25398,  25134,  24872,  25132,  25390,  25134,  24878,  25132,  25385,  25133,
+                 24882,  25132,  25383,  25133,  24883,  25133,  25383,  25132,  24882,  25133,  25385,  25132,
+                 24878,  25134,  25390,  25132,  24872,  25134,  25398,  25131,  24862,  25135,  25409,  25131,
+                 24849,  25135,  25424,  25130,  24832,  25136,  25444,  25129,  24810,  25137,  25470,  25128,
+                 24779,  25139,  25505,  25126,  24739,  25141,  25552,  25123,  24683,  25144,  25618,  25119,
+                 24603,  25150,  25716,  25111,  24481,  25161,  25872,  25096,  24276,  25185,  26154,  25056,
+                 23866,  25259,  26802,  24894,  22686,  25733,  29633,  21933,      0, -21933, -29633, -25733,
+                -22686, -24894, -26802, -25259, -23866, -25056, -26154, -25185, -24276, -25096, -25872, -25161,
+                -24481, -25111, -25716, -25150, -24603, -25119, -25618, -25144, -24683, -25123, -25552, -25141,
+                -24739, -25126, -25505, -25139, -24779, -25128, -25470, -25137, -24810, -25129, -25444, -25136,
+                -24832, -25130, -25424, -25135, -24849, -25131, -25409, -25135, -24862, -25131, -25398, -25134,
+                -24872, -25132, -25390, -25134, -24878, -25132, -25385, -25133, -24882, -25132, -25383, -25133,
+                -24883, -25133, -25383, -25132, -24882, -25133, -25385, -25132, -24878, -25134, -25390, -25132,
+                -24872, -25134, -25398, -25131, -24862, -25135, -25409, -25131, -24849, -25135, -25424, -25130,
+                -24832, -25136, -25444, -25129, -24810, -25137, -25470, -25128, -24779, -25139, -25505, -25126,
+                -24739, -25141, -25552, -25123, -24683, -25144, -25618, -25119, -24603, -25150, -25716, -25111,
+                -24481, -25161, -25872, -25096, -24276, -25185, -26154, -25056, -23866, -25259, -26802, -24894,
+                -22686, -25733, -29633, -21933,      0
+        },
+        {
+                     0,  12144,  21935,  27842,  29639,  28352,  25731,  23492,  22674,  23369,  24896,  26288,
+                 26821,  26342,  25257,  24240,  23841,  24210,  25058,  25865,  26185,  25884,  25182,  24508,
+                 24237,  24495,  25098,  25682,  25918,  25691,  25158,  24638,  24428,  24632,  25114,  25586,
+                 25778,  25591,  25147,  24711,  24532,  24707,  25122,  25531,  25699,  25534,  25141,  24752,
+                 24592,  24750,  25127,  25501,  25655,  25502,  25137,  24773,  24623,  24772,  25130,  25487,
+                 25635,  25488,  25134,  24780,  24633,  24780,  25134,  25488,  25635,  25487,  25130,  24772,
+                 24623,  24773,  25137,  25502,  25655,  25501,  25127,  24750,  24592,  24752,  25141,  25534,
+                 25699,  25531,  25122,  24707,  24532,  24711,  25147,  25591,  25778,  25586,  25114,  24632,
+                 24428,  24638,  25158,  25691,  25918,  25682,  25098,  24495,  24237,  24508,  25182,  25884,
+                 26185,  25865,  25058,  24210,  23841,  24240,  25257,  26342,  26821,  26288,  24896,  23369,
+                 22674,  23492,  25731,  28352,  29639,  27842,  21935,  12144,      0, -12144, -21935, -27842,
+                -29639, -28352, -25731, -23492, -22674, -23369, -24896, -26288, -26821, -26342, -25257, -24240,
+                -23841, -24210, -25058, -25865, -26185, -25884, -25182, -24508, -24237, -24495, -25098, -25682,
+                -25918, -25691, -25158, -24638, -24428, -24632, -25114, -25586, -25778, -25591, -25147, -24711,
+                -24532, -24707, -25122, -25531, -25699, -25534, -25141, -24752, -24592, -24750, -25127, -25501,
+                -25655, -25502, -25137, -24773, -24623, -24772, -25130, -25487, -25635, -25488, -25134, -24780,
+                -24633, -24780, -25134, -25488, -25635, -25487, -25130, -24772, -24623, -24773, -25137, -25502,
+                -25655, -25501, -25127, -24750, -24592, -24752, -25141, -25534, -25699, -25531, -25122, -24707,
+                -24532, -24711, -25147, -25591, -25778, -25586, -25114, -24632, -24428, -24638, -25158, -25691,
+                -25918, -25682, -25098, -24495, -24237, -24508, -25182, -25884, -26185, -25865, -25058, -24210,
+                -23841, -24240, -25257, -26342, -26821, -26288, -24896, -23369, -22674, -23492, -25731, -28352,
+                -29639, -27842, -21935, -12144,      0
+        },
+        {
+                     0,   6230,  12145,  17460,  21943,  25434,  27861,  29238,  29664,  29303,  28369,  27097,
+                 25723,  24455,  23456,  22831,  22624,  22815,  23335,  24074,  24905,  25699,  26344,  26758,
+                 26898,  26764,  26395,  25859,  25247,  24653,  24162,  23844,  23734,  23840,  24136,  24568,
+                 25069,  25559,  25967,  26234,  26327,  26236,  25982,  25606,  25170,  24739,  24377,  24139,
+                 24056,  24138,  24369,  24712,  25113,  25512,  25847,  26070,  26148,  26071,  25851,  25524,
+                 25139,  24755,  24430,  24213,  24137,  24213,  24430,  24755,  25139,  25524,  25851,  26071,
+                 26148,  26070,  25847,  25512,  25113,  24712,  24369,  24138,  24056,  24139,  24377,  24739,
+                 25170,  25606,  25982,  26236,  26327,  26234,  25967,  25559,  25069,  24568,  24136,  23840,
+                 23734,  23844,  24162,  24653,  25247,  25859,  26395,  26764,  26898,  26758,  26344,  25699,
+                 24905,  24074,  23335,  22815,  22624,  22831,  23456,  24455,  25723,  27097,  28369,  29303,
+                 29664,  29238,  27861,  25434,  21943,  17460,  12145,   6230,      0,  -6230, -12145, -17460,
+                -21943, -25434, -27861, -29238, -29664, -29303, -28369, -27097, -25723, -24455, -23456, -22831,
+                -22624, -22815, -23335, -24074, -24905, -25699, -26344, -26758, -26898, -26764, -26395, -25859,
+                -25247, -24653, -24162, -23844, -23734, -23840, -24136, -24568, -25069, -25559, -25967, -26234,
+                -26327, -26236, -25982, -25606, -25170, -24739, -24377, -24139, -24056, -24138, -24369, -24712,
+                -25113, -25512, -25847, -26070, -26148, -26071, -25851, -25524, -25139, -24755, -24430, -24213,
+                -24137, -24213, -24430, -24755, -25139, -25524, -25851, -26071, -26148, -26070, -25847, -25512,
+                -25113, -24712, -24369, -24138, -24056, -24139, -24377, -24739, -25170, -25606, -25982, -26236,
+                -26327, -26234, -25967, -25559, -25069, -24568, -24136, -23840, -23734, -23844, -24162, -24653,
+                -25247, -25859, -26395, -26764, -26898, -26758, -26344, -25699, -24905, -24074, -23335, -22815,
+                -22624, -22831, -23456, -24455, -25723, -27097, -28369, -29303, -29664, -29238, -27861, -25434,
+                -21943, -17460, -12145,  -6230,      0
+        },
+        {
+                     0,   3135,   6230,   9248,  12150,  14903,  17475,  19840,  21974,  23860,  25486,  26845,
+                 27935,  28761,  29330,  29658,  29763,  29666,  29394,  28973,  28433,  27805,  27118,  26403,
+                 25688,  24998,  24357,  23786,  23301,  22914,  22635,  22467,  22412,  22465,  22621,  22867,
+                 23192,  23580,  24015,  24478,  24951,  25416,  25857,  26257,  26603,  26884,  27089,  27215,
+                 27256,  27215,  27094,  26898,  26637,  26322,  25964,  25579,  25180,  24783,  24403,  24054,
+                 23749,  23499,  23314,  23200,  23162,  23200,  23314,  23499,  23749,  24054,  24403,  24783,
+                 25180,  25579,  25964,  26322,  26637,  26898,  27094,  27215,  27256,  27215,  27089,  26884,
+                 26603,  26257,  25857,  25416,  24951,  24478,  24015,  23580,  23192,  22867,  22621,  22465,
+                 22412,  22467,  22635,  22914,  23301,  23786,  24357,  24998,  25688,  26403,  27118,  27805,
+                 28433,  28973,  29394,  29666,  29763,  29658,  29330,  28761,  27935,  26845,  25486,  23860,
+                 21974,  19840,  17475,  14903,  12150,   9248,   6230,   3135,      0,  -3135,  -6230,  -9248,
+                -12150, -14903, -17475, -19840, -21974, -23860, -25486, -26845, -27935, -28761, -29330, -29658,
+                -29763, -29666, -29394, -28973, -28433, -27805, -27118, -26403, -25688, -24998, -24357, -23786,
+                -23301, -22914, -22635, -22467, -22412, -22465, -22621, -22867, -23192, -23580, -24015, -24478,
+                -24951, -25416, -25857, -26257, -26603, -26884, -27089, -27215, -27256, -27215, -27094, -26898,
+                -26637, -26322, -25964, -25579, -25180, -24783, -24403, -24054, -23749, -23499, -23314, -23200,
+                -23162, -23200, -23314, -23499, -23749, -24054, -24403, -24783, -25180, -25579, -25964, -26322,
+                -26637, -26898, -27094, -27215, -27256, -27215, -27089, -26884, -26603, -26257, -25857, -25416,
+                -24951, -24478, -24015, -23580, -23192, -22867, -22621, -22465, -22412, -22467, -22635, -22914,
+                -23301, -23786, -24357, -24998, -25688, -26403, -27118, -27805, -28433, -28973, -29394, -29666,
+                -29763, -29658, -29330, -28761, -27935, -26845, -25486, -23860, -21974, -19840, -17475, -14903,
+                -12150,  -9248,  -6230,  -3135,      0
+        },
+        {
+                     0,   1570,   3135,   4691,   6233,   7756,   9256,  10728,  12169,  13574,  14939,  16260,
+                 17535,  18759,  19930,  21044,  22101,  23096,  24029,  24897,  25700,  26436,  27105,  27706,
+                 28240,  28706,  29106,  29439,  29708,  29913,  30057,  30142,  30170,  30143,  30065,  29937,
+                 29765,  29550,  29296,  29008,  28688,  28341,  27971,  27581,  27176,  26760,  26336,  25909,
+                 25482,  25060,  24646,  24243,  23855,  23486,  23138,  22813,  22516,  22248,  22011,  21807,
+                 21639,  21506,  21410,  21353,  21333,  21353,  21410,  21506,  21639,  21807,  22011,  22248,
+                 22516,  22813,  23138,  23486,  23855,  24243,  24646,  25060,  25482,  25909,  26336,  26760,
+                 27176,  27581,  27971,  28341,  28688,  29008,  29296,  29550,  29765,  29937,  30065,  30143,
+                 30170,  30142,  30057,  29913,  29708,  29439,  29106,  28706,  28240,  27706,  27105,  26436,
+                 25700,  24897,  24029,  23096,  22101,  21044,  19930,  18759,  17535,  16260,  14939,  13574,
+                 12169,  10728,   9256,   7756,   6233,   4691,   3135,   1570,      0,  -1570,  -3135,  -4691,
+                 -6233,  -7756,  -9256, -10728, -12169, -13574, -14939, -16260, -17535, -18759, -19930, -21044,
+                -22101, -23096, -24029, -24897, -25700, -26436, -27105, -27706, -28240, -28706, -29106, -29439,
+                -29708, -29913, -30057, -30142, -30170, -30143, -30065, -29937, -29765, -29550, -29296, -29008,
+                -28688, -28341, -27971, -27581, -27176, -26760, -26336, -25909, -25482, -25060, -24646, -24243,
+                -23855, -23486, -23138, -22813, -22516, -22248, -22011, -21807, -21639, -21506, -21410, -21353,
+                -21333, -21353, -21410, -21506, -21639, -21807, -22011, -22248, -22516, -22813, -23138, -23486,
+                -23855, -24243, -24646, -25060, -25482, -25909, -26336, -26760, -27176, -27581, -27971, -28341,
+                -28688, -29008, -29296, -29550, -29765, -29937, -30065, -30143, -30170, -30142, -30057, -29913,
+                -29708, -29439, -29106, -28706, -28240, -27706, -27105, -26436, -25700, -24897, -24029, -23096,
+                -22101, -21044, -19930, -18759, -17535, -16260, -14939, -13574, -12169, -10728,  -9256,  -7756,
+                 -6233,  -4691,  -3135,  -1570,      0
+        },
+        {
+                     0,    785,   1570,   2354,   3137,   3917,   4695,   5471,   6243,   7011,   7775,   8535,
+                  9289,  10038,  10780,  11517,  12246,  12968,  13682,  14388,  15085,  15773,  16451,  17120,
+                 17778,  18426,  19062,  19687,  20301,  20902,  21490,  22065,  22627,  23176,  23710,  24231,
+                 24736,  25227,  25703,  26163,  26607,  27035,  27447,  27843,  28221,  28583,  28928,  29255,
+                 29564,  29856,  30129,  30385,  30622,  30841,  31041,  31222,  31385,  31529,  31654,  31759,
+                 31846,  31913,  31961,  31990,  32000,  31990,  31961,  31913,  31846,  31759,  31654,  31529,
+                 31385,  31222,  31041,  30841,  30622,  30385,  30129,  29856,  29564,  29255,  28928,  28583,
+                 28221,  27843,  27447,  27035,  26607,  26163,  25703,  25227,  24736,  24231,  23710,  23176,
+                 22627,  22065,  21490,  20902,  20301,  19687,  19062,  18426,  17778,  17120,  16451,  15773,
+                 15085,  14388,  13682,  12968,  12246,  11517,  10780,  10038,   9289,   8535,   7775,   7011,
+                  6243,   5471,   4695,   3917,   3137,   2354,   1570,    785,      0,   -785,  -1570,  -2354,
+                 -3137,  -3917,  -4695,  -5471,  -6243,  -7011,  -7775,  -8535,  -9289, -10038, -10780, -11517,
+                -12246, -12968, -13682, -14388, -15085, -15773, -16451, -17120, -17778, -18426, -19062, -19687,
+                -20301, -20902, -21490, -22065, -22627, -23176, -23710, -24231, -24736, -25227, -25703, -26163,
+                -26607, -27035, -27447, -27843, -28221, -28583, -28928, -29255, -29564, -29856, -30129, -30385,
+                -30622, -30841, -31041, -31222, -31385, -31529, -31654, -31759, -31846, -31913, -31961, -31990,
+                -32000, -31990, -31961, -31913, -31846, -31759, -31654, -31529, -31385, -31222, -31041, -30841,
+                -30622, -30385, -30129, -29856, -29564, -29255, -28928, -28583, -28221, -27843, -27447, -27035,
+                -26607, -26163, -25703, -25227, -24736, -24231, -23710, -23176, -22627, -22065, -21490, -20902,
+                -20301, -19687, -19062, -18426, -17778, -17120, -16451, -15773, -15085, -14388, -13682, -12968,
+                -12246, -11517, -10780, -10038,  -9289,  -8535,  -7775,  -7011,  -6243,  -5471,  -4695,  -3917,
+                 -3137,  -2354,  -1570,   -785,      0
+        },
+        {
+                     0,    785,   1570,   2354,   3137,   3917,   4695,   5471,   6243,   7011,   7775,   8535,
+                  9289,  10038,  10780,  11517,  12246,  12968,  13682,  14388,  15085,  15773,  16451,  17120,
+                 17778,  18426,  19062,  19687,  20301,  20902,  21490,  22065,  22627,  23176,  23710,  24231,
+                 24736,  25227,  25703,  26163,  26607,  27035,  27447,  27843,  28221,  28583,  28928,  29255,
+                 29564,  29856,  30129,  30385,  30622,  30841,  31041,  31222,  31385,  31529,  31654,  31759,
+                 31846,  31913,  31961,  31990,  32000,  31990,  31961,  31913,  31846,  31759,  31654,  31529,
+                 31385,  31222,  31041,  30841,  30622,  30385,  30129,  29856,  29564,  29255,  28928,  28583,
+                 28221,  27843,  27447,  27035,  26607,  26163,  25703,  25227,  24736,  24231,  23710,  23176,
+                 22627,  22065,  21490,  20902,  20301,  19687,  19062,  18426,  17778,  17120,  16451,  15773,
+                 15085,  14388,  13682,  12968,  12246,  11517,  10780,  10038,   9289,   8535,   7775,   7011,
+                  6243,   5471,   4695,   3917,   3137,   2354,   1570,    785,      0,   -785,  -1570,  -2354,
+                 -3137,  -3917,  -4695,  -5471,  -6243,  -7011,  -7775,  -8535,  -9289, -10038, -10780, -11517,
+                -12246, -12968, -13682, -14388, -15085, -15773, -16451, -17120, -17778, -18426, -19062, -19687,
+                -20301, -20902, -21490, -22065, -22627, -23176, -23710, -24231, -24736, -25227, -25703, -26163,
+                -26607, -27035, -27447, -27843, -28221, -28583, -28928, -29255, -29564, -29856, -30129, -30385,
+                -30622, -30841, -31041, -31222, -31385, -31529, -31654, -31759, -31846, -31913, -31961, -31990,
+                -32000, -31990, -31961, -31913, -31846, -31759, -31654, -31529, -31385, -31222, -31041, -30841,
+                -30622, -30385, -30129, -29856, -29564, -29255, -28928, -28583, -28221, -27843, -27447, -27035,
+                -26607, -26163, -25703, -25227, -24736, -24231, -23710, -23176, -22627, -22065, -21490, -20902,
+                -20301, -19687, -19062, -18426, -17778, -17120, -16451, -15773, -15085, -14388, -13682, -12968,
+                -12246, -11517, -10780, -10038,  -9289,  -8535,  -7775,  -7011,  -6243,  -5471,  -4695,  -3917,
+                 -3137,  -2354,  -1570,   -785,      0
+        }
+};
+
+/**
+ * Band-limited sawtooth wave, one table per octave
+ */
+const int16_t WT_SAW[WT_LEVELS][WT_SIZE + 1] = {
+        {
+                     0,    214,    425,    643,    851,   1071,   1276,   1500,   1701,   1929,   2126,   2357,
+                  2551,   2786,   2977,   3215,   3402,   3643,   3827,   4072,   4252,   4501,   4677,   4929,
+                  5103,   5358,   5528,   5787,   5953,   6216,   6378,   6645,   6803,   7073,   7228,   7502,
+                  7653,   7931,   8077,   8360,   8502,   8789,   8927,   9219,   9352,   9648,   9776,  10077,
+                 10201,  10506,  10625,  10936,  11050,  11365,  11474,  11795,  11898,  12225,  12322,  12654,
+                 12746,  13084,  13170,  13515,  13594,  13945,  14017,  14375,  14441,  14806,  14864,  15237,
+                 15287,  15668,  15709,  16099,  16132,  16531,  16554,  16963,  16975,  17395,  17397,  17828,
+                 17818,  18261,  18238,  18695,  18658,  19129,  19077,  19564,  19495,  20000,  19912,  20438,
+                 20329,  20876,  20743,  21316,  21157,  21757,  21568,  22201,  21976,  22648,  22382,  23098,
+                 22783,  23554,  23179,  24015,  23567,  24486,  23944,  24970,  24304,  25475,  24639,  26013,
+                 24928,  26615,  25127,  27353,  25103,  28491,  24242,  32000,      0, -32000, -24242, -28491,
+                -25103, -27353, -25127, -26615, -24928, -26013, -24639, -25475, -24304, -24970, -23944, -24486,
+                -23567, -24015, -23179, -23554, -22783, -23098, -22382, -22648, -21976, -22201, -21568, -21757,
+                -21157, -21316, -20743, -20876, -20329, -20438, -19912, -20000, -19495, -19564, -19077, -19129,
+                -18658, -18695, -18238, -18261, -17818, -17828, -17397, -17395, -16975, -16963, -16554, -16531,
+                -16132, -16099, -15709, -15668, -15287, -15237, -14864, -14806, -14441, -14375, -14017, -13945,
+                -13594, -13515, -13170, -13084, -12746, -12654, -12322, -12225, -11898, -11795, -11474, -11365,
+                -11050, -10936, -10625, -10506, -10201, -10077,  -9776,  -9648,  -9352,  -9219,  -8927,  -8789,
+                 -8502,  -8360,  -8077,  -7931,  -7653,  -7502,  -7228,  -7073,  -6803,  -6645,  -6378,  -6216,
+                 -5953,  -5787,  -5528,  -5358,  -5103,  -4929,  -4677,  -4501,  -4252,  -4072,  -3827,  -3643,
+                 -3402,  -3215,  -2977,  -2786,  -2551,  -2357,  -2126,  -1929,  -1701,  -1500,  -1276,  -1071,
+                  -851,   -643,   -425,   -214,      0
+        },
+        {
+                     0,     79,    430,    775,    847,    932,   1291,   1629,   1694,   1786,   2151,   2483,
+                  2541,   2640,   3012,   3337,   3388,   3494,   3873,   4191,   4235,   4348,   4734,   5044,
+                  5082,   5202,   5595,   5898,   5928,   6056,   6456,   6752,   6775,   6910,   7318,   7606,
+                  7620,   7764,   8180,   8460,   8466,   8618,   9042,   9313,   9311,   9471,   9905,  10167,
+                 10155,  10325,  10769,  11021,  10999,  11179,  11633,  11875,  11842,  12033,  12498,  12728,
+                 12685,  12887,  13364,  13582,  13526,  13741,  14231,  14436,  14366,  14596,  15100,  15289,
+                 15204,  15450,  15970,  16143,  16040,  16304,  16843,  16996,  16874,  17158,  17719,  17850,
+                 17704,  18013,  18598,  18703,  18531,  18867,  19482,  19556,  19352,  19722,  20372,  20408,
+                 20165,  20578,  21271,  21260,  20967,  21434,  22184,  22111,  21753,  22291,  23117,  22960,
+                 22513,  23151,  24085,  23806,  23227,  24017,  25115,  24643,  23851,  24897,  26282,  25453,
+                 24252,  25831,  27848,  26131,  23817,  27201,  31786,  23766,      0, -23766, -31786, -27201,
+                -23817, -26131, -27848, -25831, -24252, -25453, -26282, -24897, -23851, -24643, -25115, -24017,
+                -23227, -23806, -24085, -23151, -22513, -22960, -23117, -22291, -21753, -22111, -22184, -21434,
+                -20967, -21260, -21271, -20578, -20165, -20408, -20372, -19722, -19352, -19556, -19482, -18867,
+                -18531, -18703, -18598, -18013, -17704, -17850, -17719, -17158, -16874, -16996, -16843, -16304,
+                -16040, -16143, -15970, -15450, -15204, -15289, -15100, -14596, -14366, -14436, -14231, -13741,
+                -13526, -13582, -13364, -12887, -12685, -12728, -12498, -12033, -11842, -11875, -11633, -11179,
+                -10999, -11021, -10769, -10325, -10155, -10167,  -9905,  -9471,  -9311,  -9313,  -9042,  -8618,
+                 -8466,  -8460,  -8180,  -7764,  -7620,  -7606,  -7318,  -6910,  -6775,  -6752,  -6456,  -6056,
+                 -5928,  -5898,  -5595,  -5202,  -5082,  -5044,  -4734,  -4348,  -4235,  -4191,  -3873,  -3494,
+                 -3388,  -3337,  -3012,  -2640,  -2541,  -2483,  -2151,  -1786,  -1694,  -1629,  -1291,   -932,
+                  -847,   -775,   -430,    -79,      0
+        },
+        {
+                     0,     22,    159,    458,    867,   1268,   1548,   1667,   1681,   1711,   1867,   2185,
+                  2602,   2995,   3256,   3355,   3361,   3399,   3575,   3912,   4337,   4722,   4963,   5043,
+                  5041,   5087,   5283,   5641,   6074,   6451,   6671,   6729,   6718,   6773,   6991,   7371,
+                  7813,   8180,   8378,   8414,   8393,   8458,   8699,   9103,   9555,   9912,  10085,  10096,
+                 10065,  10140,  10408,  10838,  11302,  11647,  11792,  11774,  11731,  11819,  12117,  12577,
+                 13054,  13386,  13498,  13447,  13390,  13492,  13826,  14323,  14815,  15131,  15204,  15113,
+                 15039,  15159,  15536,  16078,  16589,  16886,  16909,  16767,  16671,  16814,  17247,  17848,
+                 18384,  18654,  18612,  18402,  18277,  18451,  18961,  19641,  20212,  20446,  20312,  20005,
+                 19839,  20057,  20680,  21480,  22103,  22280,  22003,  21543,  21309,  21601,  22414,  23418,
+                 24131,  24207,  23667,  22921,  22558,  22997,  24202,  25643,  26557,  26394,  25199,  23695,
+                 22969,  23873,  26426,  29555,  31355,  29811,  23687,  13181,      0, -13181, -23687, -29811,
+                -31355, -29555, -26426, -23873, -22969, -23695, -25199, -26394, -26557, -25643, -24202, -22997,
+                -22558, -22921, -23667, -24207, -24131, -23418, -22414, -21601, -21309, -21543, -22003, -22280,
+                -22103, -21480, -20680, -20057, -19839, -20005, -20312, -20446, -20212, -19641, -18961, -18451,
+                -18277, -18402, -18612, -18654, -18384, -17848, -17247, -16814, -16671, -16767, -16909, -16886,
+                -16589, -16078, -15536, -15159, -15039, -15113, -15204, -15131, -14815, -14323, -13826, -13492,
+                -13390, -13447, -13498, -13386, -13054, -12577, -12117, -11819, -11731, -11774, -11792, -11647,
+                -11302, -10838, -10408, -10140, -10065, -10096, -10085,  -9912,  -9555,  -9103,  -8699,  -8458,
+                 -8393,  -8414,  -8378,  -8180,  -7813,  -7371,  -6991,  -6773,  -6718,  -6729,  -6671,  -6451,
+                 -6074,  -5641,  -5283,  -5087,  -5041,  -5043,  -4963,  -4722,  -4337,  -3912,  -3575,  -3399,
+                 -3361,  -3355,  -3256,  -2995,  -2602,  -2185,  -1867,  -1711,  -1681,  -1667,  -1548,  -1268,
+                  -867,   -458,   -159,    -22,      0
+        },
+        {
+                     0,      6,     45,    146,    327,    594,    937,   1336,   1761,   2178,   2554,   2863,
+                  3088,   3228,   3294,   3310,   3308,   3322,   3384,   3521,   3744,   4052,   4431,   4854,
+                  5288,   5696,   6048,   6320,   6501,   6598,   6627,   6618,   6606,   6629,   6718,   6893,
+                  7162,   7517,   7935,   8385,   8828,   9227,   9551,   9781,   9913,   9959,   9944,   9906,
+                  9884,   9918,  10037,  10258,  10583,  10994,  11461,  11944,  12399,  12786,  13075,  13252,
+                 13321,  13302,  13232,  13155,  13120,  13168,  13327,  13610,  14009,  14496,  15030,  15558,
+                 16029,  16399,  16639,  16742,  16720,  16608,  16456,  16324,  16269,  16337,  16558,  16936,
+                 17451,  18057,  18695,  19296,  19793,  20136,  20295,  20270,  20092,  19817,  19522,  19289,
+                 19197,  19304,  19642,  20204,  20946,  21794,  22648,  23401,  23955,  24236,  24209,  23887,
+                 23332,  22651,  21984,  21483,  21288,  21511,  22206,  23359,  24878,  26597,  28287,  29679,
+                 30488,  30451,  29352,  27057,  23528,  18836,  13159,   6767,      0,  -6767, -13159, -18836,
+                -23528, -27057, -29352, -30451, -30488, -29679, -28287, -26597, -24878, -23359, -22206, -21511,
+                -21288, -21483, -21984, -22651, -23332, -23887, -24209, -24236, -23955, -23401, -22648, -21794,
+                -20946, -20204, -19642, -19304, -19197, -19289, -19522, -19817, -20092, -20270, -20295, -20136,
+                -19793, -19296, -18695, -18057, -17451, -16936, -16558, -16337, -16269, -16324, -16456, -16608,
+                -16720, -16742, -16639, -16399, -16029, -15558, -15030, -14496, -14009, -13610, -13327, -13168,
+                -13120, -13155, -13232, -13302, -13321, -13252, -13075, -12786, -12399, -11944, -11461, -10994,
+                -10583, -10258, -10037,  -9918,  -9884,  -9906,  -9944,  -9959,  -9913,  -9781,  -9551,  -9227,
+                 -8828,  -8385,  -7935,  -7517,  -7162,  -6893,  -6718,  -6629,  -6606,  -6618,  -6627,  -6598,
+                 -6501,  -6320,  -6048,  -5696,  -5288,  -4854,  -4431,  -4052,  -3744,  -3521,  -3384,  -3322,
+                 -3308,  -3310,  -3294,  -3228,  -3088,  -2863,  -2554,  -2178,  -1761,  -1336,   -937,   -594,
+                  -327,   -146,    -45,     -6,      0
+        },
+        {
+                     0,      2,     12,     41,     95,    183,    309,    476,    689,    945,   1244,   1583,
+                  1955,   2354,   2772,   3200,   3630,   4051,   4455,   4833,   5178,   5485,   5748,   5965,
+                  6137,   6264,   6349,   6399,   6419,   6419,   6406,   6392,   6385,   6395,   6431,   6502,
+                  6614,   6771,   6977,   7233,   7538,   7887,   8276,   8698,   9144,   9604,  10069,  10526,
+                 10965,  11376,  11751,  12080,  12359,  12584,  12753,  12867,  12930,  12946,  12924,  12873,
+                 12804,  12729,  12660,  12610,  12590,  12613,  12687,  12819,  13015,  13278,  13606,  13997,
+                 14445,  14941,  15474,  16032,  16600,  17163,  17705,  18211,  18667,  19061,  19382,  19622,
+                 19778,  19848,  19835,  19745,  19588,  19378,  19130,  18864,  18600,  18358,  18161,  18029,
+                 17981,  18034,  18201,  18492,  18912,  19460,  20131,  20913,  21790,  22739,  23734,  24744,
+                 25733,  26665,  27501,  28201,  28727,  29043,  29115,  28914,  28416,  27603,  26464,  24995,
+                 23201,  21092,  18690,  16019,  13114,  10013,   6761,   3407,      0,  -3407,  -6761, -10013,
+                -13114, -16019, -18690, -21092, -23201, -24995, -26464, -27603, -28416, -28914, -29115, -29043,
+                -28727, -28201, -27501, -26665, -25733, -24744, -23734, -22739, -21790, -20913, -20131, -19460,
+                -18912, -18492, -18201, -18034, -17981, -18029, -18161, -18358, -18600, -18864, -19130, -19378,
+                -19588, -19745, -19835, -19848, -19778, -19622, -19382, -19061, -18667, -18211, -17705, -17163,
+                -16600, -16032, -15474, -14941, -14445, -13997, -13606, -13278, -13015, -12819, -12687, -12613,
+                -12590, -12610, -12660, -12729, -12804, -12873, -12924, -12946, -12930, -12867, -12753, -12584,
+                -12359, -12080, -11751, -11376, -10965, -10526, -10069,  -9604,  -9144,  -8698,  -8276,  -7887,
+                 -7538,  -7233,  -6977,  -6771,  -6614,  -6502,  -6431,  -6395,  -6385,  -6392,  -6406,  -6419,
+                 -6419,  -6399,  -6349,  -6264,  -6137,  -5965,  -5748,  -5485,  -5178,  -4833,  -4455,  -4051,
+                 -3630,  -3200,  -2772,  -2354,  -1955,  -1583,  -1244,   -945,   -689,   -476,   -309,   -183,
+                   -95,    -41,    -12,     -2,      0
+        },
+        {
+                     0,      0,      3,     12,     27,     53,     91,    143,    212,    298,    405,    532,
+                   682,    855,   1051,   1271,   1515,   1783,   2073,   2387,   2721,   3075,   3448,   3837,
+                  4240,   4656,   5082,   5516,   5954,   6395,   6835,   7272,   7702,   8125,   8536,   8933,
+                  9313,   9676,  10018,  10338,  10634,  10905,  11150,  11368,  11558,  11722,  11858,  11967,
+                 12050,  12109,  12145,  12158,  12153,  12130,  12093,  12044,  11986,  11922,  11856,  11791,
+                 11730,  11676,  11634,  11606,  11596,  11607,  11642,  11704,  11795,  11917,  12074,  12265,
+                 12493,  12758,  13061,  13403,  13782,  14198,  14649,  15135,  15653,  16200,  16774,  17370,
+                 17986,  18617,  19259,  19906,  20555,  21198,  21832,  22449,  23046,  23614,  24150,  24646,
+                 25097,  25498,  25842,  26126,  26343,  26489,  26560,  26552,  26461,  26285,  26020,  25665,
+                 25219,  24681,  24050,  23327,  22512,  21608,  20616,  19539,  18381,  17145,  15836,  14459,
+                 13018,  11521,   9972,   8379,   6749,   5089,   3405,   1706,      0,  -1706,  -3405,  -5089,
+                 -6749,  -8379,  -9972, -11521, -13018, -14459, -15836, -17145, -18381, -19539, -20616, -21608,
+                -22512, -23327, -24050, -24681, -25219, -25665, -26020, -26285, -26461, -26552, -26560, -26489,
+                -26343, -26126, -25842, -25498, -25097, -24646, -24150, -23614, -23046, -22449, -21832, -21198,
+                -20555, -19906, -19259, -18617, -17986, -17370, -16774, -16200, -15653, -15135, -14649, -14198,
+                -13782, -13403, -13061, -12758, -12493, -12265, -12074, -11917, -11795, -11704, -11642, -11607,
+                -11596, -11606, -11634, -11676, -11730, -11791, -11856, -11922, -11986, -12044, -12093, -12130,
+                -12153, -12158, -12145, -12109, -12050, -11967, -11858, -11722, -11558, -11368, -11150, -10905,
+                -10634, -10338, -10018,  -9676,  -9313,  -8933,  -8536,  -8125,  -7702,  -7272,  -6835,  -6395,
+                 -5954,  -5516,  -5082,  -4656,  -4240,  -3837,  -3448,  -3075,  -2721,  -2387,  -2073,  -1783,
+                 -1515,  -1271,  -1051,   -855,   -682,   -532,   -405,   -298,   -212,   -143,    -91,    -53,
+                   -27,    -12,     -3,      0,      0
+        },
+        {
+                     0,      0,      1,      3,      8,     16,     28,     44,     65,     93,    127,    168,
+                   217,    275,    343,    419,    507,    605,    714,    835,    968,   1114,   1272,   1444,
+                  1629,   1827,   2039,   2265,   2505,   2759,   3026,   3307,   3603,   3911,   4233,   4568,
+                  4916,   5276,   5649,   6033,   6428,   6834,   7250,   7675,   8109,   8552,   9001,   9458,
+                  9921,  10388,  10860,  11336,  11814,  12293,  12773,  13253,  13732,  14208,  14682,  15151,
+                 15614,  16071,  16521,  16963,  17395,  17816,  18226,  18624,  19008,  19377,  19731,  20069,
+                 20389,  20691,  20973,  21236,  21478,  21698,  21895,  22070,  22220,  22347,  22448,  22523,
+                 22572,  22595,  22590,  22558,  22498,  22410,  22294,  22150,  21976,  21775,  21544,  21285,
+                 20997,  20681,  20337,  19965,  19565,  19138,  18685,  18205,  17699,  17168,  16613,  16034,
+                 15431,  14807,  14160,  13493,  12807,  12101,  11378,  10637,   9881,   9111,   8326,   7530,
+                  6722,   5904,   5077,   4243,   3402,   2556,   1706,    854,      0,   -854,  -1706,  -2556,
+                 -3402,  -4243,  -5077,  -5904,  -6722,  -7530,  -8326,  -9111,  -9881, -10637, -11378, -12101,
+                -12807, -13493, -14160, -14807, -15431, -16034, -16613, -17168, -17699, -18205, -18685, -19138,
+                -19565, -19965, -20337, -20681, -20997, -21285, -21544, -21775, -21976, -22150, -22294, -22410,
+                -22498, -22558, -22590, -22595, -22572, -22523, -22448, -22347, -22220, -22070, -21895, -21698,
+                -21478, -21236, -20973, -20691, -20389, -20069, -19731, -19377, -19008, -18624, -18226, -17816,
+                -17395, -16963, -16521, -16071, -15614, -15151, -14682, -14208, -13732, -13253, -12773, -12293,
+                -11814, -11336, -10860, -10388,  -9921,  -9458,  -9001,  -8552,  -8109,  -7675,  -7250,  -6834,
+                 -6428,  -6033,  -5649,  -5276,  -4916,  -4568,  -4233,  -3911,  -3603,  -3307,  -3026,  -2759,
+                 -2505,  -2265,  -2039,  -1827,  -1629,  -1444,  -1272,  -1114,   -968,   -835,   -714,   -605,
+                  -507,   -419,   -343,   -275,   -217,   -168,   -127,    -93,    -65,    -44,    -28,    -16,
+                    -8,     -3,     -1,      0,      0
+        },
+        {
+                     0,    427,    854,   1280,   1705,   2129,   2552,   2974,   3394,   3811,   4227,   4639,
+                  5049,   5456,   5860,   6260,   6657,   7049,   7437,   7821,   8200,   8574,   8943,   9306,
+                  9664,  10016,  10362,  10702,  11035,  11362,  11682,  11994,  12300,  12598,  12889,  13171,
+                 13446,  13713,  13971,  14222,  14463,  14696,  14920,  15135,  15341,  15537,  15725,  15902,
+                 16071,  16229,  16378,  16517,  16646,  16765,  16873,  16972,  17060,  17139,  17206,  17264,
+                 17311,  17347,  17374,  17389,  17395,  17389,  17374,  17347,  17311,  17264,  17206,  17139,
+                 17060,  16972,  16873,  16765,  16646,  16517,  16378,  16229,  16071,  15902,  15725,  15537,
+                 15341,  15135,  14920,  14696,  14463,  14222,  13971,  13713,  13446,  13171,  12889,  12598,
+                 12300,  11994,  11682,  11362,  11035,  10702,  10362,  10016,   9664,   9306,   8943,   8574,
+                  8200,   7821,   7437,   7049,   6657,   6260,   5860,   5456,   5049,   4639,   4227,   3811,
+                  3394,   2974,   2552,   2129,   1705,   1280,    854,    427,      0,   -427,   -854,  -1280,
+                 -1705,  -2129,  -2552,  -2974,  -3394,  -3811,  -4227,  -4639,  -5049,  -5456,  -5860,  -6260,
+                 -6657,  -7049,  -7437,  -7821,  -8200,  -8574,  -8943,  -9306,  -9664, -10016, -10362, -10702,
+                -11035, -11362, -11682, -11994, -12300, -12598, -12889, -13171, -13446, -13713, -13971, -14222,
+                -14463, -14696, -14920, -15135, -15341, -15537, -15725, -15902, -16071, -16229, -16378, -16517,
+                -16646, -16765, -16873, -16972, -17060, -17139, -17206, -17264, -17311, -17347, -17374, -17389,
+                -17395, -17389, -17374, -17347, -17311, -17264, -17206, -17139, -17060, -16972, -16873, -16765,
+                -16646, -16517, -16378, -16229, -16071, -15902, -15725, -15537, -15341, -15135, -14920, -14696,
+                -14463, -14222, -13971, -13713, -13446, -13171, -12889, -12598, -12300, -11994, -11682, -11362,
+                -11035, -10702, -10362, -10016,  -9664,  -9306,  -8943,  -8574,  -8200,  -7821,  -7437,  -7049,
+                 -6657,  -6260,  -5860,  -5456,  -5049,  -4639,  -4227,  -3811,  -3394,  -2974,  -2552,  -2129,
+                 -1705,  -1280,   -854,   -427,      0
+        }
+};
@@ -0,0 +1,198 @@
+/**
+ * @file abc_bench.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a host benchmark of the ABC parser's throughput
+ *
+ * Build and run on the host from the repository root:
+ *     gcc -O2 -IInc -o abc_bench Tools/abc_bench.c
+ *     ./abc_bench [FILE]
+ *
+ * Prints the notes the first tune converts to and a summary of every tune in FILE (the built in
+ * collection unless FILE is given), timed in ms by a tempo map as the music player would, then
+ * times the parser over the whole collection.
+ */
+
+# include <stdio.h>
+# include <stdlib.h>
+# include <time.h>
+
+# include "../Src/abc.c"
+# include "../Src/tempo_map.c"
+# include "../Src/tuning.c"
+# include "../Src/tuning_table.c"
+
+# define BENCH_PASSES 20000
+
+static const char CORPUS[] =
+        "% a few traditional tunes\n"
+        "\n"
+        "X:1\n"
+        "T:The Kesh\n"
+        "R:jig\n"
+        "M:6/8\n"
+        "L:1/8\n"
+        "Q:3/8=120\n"
+        "K:G\n"
+        "|:GAG GAB|ABA ABd|edd gdd|edB dBA|\n"
+        "GAG GAB|ABA ABd|edd gdB|AGF G3:|\n"
+        "|:BAB dBd|ege dBA|BAB dBG|ABA AGA|\n"
+        "BAB dBd|ege dBd|gfg aga|bgg g3:|\n"
+        "\n"
+        "X:2\n"
+        "T:The Silver Spear\n"
+        "R:reel\n"
+        "M:4/4\n"
+        "L:1/8\n"
+        "Q:1/4=180\n"
+        "K:D\n"
+        "A|:FA (3AAA BAFA|dfed BddA|FA (3AAA BAFA|dfed BEED|\n"
+        "FA (3AAA BAFA|dfed Bdde|fafd efdB|1 AFEF D2 DA:|2 AFEF D2 Dg||\n"
+        "|:fa (3aaa bafa|dfed Bdde|fa (3aaa bafa|fded BEEg|\n"
+        "fa (3aaa bafa|dfed Bdde|fafd efdB|1 AFEF D2 Dg:|2 AFEF D4|]\n"
+        "\n"
+        "X:3\n"
+        "T:Si Bheag, Si Mhor\n"
+        "R:waltz\n"
+        "M:3/4\n"
+        "L:1/8\n"
+        "Q:1/4=100\n"
+        "K:D\n"
+        "de|\"D\"f3 e d2|\"G\"d3 B A2|\"D\"F3 A A2|\"A\"A4 de|f3 g a2|\"G\"b3 a g2|\"D\"f3 e d2|\"A\"e4 de|\n"
+        "\"D\"f3 e d2|\"G\"d3 B A2|\"D\"F3 A A2|\"A\"A4 dB|\"Bm\"A2 F2 A2|\"G\"B3 c d2|\"A\"A2 F2 E2|\"D\"D4|]\n"
+        "\n"
+        "X:4\n"
+        "T:The Blackbird\n"
+        "R:hornpipe\n"
+        "M:C|\n"
+        "L:1/8\n"
+        "K:Edor\n"
+        "B>A|G>EE>F G>AB>c|d>B^c>A B2 A>B|G>EE>F G>AB>G|A>FD>F E2:|\n"
+        "|:e>f|g>fe>d e>gb>g|a>fd>e =f>ed>B|[EG]>EE>F G>AB>G|A>FD>F E2 !fermata!E2|]\n"
+        "\n"
+        "X:5\n"
+        "T:Scale Study\n"
+        "M:4/4\n"
+        "L:1/4\n"
+        "Q:120\n"
+        "K:Bb\n"
+        "B,, C, D, E, | F, G, A, B, | C D E F | G A B c | d e f g | a b c' d' | [Bd]4 |\n"
+        "^F =F _F F | z2 Z | c-c d-|d e/f/ g//a//b//c'// | (3cde (3:2:3fga b2 |]\n";
+
+/**
+ * Reads a whole file into memory
+ * @param path - the file to read
+ * @return the null terminated text of the file, or null if it could not be read
+ */
+static char * read_file(const char *path) {
+
+    FILE *f = fopen(path, "rb");
+    if (!f) return 0;
+
+    fseek(f, 0, SEEK_END);
+    long length = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    char *text = malloc(length + 1);
+    if (text && fread(text, 1, length, f) != (size_t) length) {
+        free(text);
+        text = 0;
+    }
+    if (text) text[length] = 0;
+
+    fclose(f);
+    return text;
+}
+
+/**
+ * Times a note as the music player does, making any tempo change it carries first
+ * @param tempo - the tempo map of the song
+ * @param n - the note, whose durations in ticks are replaced by their lengths in ms
+ */
+static void bench_time(tm_map *tempo, mp_note *n) {
+    if (n->tempo) tm_set_tempo(tempo, n->tempo);
+    tm_resolve(tempo, &n->duration, &n->dual_duration);
+}
+
+/**
+ * Benchmarks the ABC parser
+ * @param argc - the number of arguments
+ * @param argv - [FILE]
+ * @return execution status
+ */
+int main(int argc, char **argv) {
+
+    abc_parser p;
+    mp_note n;
+    tm_map tempo;
+
+    const char *text = argc > 1 ? read_file(argv[1]) : CORPUS;
+    if (!text) {
+        fprintf(stderr, "could not read %s\n", argv[1]);
+        return 1;
+    }
+
+    // show what the first tune converts to
+    if (!abc_open(&p, text)) {
+        fprintf(stderr, "no ABC tune found\n");
+        return 1;
+    }
+
+    printf("%.*s: L:%d/%d M:%d/%d Q:%d/%d=%d\n", p.title_length, p.title ? p.title : "", p.unit_num,
+           p.unit_den, p.meter_num, p.meter_den, p.beat_num, p.beat_den, p.bpm);
+    tm_init(&tempo, MP_TEMPO, 0, 0);
+    while (abc_next(&p, &n)) {
+        bench_time(&tempo, &n);
+        printf("    %s %5d ms %5d Hz", n.instrument == MP_INSTR_REST ? "rest" : "keys", n.duration, tn_hz(n.frequency));
+        if (n.dual_instrument != MP_INSTR_NONE) printf(" + %5d Hz", tn_hz(n.dual_frequency));
+        printf("\n");
+    }
+    printf("%d malformed notes skipped\n\n", p.errors);
+
+    // summarize every tune of the collection, each opened from where the last one ended
+    int tunes = 0;
+    int errors = 0;
+    for (const char *next = text; abc_open(&p, next); next = p.next) {
+        int notes = 0;
+        long ms = 0;
+        tm_init(&tempo, MP_TEMPO, 0, 0);
+        while (abc_next(&p, &n)) {
+            bench_time(&tempo, &n);
+            ms += n.duration;
+            notes++;
+        }
+        printf("%-24.*s %4d notes %7.1f s %d errors\n", p.title_length, p.title ? p.title : "", notes, ms / 1000.0,
+               p.errors);
+        errors += p.errors;
+        tunes++;
+    }
+    printf("%d tunes, %d malformed notes skipped\n\n", tunes, errors);
+
+    // time the parser over the whole collection, one note at a time as the music player reads them
+    long bytes = 0;
+    long notes = 0;
+    long checksum = 0;
+    struct timespec start, end;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int pass = 0; pass < BENCH_PASSES; pass++) {
+        const char *next = text;
+        while (abc_open(&p, next)) {
+            while (abc_next(&p, &n)) {
+                checksum += n.duration + n.frequency;
+                notes++;
+            }
+            next = p.next;
+        }
+        bytes += p.next - text;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    double s = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) * 1e-9;
+    printf("%ld notes from %ld bytes in %.3f s (checksum %ld)\n", notes, bytes, s, checksum);
+    printf("%.1f MB/s, %.1f M notes/s, %.1f ns/note\n", bytes / s * 1e-6, notes / s * 1e-6, s * 1e9 / notes);
+    printf("%d bytes of working memory per tune\n", (int) sizeof(abc_parser));
+
+    return 0;
+}
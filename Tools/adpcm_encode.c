@@ -0,0 +1,254 @@
+/**
+ * @file adpcm_encode.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a host tool that encodes clips to the IMA-ADPCM block format read by Src/adpcm.c
+ *
+ * Build and run on the host:
+ *     gcc -O2 -o adpcm_encode Tools/adpcm_encode.c -lm
+ *     ./adpcm_encode NAME=SOURCE [NAME=SOURCE ...] > Src/clips.c
+ *
+ * SOURCE is a 16-bit mono WAV file recorded at the audio rate, or synth:kick, synth:snare,
+ * or synth:hat for the synthesized drums bundled in Src/drum_samples.c:
+ *     ./adpcm_encode DRUM_KICK=synth:kick DRUM_SNARE=synth:snare DRUM_HAT=synth:hat > Src/drum_samples.c
+ *
+ * The constants below must match Inc/adpcm.h and Drivers/CE_DevBoard_Drivers/Inc/audio_driver.h.
+ */
+
+# include <math.h>
+# include <stdint.h>
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+
+# define AUDIO_RATE 15625
+# define ADPCM_BLOCK_SAMPLES 257
+# define ADPCM_MAX_INDEX 88
+
+static const int STEPS[ADPCM_MAX_INDEX + 1] = {
+        7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+        34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143,
+        157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+        724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024,
+        3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+        15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const int INDEX_STEPS[16] = {
+        -1, -1, -1, -1, 2, 4, 6, 8,
+        -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+/**
+ * Reads a 16-bit mono PCM WAV file
+ * @param path - the file to read
+ * @param count - receives the number of samples
+ * @return the samples, or NULL on error
+ */
+static int16_t * read_wav(const char *path, int *count) {
+
+    FILE *f = fopen(path, "rb");
+    if (!f) return NULL;
+
+    unsigned char header[12];
+    if (fread(header, 1, 12, f) != 12 || memcmp(header, "RIFF", 4) || memcmp(header + 8, "WAVE", 4)) {
+        fclose(f);
+        return NULL;
+    }
+
+    int format_ok = 0;
+    unsigned char chunk[8];
+
+    // walk the chunks until the sample data
+    while (fread(chunk, 1, 8, f) == 8) {
+
+        uint32_t size = chunk[4] | (chunk[5] << 8) | (chunk[6] << 16) | ((uint32_t) chunk[7] << 24);
+
+        if (!memcmp(chunk, "fmt ", 4)) {
+            unsigned char fmt[16];
+            if (size < 16 || fread(fmt, 1, 16, f) != 16) break;
+            int channels = fmt[2] | (fmt[3] << 8);
+            int rate = fmt[4] | (fmt[5] << 8) | (fmt[6] << 16) | (fmt[7] << 24);
+            int bits = fmt[14] | (fmt[15] << 8);
+            format_ok = (fmt[0] == 1 && channels == 1 && bits == 16);
+            if (rate != AUDIO_RATE) fprintf(stderr, "%s: %d Hz, expected %d Hz\n", path, rate, AUDIO_RATE);
+            fseek(f, size - 16 + (size & 1), SEEK_CUR);
+        } else if (!memcmp(chunk, "data", 4) && format_ok) {
+            int16_t *samples = malloc(size);
+            *count = (int) (fread(samples, 2, size / 2, f));
+            fclose(f);
+            return samples;
+        } else {
+            fseek(f, size + (size & 1), SEEK_CUR);
+        }
+    }
+
+    fclose(f);
+    return NULL;
+}
+
+/**
+ * Synthesizes one of the bundled drums
+ * @param name - kick, snare, or hat
+ * @param count - receives the number of samples
+ * @return the samples, or NULL for an unknown drum
+ */
+static int16_t * synth(const char *name, int *count) {
+
+    double length = !strcmp(name, "hat") ? 0.05 : 0.15;
+    int n = (int) (length * AUDIO_RATE);
+    int16_t *samples = malloc(n * sizeof(int16_t));
+    uint32_t noise = 0x12345678;
+    double phase = 0;
+    double last = 0;
+
+    for (int i = 0; i < n; i++) {
+
+        double t = (double) i / AUDIO_RATE;
+        double s;
+
+        noise = noise * 1664525 + 1013904223;
+        double white = (double) (int32_t) noise / 2147483648.0;
+
+        if (!strcmp(name, "kick")) {
+            // a sine sweeping down from 150 Hz to 45 Hz
+            phase += 2 * M_PI * (45 + 105 * exp(-t * 40)) / AUDIO_RATE;
+            s = sin(phase) * exp(-t * 18);
+        } else if (!strcmp(name, "snare")) {
+            // a 180 Hz body under a burst of noise
+            phase += 2 * M_PI * 180 / AUDIO_RATE;
+            s = (0.4 * sin(phase) * exp(-t * 30)) + (0.6 * white * exp(-t * 22));
+        } else if (!strcmp(name, "hat")) {
+            // differentiated noise, which leaves mostly high frequencies
+            s = (white - last) * 0.5 * exp(-t * 70);
+            last = white;
+        } else {
+            free(samples);
+            return NULL;
+        }
+
+        samples[i] = (int16_t) lround(s * 30000);
+    }
+
+    *count = n;
+    return samples;
+}
+
+/**
+ * Encodes samples and prints them as an adpcm_clip
+ * @param name - the name of the clip
+ * @param samples - the samples to encode
+ * @param count - the number of samples
+ */
+static void encode(const char *name, const int16_t *samples, int count) {
+
+    int index = 0;
+    int bytes = 0;
+
+    printf("static const uint8_t %s_DATA[] = {\n", name);
+
+    for (int start = 0; start < count; start += ADPCM_BLOCK_SAMPLES) {
+
+        int length = count - start < ADPCM_BLOCK_SAMPLES ? count - start : ADPCM_BLOCK_SAMPLES;
+        int predictor = samples[start];
+        int codes[ADPCM_BLOCK_SAMPLES] = {0};
+
+        // the header carries the first sample and the step index the block starts with
+        printf("        0x%02X, 0x%02X, 0x%02X, 0x00,", samples[start] & 0xFF, (samples[start] >> 8) & 0xFF, index);
+        bytes += 4;
+
+        // encode each remaining sample against the decoder's own reconstruction
+        for (int i = 1; i < length; i++) {
+
+            int step = STEPS[index];
+            int diff = samples[start + i] - predictor;
+            int code = 0;
+
+            if (diff < 0) {
+                code = 8;
+                diff = -diff;
+            }
+            if (diff >= step) {
+                code |= 4;
+                diff -= step;
+            }
+            if (diff >= step >> 1) {
+                code |= 2;
+                diff -= step >> 1;
+            }
+            if (diff >= step >> 2) code |= 1;
+
+            int delta = step >> 3;
+            if (code & 4) delta += step;
+            if (code & 2) delta += step >> 1;
+            if (code & 1) delta += step >> 2;
+
+            predictor += (code & 8) ? -delta : delta;
+            if (predictor > 32767) predictor = 32767;
+            if (predictor < -32768) predictor = -32768;
+
+            index += INDEX_STEPS[code];
+            if (index < 0) index = 0;
+            if (index > ADPCM_MAX_INDEX) index = ADPCM_MAX_INDEX;
+
+            codes[i - 1] = code;
+        }
+
+        // pack two codes per byte, low nibble first
+        for (int i = 0; i < length - 1; i += 2) {
+            if (i % 24 == 0) printf("\n       ");
+            printf(" 0x%02X,", codes[i] | (codes[i + 1] << 4));
+            bytes++;
+        }
+        printf("\n");
+    }
+
+    printf("};\n\n");
+    printf("const adpcm_clip %s = {%s_DATA, %d}; // %d bytes\n\n", name, name, count, bytes);
+}
+
+/**
+ * Encodes every clip named on the command line into one C file on stdout
+ * @param argc - the number of arguments
+ * @param argv - NAME=SOURCE pairs
+ * @return execution status
+ */
+int main(int argc, char **argv) {
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s NAME=SOURCE [NAME=SOURCE ...]\n", argv[0]);
+        return 1;
+    }
+
+    printf("/**\n");
+    printf(" * @file\n");
+    printf(" * @brief IMA-ADPCM clips, generated by Tools/adpcm_encode.c (do not edit)\n");
+    printf(" */\n\n");
+    printf("# include \"adpcm.h\"\n\n");
+
+    for (int i = 1; i < argc; i++) {
+
+        char name[64];
+        const char *source = strchr(argv[i], '=');
+        if (!source || source - argv[i] >= (int) sizeof(name)) {
+            fprintf(stderr, "bad clip: %s\n", argv[i]);
+            return 1;
+        }
+        memcpy(name, argv[i], source - argv[i]);
+        name[source - argv[i]] = '\0';
+        source++;
+
+        int count = 0;
+        int16_t *samples = strncmp(source, "synth:", 6) ? read_wav(source, &count) : synth(source + 6, &count);
+        if (!samples || count == 0) {
+            fprintf(stderr, "cannot read %s\n", source);
+            return 1;
+        }
+
+        encode(name, samples, count);
+        free(samples);
+    }
+
+    return 0;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file biquad_design.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a host tool that designs biquad cascades in the Q14 format read by Src/biquad.c
+ *
+ * Build and run on the host:
+ *     gcc -O2 -o biquad_design Tools/biquad_design.c -lm
+ *     ./biquad_design NAME SECTION [SECTION ...]
+ *
+ * Each SECTION is TYPE:FREQUENCY:Q with TYPE one of lowpass, highpass, or notch, using the
+ * Audio EQ Cookbook (R. Bristow-Johnson) formulas at the audio rate. The presets in
+ * Src/biquad_presets.c were generated with:
+ *     ./biquad_design BIQUAD_LOWPASS lowpass:4000:0.707
+ *     ./biquad_design BIQUAD_PIEZO_TONE notch:4000:2 lowpass:6000:0.707
+ *
+ * AUDIO_RATE must match Drivers/CE_DevBoard_Drivers/Inc/audio_driver.h.
+ */
+
+# include <math.h>
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+
+# define AUDIO_RATE 15625
+# define Q14 16384.0
+
+/**
+ * Converts a coefficient to Q14, failing loudly if it does not fit
+ * @param c - the coefficient
+ * @return the Q14 coefficient
+ */
+static long q14(double c) {
+    long q = lround(c * Q14);
+    if (q > 32767 || q < -32768) {
+        fprintf(stderr, "coefficient %f does not fit in Q14\n", c);
+        exit(1);
+    }
+    return q;
+}
+
+/**
+ * Designs one section and prints its initializer
+ * @param spec - the TYPE:FREQUENCY:Q specification
+ * @param last - whether this is the last section of the cascade
+ */
+static void section(const char *spec, int last) {
+
+    char type[16];
+    double f0, q;
+
+    if (sscanf(spec, "%15[a-z]:%lf:%lf", type, &f0, &q) != 3 || f0 <= 0 || f0 >= AUDIO_RATE / 2.0 || q <= 0) {
+        fprintf(stderr, "bad section: %s\n", spec);
+        exit(1);
+    }
+
+    double w0 = 2 * M_PI * f0 / AUDIO_RATE;
+    double alpha = sin(w0) / (2 * q);
+    double cw = cos(w0);
+    double b0, b1, b2;
+    double a0 = 1 + alpha;
+    double a1 = -2 * cw;
+    double a2 = 1 - alpha;
+
+    if (!strcmp(type, "lowpass")) {
+        b0 = (1 - cw) / 2;
+        b1 = 1 - cw;
+        b2 = (1 - cw) / 2;
+    } else if (!strcmp(type, "highpass")) {
+        b0 = (1 + cw) / 2;
+        b1 = -(1 + cw);
+        b2 = (1 + cw) / 2;
+    } else if (!strcmp(type, "notch")) {
+        b0 = 1;
+        b1 = -2 * cw;
+        b2 = 1;
+    } else {
+        fprintf(stderr, "unknown section type: %s\n", type);
+        exit(1);
+    }
+
+    // the feedback terms are negated so every product accumulates
+    printf("        BIQUAD_COEFS(%ld, %ld, %ld, %ld, %ld)%s // %s\n",
+           q14(b0 / a0), q14(b1 / a0), q14(b2 / a0), q14(-a1 / a0), q14(-a2 / a0), last ? "" : ",", spec);
+}
+
+/**
+ * Prints a cascade as a const array of biquad_coefs on stdout
+ * @param argc - the number of arguments
+ * @param argv - the name of the cascade followed by its sections
+ * @return execution status
+ */
+int main(int argc, char **argv) {
+
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s NAME TYPE:FREQUENCY:Q [TYPE:FREQUENCY:Q ...]\n", argv[0]);
+        return 1;
+    }
+
+    printf("const biquad_coefs %s[%d] = {\n", argv[1], argc - 2);
+    for (int i = 2; i < argc; i++) section(argv[i], i == argc - 1);
+    printf("};\n");
+
+    return 0;
+}
@@ -0,0 +1,265 @@
+/**
+ * @file pcm_send.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a host tool that streams audio in real time to the board over a serial port
+ *
+ * Build and run on the host:
+ *     gcc -O2 -o pcm_send Tools/pcm_send.c -lm
+ *     ./pcm_send DEVICE FORMAT SOURCE [DRIFT_PPM] [BURST_MS]
+ *
+ * DEVICE is the serial port of the board (or one end of a pty pair), FORMAT is u8 or adpcm to match
+ * stream_start, and SOURCE is a 16-bit mono WAV file recorded at the audio rate or synth:sweep for
+ * a test tone. DRIFT_PPM skews the send rate to rehearse a sender clock that runs fast or slow, and
+ * BURST_MS sets how often the sender wakes to write (USB serial adapters deliver in bursts anyway).
+ *
+ * To check the pacing against a pty loopback rather than the board:
+ *     socat pty,raw,echo=0,link=/tmp/tx pty,raw,echo=0,link=/tmp/rx &
+ *     cat /tmp/rx > /tmp/received.u8 & ./pcm_send /tmp/tx u8 synth:sweep 500 16
+ *
+ * The constants below must match Drivers/CE_DevBoard_Drivers/Inc/audio_driver.h and Inc/pcm_stream.h.
+ */
+
+# define _GNU_SOURCE
+# include <fcntl.h>
+# include <math.h>
+# include <stdint.h>
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include <termios.h>
+# include <time.h>
+# include <unistd.h>
+
+# define AUDIO_RATE 15625
+# define STREAM_BAUD B230400
+# define ADPCM_MAX_INDEX 88
+
+static const int STEPS[ADPCM_MAX_INDEX + 1] = {
+        7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+        34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143,
+        157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+        724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024,
+        3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+        15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const int INDEX_STEPS[16] = {
+        -1, -1, -1, -1, 2, 4, 6, 8,
+        -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+/**
+ * Reads a 16-bit mono PCM WAV file
+ * @param path - the file to read
+ * @param count - receives the number of samples
+ * @return the samples, or NULL on error
+ */
+static int16_t * read_wav(const char *path, int *count) {
+
+    FILE *f = fopen(path, "rb");
+    if (!f) return NULL;
+
+    unsigned char header[12];
+    if (fread(header, 1, 12, f) != 12 || memcmp(header, "RIFF", 4) || memcmp(header + 8, "WAVE", 4)) {
+        fclose(f);
+        return NULL;
+    }
+
+    int format_ok = 0;
+    unsigned char chunk[8];
+
+    // walk the chunks until the sample data
+    while (fread(chunk, 1, 8, f) == 8) {
+
+        uint32_t size = chunk[4] | (chunk[5] << 8) | (chunk[6] << 16) | ((uint32_t) chunk[7] << 24);
+
+        if (!memcmp(chunk, "fmt ", 4)) {
+            unsigned char fmt[16];
+            if (size < 16 || fread(fmt, 1, 16, f) != 16) break;
+            int channels = fmt[2] | (fmt[3] << 8);
+            int rate = fmt[4] | (fmt[5] << 8) | (fmt[6] << 16) | (fmt[7] << 24);
+            int bits = fmt[14] | (fmt[15] << 8);
+            format_ok = (fmt[0] == 1 && channels == 1 && bits == 16);
+            if (rate != AUDIO_RATE) fprintf(stderr, "%s: %d Hz, expected %d Hz\n", path, rate, AUDIO_RATE);
+            fseek(f, size - 16 + (size & 1), SEEK_CUR);
+        } else if (!memcmp(chunk, "data", 4) && format_ok) {
+            int16_t *samples = malloc(size);
+            *count = (int) (fread(samples, 2, size / 2, f));
+            fclose(f);
+            return samples;
+        } else {
+            fseek(f, size + (size & 1), SEEK_CUR);
+        }
+    }
+
+    fclose(f);
+    return NULL;
+}
+
+/**
+ * Synthesizes a ten second exponential sine sweep from 100 Hz to 5 kHz, which makes resampler
+ * glitches easy to hear
+ * @param count - receives the number of samples
+ * @return the samples
+ */
+static int16_t * synth_sweep(int *count) {
+
+    int n = 10 * AUDIO_RATE;
+    int16_t *samples = malloc(n * sizeof(int16_t));
+    double phase = 0;
+
+    for (int i = 0; i < n; i++) {
+        double t = (double) i / AUDIO_RATE;
+        phase += 2 * M_PI * 100 * pow(50, t / 10) / AUDIO_RATE;
+        samples[i] = (int16_t) lround(sin(phase) * 24000);
+    }
+
+    *count = n;
+    return samples;
+}
+
+/**
+ * Encodes one sample as a headerless IMA-ADPCM code
+ * @param sample - the sample to encode
+ * @param predictor - the decoder's reconstruction, updated
+ * @param index - the decoder's step index, updated
+ * @return the 4-bit code
+ */
+static int adpcm_code(int sample, int *predictor, int *index) {
+
+    int step = STEPS[*index];
+    int diff = sample - *predictor;
+    int code = 0;
+
+    if (diff < 0) {
+        code = 8;
+        diff = -diff;
+    }
+    if (diff >= step) {
+        code |= 4;
+        diff -= step;
+    }
+    if (diff >= step >> 1) {
+        code |= 2;
+        diff -= step >> 1;
+    }
+    if (diff >= step >> 2) code |= 1;
+
+    // track the decoder's own reconstruction so the error does not accumulate
+    int delta = step >> 3;
+    if (code & 4) delta += step;
+    if (code & 2) delta += step >> 1;
+    if (code & 1) delta += step >> 2;
+
+    *predictor += (code & 8) ? -delta : delta;
+    if (*predictor > 32767) *predictor = 32767;
+    if (*predictor < -32768) *predictor = -32768;
+
+    *index += INDEX_STEPS[code];
+    if (*index < 0) *index = 0;
+    if (*index > ADPCM_MAX_INDEX) *index = ADPCM_MAX_INDEX;
+
+    return code;
+}
+
+/**
+ * Opens a serial port in raw mode at the stream baud rate
+ * @param path - the port to open
+ * @return the file descriptor, or -1 on error
+ */
+static int open_port(const char *path) {
+
+    int fd = open(path, O_WRONLY | O_NOCTTY);
+    if (fd < 0) return -1;
+
+    // ptys do not take a baud rate, so only a real port needs these to succeed
+    struct termios tio;
+    if (tcgetattr(fd, &tio) == 0) {
+        cfmakeraw(&tio);
+        cfsetospeed(&tio, STREAM_BAUD);
+        cfsetispeed(&tio, STREAM_BAUD);
+        tcsetattr(fd, TCSANOW, &tio);
+    }
+
+    return fd;
+}
+
+/**
+ * Streams a source to a serial port in real time
+ * @param argc - the number of arguments
+ * @param argv - DEVICE FORMAT SOURCE [DRIFT_PPM] [BURST_MS]
+ * @return execution status
+ */
+int main(int argc, char **argv) {
+
+    if (argc < 4) {
+        fprintf(stderr, "usage: %s DEVICE u8|adpcm SOURCE [DRIFT_PPM] [BURST_MS]\n", argv[0]);
+        return 1;
+    }
+
+    int adpcm = !strcmp(argv[2], "adpcm");
+    double drift = argc > 4 ? atof(argv[4]) : 0;
+    int burst_ms = argc > 5 ? atoi(argv[5]) : 4;
+    if (burst_ms < 1) burst_ms = 1;
+
+    int count = 0;
+    int16_t *samples = !strcmp(argv[3], "synth:sweep") ? synth_sweep(&count) : read_wav(argv[3], &count);
+    if (!samples) {
+        fprintf(stderr, "%s: cannot read source\n", argv[3]);
+        return 1;
+    }
+
+    int fd = open_port(argv[1]);
+    if (fd < 0) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    // encode the whole source up front so pacing is the only thing done in the send loop
+    int bytes = adpcm ? (count + 1) / 2 : count;
+    uint8_t *stream = calloc(bytes, 1);
+    int predictor = 0;
+    int index = 0;
+    for (int i = 0; i < count; i++) {
+        if (adpcm) stream[i / 2] |= adpcm_code(samples[i], &predictor, &index) << ((i & 1) * 4);
+        else stream[i] = (uint8_t) ((samples[i] >> 8) + 128);
+    }
+
+    // release each burst when the skewed sample clock says it is due
+    double rate = AUDIO_RATE * (1 + drift * 1e-6) * (adpcm ? 0.5 : 1);
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    int sent = 0;
+    long ticks = 0;
+    while (sent < bytes) {
+
+        ticks++;
+        struct timespec wake = start;
+        long long ns = (long long) start.tv_nsec + ticks * burst_ms * 1000000LL;
+        wake.tv_sec += ns / 1000000000LL;
+        wake.tv_nsec = ns % 1000000000LL;
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake, NULL);
+
+        int due = (int) (rate * ticks * burst_ms / 1000.0);
+        if (due > bytes) due = bytes;
+
+        while (sent < due) {
+            ssize_t n = write(fd, stream + sent, due - sent);
+            if (n <= 0) {
+                perror("write");
+                return 1;
+            }
+            sent += (int) n;
+        }
+    }
+
+    fprintf(stderr, "sent %d bytes (%d samples) at %.1f bytes/s\n", sent, count, rate);
+
+    close(fd);
+    free(stream);
+    free(samples);
+    return 0;
+}
@@ -0,0 +1,298 @@
+/**
+ * @file pcm_stream_sim.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a host harness that plays a serial stream through the firmware's jitter buffer and resampler
+ *
+ * Build and run on the host from the repository root:
+ *     gcc -O2 -IInc -IDrivers/CE_DevBoard_Drivers/Inc -o pcm_stream_sim Tools/pcm_stream_sim.c
+ *     ./pcm_stream_sim u8|adpcm SOURCE [SECONDS] [DRIFT_PPM] [BURST_MS]
+ *
+ * Src/pcm_stream.c is compiled in directly, with stand-ins for the UART and audio drivers: a ring of
+ * UART_RING_SIZE bytes that fills as bytes arrive, and an audio FIFO of AUDIO_FIFO_BLOCKS blocks that
+ * the board's sample clock drains one block at a time.
+ *
+ * SOURCE is the receiving end of a pty pair that Tools/pcm_send.c writes into, read in real time for
+ * SECONDS (30 by default):
+ *     socat pty,raw,echo=0,link=/tmp/tx pty,raw,echo=0,link=/tmp/rx &
+ *     ./pcm_stream_sim u8 /tmp/rx 30 & ./pcm_send /tmp/tx u8 synth:sweep 500 16
+ *
+ * or sim for a sender of silence simulated in place of pcm_send, SECONDS (120 by default) long,
+ * whose clock runs DRIFT_PPM fast and which writes every BURST_MS (16 by default). This runs as fast
+ * as the host allows, so the drift range can be swept quickly:
+ *     for d in 0 500 -1000 1800; do ./pcm_stream_sim u8 sim 120 $d 16; done
+ *
+ * Every ten seconds of stream, and again at the end, prints the stream_get_stats counters.
+ */
+
+# define _GNU_SOURCE
+# include <fcntl.h>
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include <termios.h>
+# include <time.h>
+# include <unistd.h>
+
+# include "uart_driver.h"
+# include "audio_driver.h"
+
+# include "../Src/adpcm.c"
+# include "../Src/pcm_stream.c"
+
+# define SIM_REPORT_SECONDS 10
+# define SIM_READ_SIZE 1024
+
+/**
+ * The stand-in UART: a ring the sender's bytes land in, with the same overrun rule as the driver
+ */
+static uint8_t sim_ring[UART_RING_SIZE];
+static uint32_t sim_written = 0;
+static uint32_t sim_consumed = 0;
+static uint32_t sim_overruns = 0;
+
+/**
+ * The stand-in audio output: the render callback and the samples rendered and played so far
+ */
+static audio_callback sim_render = 0;
+static int sim_playing = 0;
+static uint64_t sim_rendered = 0;
+static uint64_t sim_played = 0;
+static uint32_t sim_audio_underruns = 0;
+
+/**
+ * Discards anything unread and starts receiving
+ * @param baud - unused, the bytes arrive as fast as the source delivers them
+ */
+void uart_init(uint32_t baud) {
+    (void) baud;
+    sim_written = 0;
+    sim_consumed = 0;
+    sim_overruns = 0;
+}
+
+/**
+ * Stops receiving
+ */
+void uart_stop(void) {}
+
+/**
+ * Counts the bytes received but not yet read, skipping ahead over lapped bytes as the driver does
+ * @return the number of bytes ready to read
+ */
+uint32_t uart_available(void) {
+
+    if (sim_written - sim_consumed > UART_RING_SIZE) {
+        sim_consumed = sim_written - UART_RING_SIZE / 2;
+        sim_overruns++;
+    }
+
+    return sim_written - sim_consumed;
+}
+
+/**
+ * Reads the next received byte
+ * @return the byte
+ */
+uint8_t uart_read(void) {
+    return sim_ring[sim_consumed++ & (UART_RING_SIZE - 1)];
+}
+
+/**
+ * Counts the times the sender lapped the reader
+ * @return the number of overruns
+ */
+uint32_t uart_overruns(void) {
+    return sim_overruns;
+}
+
+/**
+ * Stores bytes from the sender in the ring, as the DMA would
+ * @param data - the bytes
+ * @param length - the number of bytes
+ */
+static void sim_receive(const uint8_t *data, int length) {
+    for (int i = 0; i < length; i++) sim_ring[sim_written++ & (UART_RING_SIZE - 1)] = data[i];
+}
+
+/**
+ * Keeps the render callback
+ * @param render - the callback that renders each block of samples
+ */
+void audio_init(audio_callback render) {
+    sim_render = render;
+    sim_playing = 0;
+    sim_rendered = 0;
+    sim_played = 0;
+}
+
+/**
+ * Starts playing
+ */
+void audio_start(void) {
+    sim_playing = 1;
+    audio_pump();
+}
+
+/**
+ * Renders blocks into the FIFO until it is full
+ */
+void audio_pump(void) {
+
+    static int16_t block[AUDIO_BLOCK_SIZE];
+
+    while (sim_playing && sim_rendered - sim_played < AUDIO_FIFO_BLOCKS * AUDIO_BLOCK_SIZE) {
+        sim_render(block, AUDIO_BLOCK_SIZE);
+        sim_rendered += AUDIO_BLOCK_SIZE;
+    }
+}
+
+/**
+ * Measures how long until the output runs out of rendered samples
+ * @return the number of samples left to play, or UINT32_MAX while stopped
+ */
+uint32_t audio_deadline(void) {
+    return sim_playing ? (uint32_t) (sim_rendered - sim_played) : UINT32_MAX;
+}
+
+/**
+ * Stops playing
+ */
+void audio_stop(void) {
+    sim_playing = 0;
+}
+
+/**
+ * Plays one block of the FIFO at the board's sample clock
+ */
+static void sim_play_block(void) {
+    if (sim_rendered - sim_played < AUDIO_BLOCK_SIZE) sim_audio_underruns++;
+    else sim_played += AUDIO_BLOCK_SIZE;
+}
+
+/**
+ * Prints the stream counters
+ * @param seconds - the stream time so far
+ * @param received - the bytes received so far
+ */
+static void sim_report(double seconds, uint32_t received) {
+
+    stream_stats stats;
+    stream_get_stats(&stats);
+
+    printf("%6.1f s %8u bytes  fill %5u  latency %5u (%5.1f ms)  drift %+5d ppm  underruns %u  overruns %u\n",
+           seconds, received, stats.fill, stats.latency, stats.latency * 1000.0 / AUDIO_RATE,
+           stats.drift_ppm, stats.underruns, stats.overruns);
+}
+
+/**
+ * Opens the receiving end of a pty or serial port without blocking
+ * @param path - the device to open
+ * @return the file descriptor, or -1 on error
+ */
+static int open_source(const char *path) {
+
+    int fd = open(path, O_RDONLY | O_NOCTTY | O_NONBLOCK);
+    if (fd < 0) return -1;
+
+    // ptys and ports must not echo or translate the bytes
+    struct termios tio;
+    if (tcgetattr(fd, &tio) == 0) {
+        cfmakeraw(&tio);
+        tcsetattr(fd, TCSANOW, &tio);
+    }
+
+    return fd;
+}
+
+/**
+ * Plays a stream through the firmware's jitter buffer and resampler
+ * @param argc - the number of arguments
+ * @param argv - u8|adpcm SOURCE [SECONDS] [DRIFT_PPM] [BURST_MS]
+ * @return execution status
+ */
+int main(int argc, char **argv) {
+
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s u8|adpcm SOURCE|sim [SECONDS] [DRIFT_PPM] [BURST_MS]\n", argv[0]);
+        return 1;
+    }
+
+    int adpcm = !strcmp(argv[1], "adpcm");
+    int simulated = !strcmp(argv[2], "sim");
+    double seconds = argc > 3 ? atof(argv[3]) : simulated ? 120 : 30;
+    double drift = argc > 4 ? atof(argv[4]) : 0;
+    int burst_ms = argc > 5 ? atoi(argv[5]) : 16;
+    if (burst_ms < 1) burst_ms = 1;
+
+    int fd = -1;
+    if (!simulated) {
+        fd = open_source(argv[2]);
+        if (fd < 0) {
+            perror(argv[2]);
+            return 1;
+        }
+    }
+
+    stream_start(adpcm ? STREAM_ADPCM : STREAM_PCM_U8);
+
+    // silence in either format, with the two ADPCM codes of each byte cancelling out
+    uint8_t silence[SIM_READ_SIZE];
+    memset(silence, adpcm ? 0x08 : 0x80, sizeof(silence));
+
+    double byte_rate = AUDIO_RATE * (1 + drift * 1e-6) * (adpcm ? 0.5 : 1);
+    long blocks = (long) (seconds * AUDIO_RATE / AUDIO_BLOCK_SIZE);
+    long report = SIM_REPORT_SECONDS * AUDIO_RATE / AUDIO_BLOCK_SIZE;
+    uint32_t received = 0;
+    long bursts = 0;
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    for (long b = 1; b <= blocks; b++) {
+
+        double now = (double) b * AUDIO_BLOCK_SIZE / AUDIO_RATE;
+
+        if (simulated) {
+
+            // release every burst the sender's skewed clock has made due by now
+            while ((bursts + 1) * burst_ms * 1e-3 <= now) {
+                bursts++;
+                uint32_t due = (uint32_t) (byte_rate * bursts * burst_ms * 1e-3);
+                while (received < due) {
+                    int n = due - received < SIM_READ_SIZE ? (int) (due - received) : SIM_READ_SIZE;
+                    sim_receive(silence, n);
+                    received += n;
+                }
+            }
+
+        } else {
+
+            // keep to the board's sample clock, taking whatever the sender has written meanwhile
+            struct timespec wake = start;
+            long long ns = (long long) start.tv_nsec + (long long) (now * 1e9);
+            wake.tv_sec += ns / 1000000000LL;
+            wake.tv_nsec = ns % 1000000000LL;
+            clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake, NULL);
+
+            uint8_t bytes[SIM_READ_SIZE];
+            ssize_t n;
+            while ((n = read(fd, bytes, sizeof(bytes))) > 0) {
+                sim_receive(bytes, (int) n);
+                received += (uint32_t) n;
+            }
+        }
+
+        sim_play_block();
+        audio_pump();
+
+        if (b % report == 0) sim_report(now, received);
+    }
+
+    if (blocks % report) sim_report((double) blocks * AUDIO_BLOCK_SIZE / AUDIO_RATE, received);
+    if (sim_audio_underruns) printf("%u audio FIFO underruns\n", sim_audio_underruns);
+
+    if (fd >= 0) close(fd);
+    return 0;
+}
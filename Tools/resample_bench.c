@@ -0,0 +1,146 @@
+/**
+ * @file resample_bench.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a host benchmark of the resampler's speed and accuracy in each interpolation mode
+ *
+ * Build and run on the host from the repository root:
+ *     gcc -O2 -IInc -IDrivers/CE_DevBoard_Drivers/Inc -IDrivers/CMSIS/Device/ST/STM32F4xx/Include \
+ *         -o resample_bench Tools/resample_bench.c -lm
+ *     ./resample_bench
+ *
+ * The resampler is compiled in directly, with portable stand-ins for the Cortex-M4 DSP intrinsics,
+ * so the host numbers compare the modes against each other rather than predicting target cycles.
+ * On the board, rs_cycles_per_sample times the same loops with the DWT cycle counter.
+ */
+
+# include <math.h>
+# include <stdint.h>
+# include <stdio.h>
+# include <time.h>
+
+// stand in for the device header and the cycle counter, which only exist on the target
+# define __STM32F446xx_H
+# define CYCLE_COUNTER_H
+
+static inline uint32_t __SMUAD(uint32_t a, uint32_t b) {
+    return (uint32_t) ((int16_t) a * (int16_t) b + (int16_t) (a >> 16) * (int16_t) (b >> 16));
+}
+
+static inline uint32_t __SMLAD(uint32_t a, uint32_t b, uint32_t acc) {
+    return acc + __SMUAD(a, b);
+}
+
+# define __PKHBT(a, b, s) ((((uint32_t) (a)) & 0xFFFFUL) | ((((uint32_t) (b)) << (s)) & 0xFFFF0000UL))
+
+static inline void cyc_init(void) {}
+
+static inline uint32_t cyc_now(void) {
+    return 0;
+}
+
+# include "../Src/sine_table.c"
+# include "../Src/resampler.c"
+
+# define BENCH_LENGTH 4096 // samples in the test recording
+# define BENCH_CYCLES 256 // sine cycles in the recording, 16 samples each so interpolation error shows
+# define BENCH_BLOCK 64
+# define BENCH_BLOCKS 100000
+
+static int16_t recording[BENCH_LENGTH + 3];
+
+static const char * const NAMES[] = {"nearest", "linear", "hermite"};
+
+/**
+ * Measures the speed of one interpolation mode
+ * @param sample - the recording to play
+ * @param interp - the mode to measure
+ * @return nanoseconds per output sample
+ */
+static double bench_speed(const rs_sample *sample, rs_interp interp) {
+
+    static int32_t mix[BENCH_BLOCK];
+    rs_voice v;
+    struct timespec start, end;
+
+    // an awkward ratio so no two outputs share a fraction
+    rs_start(&v, sample, (uint32_t) (1.37 * 65536), AUDIO_RATE, interp);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int i = 0; i < BENCH_BLOCKS; i++) rs_render(&v, mix, BENCH_BLOCK, 32767);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    // keep the compiler from discarding the mix
+    volatile int32_t sink = mix[0];
+    (void) sink;
+
+    double ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+    return ns / ((double) BENCH_BLOCKS * BENCH_BLOCK);
+}
+
+/**
+ * Measures the accuracy of one interpolation mode against the ideal sine
+ * @param sample - the recording to play
+ * @param interp - the mode to measure
+ * @param ratio - recording samples per output sample
+ * @return the signal to noise ratio in dB
+ */
+static double bench_snr(const rs_sample *sample, rs_interp interp, double ratio) {
+
+    static int32_t mix[BENCH_BLOCK];
+    rs_voice v;
+    double signal = 0;
+    double noise = 0;
+
+    rs_start(&v, sample, (uint32_t) (ratio * 65536), AUDIO_RATE, interp);
+
+    for (int i = 0; i < 500; i++) {
+
+        // the phase before the block gives the exact position of each output
+        uint32_t phase = v.phase;
+        for (int j = 0; j < BENCH_BLOCK; j++) mix[j] = 0;
+        rs_render(&v, mix, BENCH_BLOCK, 32767);
+
+        for (int j = 0; j < BENCH_BLOCK; j++) {
+            double position = (phase + (double) j * v.step) / 65536.0;
+            double ideal = 24000 * sin(2 * M_PI * BENCH_CYCLES * position / BENCH_LENGTH) * 32767 / 32768;
+            signal += ideal * ideal;
+            noise += (mix[j] - ideal) * (mix[j] - ideal);
+        }
+    }
+
+    return 10 * log10(signal / noise);
+}
+
+/**
+ * Benchmarks each interpolation mode
+ * @return execution status
+ */
+int main(void) {
+
+    // a looped sine with a guard sample before and two after
+    for (int i = -1; i < BENCH_LENGTH + 2; i++) {
+        recording[i + 1] = (int16_t) lround(24000 * sin(2 * M_PI * BENCH_CYCLES * i / BENCH_LENGTH));
+    }
+
+    rs_sample sample = {
+            .data = recording + 1,
+            .length = BENCH_LENGTH,
+            .loop_start = 0,
+            .loop_length = BENCH_LENGTH,
+            .root = 1 << 16,
+            .rate = AUDIO_RATE
+    };
+
+    printf("%-8s %10s %12s %12s\n", "mode", "ns/sample", "SNR x1.37", "SNR x0.13");
+
+    for (int i = RS_NEAREST; i <= RS_HERMITE; i++) {
+        printf("%-8s %10.2f %10.1f dB %10.1f dB\n", NAMES[i],
+               bench_speed(&sample, (rs_interp) i),
+               bench_snr(&sample, (rs_interp) i, 1.37),
+               bench_snr(&sample, (rs_interp) i, 0.13));
+    }
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file rtttl_bench.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a host benchmark of the RTTTL parser's throughput
+ *
+ * Build and run on the host from the repository root:
+ *     gcc -O2 -IInc -o rtttl_bench Tools/rtttl_bench.c
+ *     ./rtttl_bench [SONG]
+ *
+ * Prints the notes a song converts to (the built in Tetris theme unless SONG is given), timed in ms
+ * by a tempo map as the music player would, then times the parser over a set of songs.
+ */
+
+# include <stdio.h>
+# include <time.h>
+
+# include "../Src/rtttl.c"
+# include "../Src/tempo_map.c"
+# include "../Src/tuning.c"
+# include "../Src/tuning_table.c"
+
+# define BENCH_PASSES 200000
+
+static const char * const SONGS[] = {
+        "Tetris:d=4,o=5,b=160:e6,8b,8c6,8d6,16e6,16d6,8c6,8b,a,8a,8c6,e6,8d6,8c6,b,8b,8c6,d6,e6,c6,a,2a,"
+        "8p,d6,8f6,a6,8g6,8f6,e6,8e6,8c6,e6,8d6,8c6,b,8b,8c6,d6,e6,c6,a,a",
+        "Entertainer:d=4,o=5,b=140:8d,8d#,8e,c6,8e,c6,8e,2c.6,8c6,8d6,8d#6,8e6,8c6,8d6,e6,8b,d6,2c6,p,"
+        "8d,8d#,8e,c6,8e,c6,8e,2c.6,8p,8a,8g,8f#,8a,8c6,e6,8d6,8c6,8a,2d6",
+        "Mission:d=16,o=6,b=95:32d,32d#,32d,32d#,32d,32d#,32d,32d#,32d,32d,32d#,32e,32f,32f#,32g,g,8p,"
+        "g,8p,a#,p,c7,p,g,8p,g,8p,f,p,f#,p,g,8p,g,8p,a#,p,c7,p,g,8p,g,8p,f,p,f#,p,a#,g,2d,32p,a#,g,2c#"
+};
+
+# define SONG_COUNT (int) (sizeof(SONGS) / sizeof(SONGS[0]))
+
+/**
+ * Times a note as the music player does, making any tempo change it carries first
+ * @param tempo - the tempo map of the song
+ * @param n - the note, whose durations in ticks are replaced by their lengths in ms
+ */
+static void bench_time(tm_map *tempo, mp_note *n) {
+    if (n->tempo) tm_set_tempo(tempo, n->tempo);
+    tm_resolve(tempo, &n->duration, &n->dual_duration);
+}
+
+/**
+ * Benchmarks the RTTTL parser
+ * @param argc - the number of arguments
+ * @param argv - [SONG]
+ * @return execution status
+ */
+int main(int argc, char **argv) {
+
+    rtttl_parser p;
+    mp_note n;
+    tm_map tempo;
+
+    // show what a song converts to
+    const char *song = argc > 1 ? argv[1] : SONGS[0];
+    if (!rtttl_open(&p, song)) {
+        fprintf(stderr, "invalid RTTTL header\n");
+        return 1;
+    }
+
+    printf("%.*s: d=%d o=%d b=%d\n", p.name_length, p.name, p.duration, p.octave, p.bpm);
+    tm_init(&tempo, MP_TEMPO, 0, 0);
+    while (rtttl_next(&p, &n)) {
+        bench_time(&tempo, &n);
+        printf("    %s %5d ms %5d Hz\n", n.instrument == MP_INSTR_REST ? "rest" : "keys", n.duration, tn_hz(n.frequency));
+    }
+    printf("%d malformed notes skipped\n\n", p.errors);
+
+    // time the parser over every song, one note at a time as the music player reads them
+    long bytes = 0;
+    long notes = 0;
+    long checksum = 0;
+    struct timespec start, end;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int pass = 0; pass < BENCH_PASSES; pass++) {
+        for (int i = 0; i < SONG_COUNT; i++) {
+            rtttl_open(&p, SONGS[i]);
+            while (rtttl_next(&p, &n)) {
+                checksum += n.duration + n.frequency;
+                notes++;
+            }
+            bytes += p.next - SONGS[i];
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    double s = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) * 1e-9;
+    printf("%ld notes from %ld bytes in %.3f s (checksum %ld)\n", notes, bytes, s, checksum);
+    printf("%.1f MB/s, %.1f M notes/s, %.1f ns/note\n", bytes / s * 1e-6, notes / s * 1e-6, s * 1e9 / notes);
+
+    return 0;
+}
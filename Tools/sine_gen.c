@@ -0,0 +1,43 @@
+/**
+ * @file sine_gen.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a host tool that generates the Q15 sine table in Src/sine_table.c
+ *
+ * Build and run on the host:
+ *     gcc -O2 -o sine_gen Tools/sine_gen.c -lm
+ *     ./sine_gen > Src/sine_table.c
+ *
+ * SINE_SIZE must match Inc/sine_table.h.
+ */
+
+# include <math.h>
+# include <stdio.h>
+
+# define SINE_SIZE 1024
+
+/**
+ * Generates Src/sine_table.c on stdout
+ * @return execution status
+ */
+int main(void) {
+
+    printf("/**\n");
+    printf(" * @file sine_table.c\n");
+    printf(" * @brief one cycle of a sine wave in Q15, generated by Tools/sine_gen.c (do not edit)\n");
+    printf(" */\n\n");
+    printf("# include \"sine_table.h\"\n\n");
+    printf("const int16_t SINE_Q15[SINE_SIZE] = {\n");
+
+    for (int i = 0; i < SINE_SIZE; i++) {
+        long s = lround(32767 * sin(2 * M_PI * i / SINE_SIZE));
+        if (i % 12 == 0) printf("       ");
+        printf("%7ld%s", s, i == SINE_SIZE - 1 ? "" : ",");
+        if (i % 12 == 11 || i == SINE_SIZE - 1) printf("\n");
+    }
+
+    printf("};\n");
+
+    return 0;
+}
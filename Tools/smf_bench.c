@@ -0,0 +1,248 @@
+/**
+ * @file smf_bench.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a host benchmark of the MIDI file reader's per-event decode cost
+ *
+ * Build and run on the host from the repository root:
+ *     gcc -O2 -IInc -o smf_bench Tools/smf_bench.c
+ *     ./smf_bench [FILE.mid]
+ *
+ * Without a file, the benchmark builds type 1 files of 2 to 16 tracks in memory, each using running
+ * status, tempo changes, and skipped meta and system exclusive events, so the cost of the track merge
+ * can be seen as the number of tracks grows. Every file is checked to come out in time order.
+ */
+
+# include <stdint.h>
+# include <stdio.h>
+# include <stdlib.h>
+# include <time.h>
+
+// stand in for the cycle counter, which only exists on the target
+# define CYCLE_COUNTER_H
+
+static inline void cyc_init(void) {}
+
+static inline uint32_t cyc_now(void) {
+    return 0;
+}
+
+# include "../Src/smf.c"
+# include "../Src/tuning_table.c"
+
+# define BENCH_NOTES 2000 // notes per track
+# define BENCH_EVENTS 20000000 // events to read for each timing
+
+static uint8_t file[SMF_MAX_TRACKS * BENCH_NOTES * 8 + 4096];
+
+/**
+ * Writes a big-endian number
+ * @param s - where to write
+ * @param value - the number
+ * @param bytes - the number of bytes
+ * @return the position after the number
+ */
+static uint8_t * put_big_endian(uint8_t *s, uint32_t value, int bytes) {
+    while (bytes--) *s++ = (uint8_t) (value >> (8 * bytes));
+    return s;
+}
+
+/**
+ * Writes a variable-length quantity
+ * @param s - where to write
+ * @param value - the quantity
+ * @return the position after the quantity
+ */
+static uint8_t * put_vlq(uint8_t *s, uint32_t value) {
+
+    uint8_t bytes[4];
+    int n = 0;
+
+    do {
+        bytes[n++] = value & 0x7F;
+        value >>= 7;
+    } while (value);
+
+    while (n--) *s++ = bytes[n] | (n ? 0x80 : 0);
+    return s;
+}
+
+/**
+ * Builds a type 1 file with a tempo track and some note tracks
+ * @param tracks - the number of note tracks
+ * @return the length of the file
+ */
+static uint32_t build(int tracks) {
+
+    uint8_t *s = file;
+
+    s = put_big_endian(s, 0x4D546864, 4);
+    s = put_big_endian(s, 6, 4);
+    s = put_big_endian(s, 1, 2);
+    s = put_big_endian(s, tracks + 1, 2);
+    s = put_big_endian(s, 480, 2);
+
+    // the tempo track speeds up every bar
+    s = put_big_endian(s, 0x4D54726B, 4);
+    uint8_t *length = s;
+    s += 4;
+    for (int bar = 0; bar < BENCH_NOTES / 8; bar++) {
+        s = put_vlq(s, bar ? 1920 : 0);
+        *s++ = 0xFF;
+        *s++ = 0x51;
+        *s++ = 3;
+        s = put_big_endian(s, 600000 - bar * 100, 3);
+    }
+    s = put_vlq(s, 0);
+    *s++ = 0xFF;
+    *s++ = 0x2F;
+    *s++ = 0;
+    put_big_endian(length, (uint32_t) (s - length - 4), 4);
+
+    // each note track plays notes of differing lengths on its own channel, using running status
+    srand(1);
+    for (int t = 0; t < tracks; t++) {
+
+        s = put_big_endian(s, 0x4D54726B, 4);
+        length = s;
+        s += 4;
+
+        s = put_vlq(s, 0);
+        *s++ = 0xFF;
+        *s++ = 0x03;
+        *s++ = 5;
+        for (int i = 0; i < 5; i++) *s++ = "track"[i];
+
+        s = put_vlq(s, 0);
+        *s++ = 0xF0;
+        *s++ = 2;
+        *s++ = 0x7E;
+        *s++ = 0xF7;
+
+        s = put_vlq(s, 0);
+        *s++ = 0xC0 | t;
+        *s++ = (uint8_t) (t * 8);
+
+        s = put_vlq(s, 0);
+        *s++ = 0x90 | t;
+        for (int i = 0; i < BENCH_NOTES; i++) {
+            int key = 36 + rand() % 48;
+            if (i) s = put_vlq(s, 0);
+            *s++ = (uint8_t) key;
+            *s++ = 100;
+            s = put_vlq(s, 60 + rand() % 400);
+            *s++ = (uint8_t) key;
+            *s++ = 0;
+        }
+
+        s = put_vlq(s, 0);
+        *s++ = 0xFF;
+        *s++ = 0x2F;
+        *s++ = 0;
+        put_big_endian(length, (uint32_t) (s - length - 4), 4);
+    }
+
+    return (uint32_t) (s - file);
+}
+
+/**
+ * Reads a file once, checking that its events come out in time order
+ * @param data - the file
+ * @param size - the length of the file
+ * @return the number of events, or -1 if the file is invalid or out of order
+ */
+static long check(const uint8_t *data, uint32_t size) {
+
+    smf_player p;
+    smf_event e;
+    uint32_t last_tick = 0;
+    uint32_t last_time = 0;
+    long events = 0;
+
+    if (!smf_open(&p, data, size)) return -1;
+    int tracks = p.tracks;
+
+    while (smf_next(&p, &e)) {
+        if (e.tick < last_tick || e.time_us < last_time) return -1;
+        last_tick = e.tick;
+        last_time = e.time_us;
+        events++;
+    }
+
+    printf("    %d tracks, %ld events, %d errors, %.2f s long\n", tracks, events, p.errors, last_time * 1e-6);
+    return events;
+}
+
+/**
+ * Times reading a file over and over
+ * @param data - the file
+ * @param size - the length of the file
+ * @return nanoseconds per event
+ */
+static double time_events(const uint8_t *data, uint32_t size) {
+
+    smf_player p;
+    smf_event e;
+    long events = 0;
+    uint32_t checksum = 0;
+    struct timespec start, end;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    while (events < BENCH_EVENTS) {
+        smf_open(&p, data, size);
+        while (smf_next(&p, &e)) {
+            checksum += e.key + e.time_us;
+            events++;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    // keep the compiler from discarding the events
+    volatile uint32_t sink = checksum;
+    (void) sink;
+
+    double ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+    return ns / events;
+}
+
+/**
+ * Benchmarks the MIDI file reader
+ * @param argc - the number of arguments
+ * @param argv - [FILE.mid]
+ * @return execution status
+ */
+int main(int argc, char **argv) {
+
+    if (argc > 1) {
+
+        FILE *f = fopen(argv[1], "rb");
+        if (!f) {
+            perror(argv[1]);
+            return 1;
+        }
+        uint32_t size = (uint32_t) fread(file, 1, sizeof(file), f);
+        fclose(f);
+
+        if (check(file, size) < 0) {
+            fprintf(stderr, "%s: not a readable type 0 or 1 file\n", argv[1]);
+            return 1;
+        }
+        printf("%.1f ns/event\n", time_events(file, size));
+        return 0;
+    }
+
+    int counts[] = {1, 4, 8, 15};
+
+    for (int i = 0; i < 4; i++) {
+        uint32_t size = build(counts[i]);
+        printf("%d note tracks and a tempo track, %u bytes\n", counts[i], size);
+        if (check(file, size) < 0) {
+            fprintf(stderr, "events out of order\n");
+            return 1;
+        }
+        printf("    %.1f ns/event\n", time_events(file, size));
+    }
+
+    return 0;
+}
@@ -0,0 +1,135 @@
+/**
+ * @file song_codec_bench.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a host benchmark of the song codec's compression and per-note decode cost
+ *
+ * Build and run on the host from the repository root:
+ *     g++ -std=c++17 -O2 -IInc -c Src/demo_song.cpp
+ *     gcc -O2 -ITools/songc -IInc -o song_codec_bench Tools/song_codec_bench.c demo_song.o
+ *     ./song_codec_bench
+ *
+ * Compresses the demo song, checks that every note decodes to the note it was compressed from,
+ * then times the decoder over the demo song and over a song of nothing but the longest token.
+ */
+
+# include <stdint.h>
+# include <stdio.h>
+# include <time.h>
+
+# include "../Src/song_bank.c"
+# include "../Src/song_codec.c"
+# include "demo_song.h"
+
+// song_bank.c walks the .songs section, which the host does not have
+const uint8_t _ssongs[1] = {0};
+const uint8_t _esongs[1] = {0};
+
+# define BENCH_NOTES 20000000 // notes to decode for each timing
+# define WORST_NOTES 4096 // notes in the song of longest tokens
+
+static mp_note notes[MAX_SONG_LENGTH];
+static mp_note worst[WORST_NOTES];
+static uint8_t compressed[1 + 2 * SC_MAX_DURATIONS + WORST_NOTES * SC_MAX_TOKEN];
+
+/**
+ * Times decoding a compressed song over and over
+ * @param data - the compressed song
+ * @param length - the length of the song in bytes
+ * @return the average time to decode a note, in ns
+ */
+static double time_decode(const uint8_t *data, int length) {
+
+    sb_song song = {.data = data, .length = (uint32_t) length, .format = SB_FORMAT_COMPRESSED, .name = "bench"};
+    sc_decoder d;
+    mp_note n;
+    long decoded = 0, checksum = 0;
+    struct timespec start, end;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    while (decoded < BENCH_NOTES) {
+        sc_open(&d, &song);
+        while (sc_next(&d, &n)) {
+            checksum += n.frequency + n.dual_duration;
+            decoded++;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    double ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+    if (!checksum) printf("(empty song)\n");
+
+    return ns / (double) decoded;
+}
+
+/**
+ * Benchmarks the song codec
+ * @return execution status
+ */
+int main(void) {
+
+    sb_reader r;
+    sc_decoder d;
+    mp_note n;
+    int count = 0;
+
+    sb_open(&r, &SONG_DEMO);
+    while (count < MAX_SONG_LENGTH && sb_next(&r, &notes[count])) count++;
+
+    int length = sc_encode(notes, count, compressed, sizeof(compressed));
+    if (!length) {
+        printf("the demo song has a note with no compressed form\n");
+        return 1;
+    }
+
+    // each note has to decode to the form it was compressed in, a token at a time
+    sb_song song = {.data = compressed, .length = (uint32_t) length, .format = SB_FORMAT_COMPRESSED, .name = "demo"};
+    sc_open(&d, &song);
+
+    int widest = 0;
+    for (int i = 0; i < count; i++) {
+
+        const uint8_t *before = d.pos;
+        mp_note expected = notes[i];
+        sc_normal(&expected);
+
+        if (!sc_next(&d, &n) || !sc_same(&n, &expected)) {
+            printf("note %d does not decode to the note it was compressed from\n", i);
+            return 1;
+        }
+
+        if (d.pos - before > widest) widest = (int) (d.pos - before);
+    }
+
+    if (sc_next(&d, &n) || d.errors) {
+        printf("the demo song does not end where it should\n");
+        return 1;
+    }
+
+    printf("demo song: %d notes\n", count);
+    printf("    %4d bytes as mp_note initialisers in RAM\n", count * (int) sizeof(mp_note));
+    printf("    %4d bytes as packed notes, %.1f bytes per note\n", count * SB_NOTE_SIZE, (double) SB_NOTE_SIZE);
+    printf("    %4d bytes compressed, %.1f bytes per note, %.1fx smaller than packed\n", length,
+           (double) length / count, (double) (count * SB_NOTE_SIZE) / length);
+    printf("    widest token %d bytes\n", widest);
+    printf("    %.2f ns per note decoded\n", time_decode(compressed, length));
+
+    // every note has two parts whose durations are written in full and whose pitches swing far
+    for (int i = 0; i < WORST_NOTES; i++) {
+        worst[i].instrument = MP_INSTR_KEYS;
+        worst[i].duration = 1000 + i;
+        worst[i].frequency = i & 1 ? 65000 : 1;
+        worst[i].dual_instrument = MP_INSTR_SAW;
+        worst[i].dual_duration = 40000 + i;
+        worst[i].dual_frequency = i & 1 ? 1 : 65000;
+    }
+
+    length = sc_encode(worst, WORST_NOTES, compressed, sizeof(compressed));
+
+    printf("longest tokens: %d notes, %d bytes, %.1f bytes per note\n", WORST_NOTES, length,
+           (double) (length - 1) / WORST_NOTES);
+    printf("    %.2f ns per note decoded\n", time_decode(compressed, length));
+
+    return 0;
+}
@@ -0,0 +1,27 @@
+/**
+ * @file cycle_counter.h
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief stands in for the DWT cycle counter, which only exists on the target, in host builds
+ */
+
+# ifndef CYCLE_COUNTER_H
+# define CYCLE_COUNTER_H
+
+# include <stdint.h>
+
+/**
+ * Does nothing, as there is no cycle counter to enable
+ */
+static inline void cyc_init(void) {}
+
+/**
+ * Reads the cycle counter
+ * @return zero, as there is no cycle counter to read
+ */
+static inline uint32_t cyc_now(void) {
+    return 0;
+}
+
+# endif
@@ -0,0 +1,997 @@
+/**
+ * @file songc.cpp
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a host tool that compiles songs into a song bank for the .songs flash section
+ *
+ * Build and run on the host, see Tools/songc/CMakeLists.txt:
+ *     songc [-o BANK.c] [-b BANK.bin] [-s SYMBOL] [-z] [ID:][NAME=]SONG...
+ *
+ * Each SONG is a file, given an ID to select it by and a NAME, which default to the next free ID and
+ * the file's stem, and compiled by its extension:
+ *     .mid, .midi - a type 0 or 1 Standard MIDI File, stored as is for smf_open
+ *     .rtttl, .txt - an RTTTL ringtone, converted to packed notes by Src/rtttl.c
+ *     .song - a text song, converted to packed notes
+ *     .seq - a text sequence of patterns, assembled for Src/sequencer.c
+ *
+ * With -z, songs of notes are stored compressed by Src/song_codec.c instead, except for any song
+ * with a sound effect, which the compressed format has no code for.
+ *
+ * A text song holds one note per line, written like the note initialisers in main.c, with an
+ * optional dual part after a bar and comments after two slashes:
+ *     keys eighth 588
+ *     keys quarter+eighth F#5 | kick
+ *     rest sixteenth
+ *     sfx coin
+ * A part is an instrument, a duration (whole, half, quarter, eighth, or sixteenth joined with plus
+ * signs, which are kept in ticks to play at the player's tempo, or a number of ms), and a frequency (a number of Hz, or a note name with
+ * an optional offset in cents such as A4+14, which is stored as a MIDI note for the tuning table).
+ * Drums and sound effects may leave out their duration, and a sound effect names its preset.
+ *
+ * A text sequence holds the same notes, whose durations must be whole ticks, between statements
+ * that store each pattern once and play it wherever it is named:
+ *     pattern NAME ... end - a pattern, which may play other patterns
+ *     play NAME - plays a pattern once
+ *     repeat COUNT NAME - plays a pattern COUNT times, up to 255
+ *     label NAME, jump NAME - carries on from a label, such as to loop forever
+ *     tempo BPM - changes the tempo of the notes after it
+ * The song itself is whatever is written outside the patterns.
+ *
+ * Along with each song the bank's index holds its tempo, how many parts it sounds at once, its playing
+ * time, and a CRC, all worked out here so the firmware can list the library without reading a song.
+ *
+ * The bank is written as a C file whose array the linker places in the .songs section (add it to
+ * Src/ and the firmware build picks it up), and or as a raw image, which can be linked with
+ *     arm-none-eabi-objcopy -I binary -O elf32-littlearm -B arm \
+ *         --rename-section .data=.songs,alloc,load,readonly,data,contents BANK.bin BANK.o
+ */
+
+# include <algorithm>
+# include <cmath>
+# include <cstdint>
+# include <cstdio>
+# include <cstring>
+# include <fstream>
+# include <iostream>
+# include <map>
+# include <sstream>
+# include <stdexcept>
+# include <string>
+# include <vector>
+
+extern "C" {
+# include "music_player_types.h"
+# include "rtttl.h"
+# include "sfx.h"
+# include "smf.h"
+# include "song_bank.h"
+# include "song_codec.h"
+# include "sequencer.h"
+# include "tuning.h"
+# include "tempo_map.h"
+}
+
+# define MAX_SEQUENCE_NOTES 65536 // notes a sequence plays before it is taken to loop forever
+
+/**
+ * A song ready to be placed in the bank
+ */
+struct song {
+    std::string name;
+    sb_format format;
+    std::vector<uint8_t> data;
+    std::vector<mp_note> notes;
+    int id = -1;
+    int tempo = MP_TEMPO;
+    int voices = 1;
+    uint32_t duration = 0;
+};
+
+/**
+ * Instrument names as written in text songs
+ */
+static const struct {
+    const char *name;
+    mp_instrument instrument;
+} INSTRUMENTS[] = {
+        {"fm", MP_INSTR_FM},
+        {"hat", MP_INSTR_HAT},
+        {"keys", MP_INSTR_KEYS},
+        {"kick", MP_INSTR_KICK},
+        {"none", MP_INSTR_NONE},
+        {"pluck", MP_INSTR_PLUCK},
+        {"rest", MP_INSTR_REST},
+        {"saw", MP_INSTR_SAW},
+        {"sfx", MP_INSTR_SFX},
+        {"snare", MP_INSTR_SNARE}
+};
+
+/**
+ * Note lengths as written in text songs
+ */
+static const struct {
+    const char *name;
+    int ticks;
+} DURATIONS[] = {
+        {"whole", 4 * TM_PPQ},
+        {"half", 2 * TM_PPQ},
+        {"quarter", TM_PPQ},
+        {"eighth", TM_PPQ / 2},
+        {"sixteenth", TM_PPQ / 4}
+};
+
+/**
+ * Sound effect preset names, in sfx_preset_id order
+ */
+static const char * const SFX_NAMES[SFX_PRESET_COUNT] = {
+        "blip", "coin", "explosion", "hit", "jump", "laser", "powerup"
+};
+
+/**
+ * Appends a little-endian number to a buffer
+ * @param out - the buffer
+ * @param value - the number
+ * @param bytes - the number of bytes
+ */
+static void put(std::vector<uint8_t> &out, uint32_t value, int bytes) {
+    for (int i = 0; i < bytes; i++) out.push_back((uint8_t) (value >> (8 * i)));
+}
+
+/**
+ * Appends a note to a buffer in the packed SB_FORMAT_NOTES layout
+ * @param out - the buffer
+ * @param n - the note
+ */
+static void put_note(std::vector<uint8_t> &out, const mp_note &n) {
+
+    const int fields[] = {n.duration, n.frequency, n.dual_duration, n.dual_frequency};
+    for (int field : fields) {
+        if (field < 0 || field > 0xFFFF) throw std::runtime_error("duration or frequency out of range");
+        put(out, (uint32_t) field, 2);
+    }
+
+    out.push_back((uint8_t) n.instrument);
+    out.push_back((uint8_t) n.dual_instrument);
+}
+
+/**
+ * Reads a whole file
+ * @param path - the file to read
+ * @return the contents of the file
+ */
+static std::vector<uint8_t> read_file(const std::string &path) {
+    std::ifstream f(path, std::ios::binary);
+    if (!f) throw std::runtime_error("cannot open " + path);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+}
+
+/**
+ * Checks that a MIDI file is one smf_open accepts
+ * @param data - the file
+ */
+static void check_smf(const std::vector<uint8_t> &data) {
+
+    auto big = [&](size_t at, int bytes) {
+        uint32_t v = 0;
+        for (int i = 0; i < bytes; i++) v = (v << 8) | data[at + i];
+        return v;
+    };
+
+    if (data.size() < 14 || memcmp(data.data(), "MThd", 4) || big(4, 4) < 6) {
+        throw std::runtime_error("not a Standard MIDI File");
+    }
+    if (big(8, 2) > 1) throw std::runtime_error("only type 0 and 1 files can be played");
+    if (big(12, 2) == 0 || (big(12, 2) & 0x8000)) throw std::runtime_error("SMPTE divisions cannot be played");
+    if (big(10, 2) > SMF_MAX_TRACKS) {
+        std::cerr << "warning: tracks past the first " << SMF_MAX_TRACKS << " will not play\n";
+    }
+}
+
+/**
+ * Converts an RTTTL ringtone to packed notes
+ * @param text - the ringtone
+ * @param s - the song to fill
+ */
+static void compile_rtttl(const std::string &text, song &s) {
+
+    rtttl_parser p;
+    mp_note n;
+
+    if (!rtttl_open(&p, text.c_str())) throw std::runtime_error("invalid RTTTL header");
+    s.tempo = p.bpm;
+
+    while (rtttl_next(&p, &n)) {
+        s.notes.push_back(n);
+    }
+
+    if (p.errors) std::cerr << "warning: " << p.errors << " malformed notes skipped\n";
+}
+
+/**
+ * Reads a frequency as a number of Hz or a note name such as A4, C#5, Bb3, or A4+14 in cents
+ * @param word - the frequency
+ * @return the frequency in Hz, or the pitch of the note made with TN_PITCH
+ */
+static int parse_frequency(const std::string &word) {
+
+    if (isdigit((unsigned char) word[0])) {
+        int hz = std::stoi(word);
+        if (hz >= TN_PITCH_FLAG) throw std::runtime_error("frequency out of range " + word);
+        return hz;
+    }
+
+    static const int SEMITONES[7] = {9, 11, 0, 2, 4, 5, 7};
+    int letter = tolower((unsigned char) word[0]) - 'a';
+    if (letter < 0 || letter > 6 || word.size() < 2) throw std::runtime_error("bad frequency " + word);
+
+    size_t i = 1;
+    int semitone = SEMITONES[letter];
+    if (word[i] == '#' || word[i] == 'b') {
+        semitone += word[i] == '#' ? 1 : -1;
+        i++;
+    }
+
+    if (i >= word.size() || !isdigit((unsigned char) word[i])) throw std::runtime_error("bad frequency " + word);
+    size_t used = 0;
+    int octave = std::stoi(word.substr(i), &used);
+    int midi = 12 * (octave + 1) + semitone;
+
+    // an offset in cents follows the octave with its sign
+    std::string offset = word.substr(i + used);
+    int cents = 0;
+    if (!offset.empty()) {
+        if (offset[0] != '+' && offset[0] != '-') throw std::runtime_error("bad frequency " + word);
+        cents = std::stoi(offset, &used);
+        if (used != offset.size()) throw std::runtime_error("bad frequency " + word);
+    }
+
+    if (midi < 0 || midi >= TN_NOTES || cents < -TN_MAX_CENTS || cents > TN_MAX_CENTS) {
+        throw std::runtime_error("bad frequency " + word);
+    }
+
+    return TN_PITCH(midi, cents);
+}
+
+/**
+ * Reads a duration as note lengths joined with plus signs, or a number of ms
+ * @param word - the duration
+ * @return the duration in ms, or in ticks made with TM_TICKS for note lengths
+ */
+static int parse_duration(const std::string &word) {
+
+    if (isdigit((unsigned char) word[0])) {
+        int ms = std::stoi(word);
+        if (ms >= TM_TICKS_FLAG) throw std::runtime_error("duration out of range " + word);
+        return ms;
+    }
+
+    int ticks = 0;
+    std::stringstream terms(word);
+    std::string term;
+
+    while (std::getline(terms, term, '+')) {
+        bool found = false;
+        for (auto &d : DURATIONS) {
+            if (term == d.name) {
+                ticks += d.ticks;
+                found = true;
+            }
+        }
+        if (!found) throw std::runtime_error("bad duration " + term);
+    }
+
+    if (ticks > TM_MAX_TICKS) throw std::runtime_error("duration out of range " + word);
+    return TM_TICKS(ticks);
+}
+
+/**
+ * Reads one part of a text song note
+ * @param text - the part
+ * @param instrument - receives the instrument
+ * @param duration - receives the duration in ms, or in ticks made with TM_TICKS
+ * @param frequency - receives the frequency, or the preset of a sound effect
+ */
+static void parse_part(const std::string &text, mp_instrument &instrument, int &duration, int &frequency) {
+
+    std::stringstream words(text);
+    std::string name, word;
+    words >> name;
+
+    bool found = false;
+    for (auto &i : INSTRUMENTS) {
+        if (name == i.name) {
+            instrument = i.instrument;
+            found = true;
+        }
+    }
+    if (!found) throw std::runtime_error("bad instrument " + name);
+
+    duration = 0;
+    frequency = 0;
+
+    // sound effects name their preset and take their length from its envelope
+    if (instrument == MP_INSTR_SFX) {
+        words >> word;
+        for (frequency = 0; frequency < SFX_PRESET_COUNT; frequency++) {
+            if (word == SFX_NAMES[frequency]) return;
+        }
+        throw std::runtime_error("bad sound effect " + word);
+    }
+
+    if (words >> word) duration = parse_duration(word);
+    else if (instrument != MP_INSTR_HAT && instrument != MP_INSTR_KICK && instrument != MP_INSTR_SNARE
+             && instrument != MP_INSTR_NONE) {
+        throw std::runtime_error("missing duration");
+    }
+
+    if (words >> word) frequency = parse_frequency(word);
+    if (words >> word) throw std::runtime_error("unexpected " + word);
+}
+
+/**
+ * Reads one note of a text song, with its optional dual part after a bar
+ * @param line - the note
+ * @return the note
+ */
+static mp_note parse_note(const std::string &line) {
+
+    mp_note n = {};
+    size_t bar = line.find('|');
+
+    parse_part(line.substr(0, bar), n.instrument, n.duration, n.frequency);
+
+    n.dual_instrument = MP_INSTR_NONE;
+    if (bar != std::string::npos) {
+        parse_part(line.substr(bar + 1), n.dual_instrument, n.dual_duration, n.dual_frequency);
+    }
+
+    return n;
+}
+
+/**
+ * Checks whether a part is a drum
+ * @param instrument - the instrument of the part
+ * @return whether the part takes its length from its instrument
+ */
+static bool is_drum(mp_instrument instrument) {
+    return instrument == MP_INSTR_HAT || instrument == MP_INSTR_KICK || instrument == MP_INSTR_SNARE;
+}
+
+/**
+ * Gives the drums of a song written in ticks their length in ticks, so they keep to its tempo
+ * rather than last their length in ms at MP_TEMPO
+ * @param s - the song
+ */
+static void time_drums(song &s) {
+
+    bool ticks = false;
+    for (const mp_note &n : s.notes) ticks |= TM_IS_TICKS(n.duration) || TM_IS_TICKS(n.dual_duration);
+    if (!ticks) return;
+
+    for (mp_note &n : s.notes) {
+        if (is_drum(n.instrument) && !n.duration) n.duration = TM_TICKS(0);
+        if (is_drum(n.dual_instrument) && !n.dual_duration) n.dual_duration = TM_TICKS(0);
+    }
+}
+
+/**
+ * Converts a text song to packed notes
+ * @param text - the song
+ * @param s - the song to fill
+ */
+static void compile_text(const std::string &text, song &s) {
+
+    std::stringstream lines(text);
+    std::string line;
+    int number = 0;
+
+    while (std::getline(lines, line)) {
+
+        number++;
+        line = line.substr(0, line.find("//"));
+        if (line.find_first_not_of(" \t\r") == std::string::npos) continue;
+
+        try {
+            s.notes.push_back(parse_note(line));
+        } catch (const std::exception &e) {
+            throw std::runtime_error("line " + std::to_string(number) + ": " + e.what());
+        }
+    }
+
+    time_drums(s);
+}
+
+/**
+ * A sequence being assembled, a block of code for the song and for each pattern
+ */
+struct assembly {
+
+    struct block {
+        std::vector<uint8_t> code;
+        std::vector<std::string> calls;
+        uint32_t offset;
+    };
+
+    struct fixup {
+        std::string block;
+        size_t at;
+        std::string target;
+        bool label;
+        int line;
+    };
+
+    std::map<std::string, block> blocks;
+    std::map<std::string, std::pair<std::string, size_t>> labels;
+    std::vector<fixup> fixups;
+};
+
+/**
+ * Converts a duration in ticks, or in ms at MP_TEMPO, to sequencer ticks
+ * @param duration - the duration
+ * @return the duration in sequencer ticks
+ */
+static int to_ticks(int duration) {
+
+    int per = TM_IS_TICKS(duration) ? TM_PPQ : MP_NOTE_QUARTER;
+    int length = TM_IS_TICKS(duration) ? TM_TICK_COUNT(duration) : duration;
+    std::string text = std::to_string(length) + (TM_IS_TICKS(duration) ? " ticks" : " ms");
+
+    int ticks = length * SEQ_TICKS_PER_QUARTER / per;
+
+    if (ticks * per != length * SEQ_TICKS_PER_QUARTER) {
+        throw std::runtime_error(text + " is not a whole number of sequencer ticks");
+    }
+    if (ticks > 0xFF) throw std::runtime_error(text + " is too long for one note");
+
+    return ticks;
+}
+
+/**
+ * Appends one part of a note to sequencer code
+ * @param code - the code
+ * @param instrument - the instrument of the part
+ * @param duration - the duration of the part in ticks, or in ms at MP_TEMPO
+ * @param frequency - the frequency of the part
+ */
+static void put_part(std::vector<uint8_t> &code, mp_instrument instrument, int duration, int frequency) {
+    if (frequency < 0 || frequency > 0xFFFF) throw std::runtime_error("frequency out of range");
+    code.push_back((uint8_t) instrument);
+    code.push_back((uint8_t) to_ticks(duration));
+    put(code, (uint32_t) frequency, 2);
+}
+
+/**
+ * Finds how deep the patterns a block plays go
+ * @param a - the assembly
+ * @param name - the block
+ * @param path - the patterns being played on the way to the block
+ * @return the number of patterns deep the block goes
+ */
+static int call_depth(const assembly &a, const std::string &name, std::vector<std::string> &path) {
+
+    for (const std::string &p : path) {
+        if (p == name) throw std::runtime_error("pattern " + name + " plays itself");
+    }
+
+    path.push_back(name);
+    int deepest = 0;
+    for (const std::string &call : a.blocks.at(name).calls) {
+        deepest = std::max(deepest, 1 + call_depth(a, call, path));
+    }
+    path.pop_back();
+
+    return deepest;
+}
+
+/**
+ * Assembles a text sequence for the sequencer
+ * @param text - the sequence
+ * @param s - the song to fill
+ */
+static void compile_sequence(const std::string &text, song &s) {
+
+    assembly a;
+    std::string current = "";
+    std::stringstream lines(text);
+    std::string line;
+    int number = 0;
+
+    a.blocks[current];
+
+    while (std::getline(lines, line)) {
+
+        number++;
+        line = line.substr(0, line.find("//"));
+        if (line.find_first_not_of(" \t\r") == std::string::npos) continue;
+
+        try {
+            std::stringstream words(line);
+            std::string word, name, extra;
+            words >> word;
+            std::vector<uint8_t> &code = a.blocks[current].code;
+
+            bool statement = word == "pattern" || word == "end" || word == "play" || word == "repeat" ||
+                             word == "label" || word == "jump" || word == "tempo";
+
+            if (!statement) {
+                mp_note n = parse_note(line);
+                if (n.instrument == MP_INSTR_REST && n.dual_instrument == MP_INSTR_NONE) {
+                    code.push_back(SEQ_REST);
+                    code.push_back((uint8_t) to_ticks(n.duration));
+                } else {
+                    code.push_back(n.dual_instrument == MP_INSTR_NONE ? SEQ_NOTE : SEQ_DUAL);
+                    put_part(code, n.instrument, n.duration, n.frequency);
+                    if (n.dual_instrument != MP_INSTR_NONE) {
+                        put_part(code, n.dual_instrument, n.dual_duration, n.dual_frequency);
+                    }
+                }
+                continue;
+            }
+
+            if (word == "pattern") {
+                if (!current.empty()) throw std::runtime_error("pattern inside pattern " + current);
+                if (!(words >> name) || name.empty()) throw std::runtime_error("missing pattern name");
+                if (a.blocks.count(name)) throw std::runtime_error("pattern " + name + " written twice");
+                current = name;
+                a.blocks[current];
+            } else if (word == "end") {
+                if (current.empty()) throw std::runtime_error("end outside a pattern");
+                code.push_back(SEQ_RETURN);
+                current = "";
+            } else if (word == "play" || word == "repeat") {
+                int count = 1;
+                if (word == "repeat" && !(words >> count)) throw std::runtime_error("missing repeat count");
+                if (count < 1 || count > 0xFF) throw std::runtime_error("repeat count out of range");
+                if (!(words >> name)) throw std::runtime_error("missing pattern name");
+                code.push_back(word == "play" ? SEQ_CALL : SEQ_REPEAT);
+                if (word == "repeat") code.push_back((uint8_t) count);
+                a.fixups.push_back({current, code.size(), name, false, number});
+                a.blocks[current].calls.push_back(name);
+                put(code, 0, 2);
+            } else if (word == "label" || word == "jump") {
+                if (!(words >> name)) throw std::runtime_error("missing label name");
+                if (word == "jump") {
+                    code.push_back(SEQ_JUMP);
+                    a.fixups.push_back({current, code.size(), name, true, number});
+                    put(code, 0, 2);
+                } else if (!a.labels.emplace(name, std::make_pair(current, code.size())).second) {
+                    throw std::runtime_error("label " + name + " written twice");
+                }
+            } else {
+                int tempo = 0;
+                if (!(words >> tempo) || tempo <= 0 || tempo > 0xFFFF) throw std::runtime_error("bad tempo");
+                code.push_back(SEQ_TEMPO);
+                put(code, (uint32_t) tempo, 2);
+            }
+
+            if (words >> extra) throw std::runtime_error("unexpected " + extra);
+
+        } catch (const std::exception &e) {
+            throw std::runtime_error("line " + std::to_string(number) + ": " + e.what());
+        }
+    }
+
+    if (!current.empty()) throw std::runtime_error("pattern " + current + " has no end");
+    a.blocks[""].code.push_back(SEQ_END);
+
+    // the song goes first, as the sequencer starts at the start of the program, then the patterns
+    for (const auto &f : a.fixups) {
+        if (!f.label && !a.blocks.count(f.target)) {
+            throw std::runtime_error("line " + std::to_string(f.line) + ": no pattern " + f.target);
+        }
+    }
+
+    std::vector<std::string> path;
+    if (call_depth(a, "", path) > SEQ_MAX_DEPTH) {
+        throw std::runtime_error("patterns play each other more than " + std::to_string(SEQ_MAX_DEPTH) + " deep");
+    }
+
+    uint32_t offset = 0;
+    for (auto &b : a.blocks) {
+        b.second.offset = offset;
+        offset += (uint32_t) b.second.code.size();
+    }
+    if (offset > 0xFFFF) throw std::runtime_error("sequence longer than 65535 bytes");
+
+    for (const auto &f : a.fixups) {
+        uint32_t target;
+        if (f.label) {
+            auto l = a.labels.find(f.target);
+            if (l == a.labels.end()) throw std::runtime_error("line " + std::to_string(f.line) + ": no label " + f.target);
+            target = a.blocks[l->second.first].offset + (uint32_t) l->second.second;
+        } else {
+            target = a.blocks[f.target].offset;
+        }
+        a.blocks[f.block].code[f.at] = (uint8_t) target;
+        a.blocks[f.block].code[f.at + 1] = (uint8_t) (target >> 8);
+    }
+
+    for (const auto &b : a.blocks) s.data.insert(s.data.end(), b.second.code.begin(), b.second.code.end());
+    s.format = SB_FORMAT_SEQUENCE;
+
+    // play the sequence through the firmware's own sequencer to check it and count its notes
+    sb_song program = {};
+    program.data = s.data.data();
+    program.length = (uint32_t) s.data.size();
+    program.format = SB_FORMAT_SEQUENCE;
+    program.name = "";
+    seq_vm vm;
+    mp_note n;
+
+    seq_open(&vm, &program);
+    while (s.notes.size() <= MAX_SEQUENCE_NOTES && seq_next(&vm, &n)) {
+        if (s.notes.empty()) s.tempo = vm.tempo;
+        s.notes.push_back(n);
+    }
+    if (vm.errors) throw std::runtime_error("the sequencer stopped on a malformed program");
+}
+
+/**
+ * Stores the notes of a song, compressed if asked and if every note has a compressed form
+ * @param s - the song to store
+ * @param compress - whether to compress the song
+ */
+static void store_notes(song &s, bool compress) {
+
+    if (compress) {
+        std::vector<uint8_t> out(1 + 2 * SC_MAX_DURATIONS + s.notes.size() * SC_MAX_TOKEN);
+        int length = sc_encode(s.notes.data(), (int) s.notes.size(), out.data(), (int) out.size());
+
+        if (length) {
+            s.format = SB_FORMAT_COMPRESSED;
+            s.data.assign(out.begin(), out.begin() + length);
+            return;
+        }
+
+        std::cerr << "warning: " << s.name << " has a note with no compressed form, storing it as is\n";
+    }
+
+    for (const mp_note &n : s.notes) put_note(s.data, n);
+}
+
+/**
+ * Works out how long one part of a note sounds, as mp_conv_to_keys would
+ * @param instrument - the instrument of the part
+ * @param duration - the duration of the part
+ * @return the duration, with drums given their preset in ticks or ms
+ */
+static int part_length(mp_instrument instrument, int duration) {
+    if (instrument == MP_INSTR_HAT) return TM_IS_TICKS(duration) ? MP_INSTR_HAT_TICKS : MP_INSTR_HAT_DURATION;
+    if (instrument == MP_INSTR_KICK) return TM_IS_TICKS(duration) ? MP_INSTR_KICK_TICKS : MP_INSTR_KICK_DURATION;
+    if (instrument == MP_INSTR_SNARE) return TM_IS_TICKS(duration) ? MP_INSTR_SNARE_TICKS : MP_INSTR_SNARE_DURATION;
+    return instrument == MP_INSTR_NONE ? 0 : duration;
+}
+
+/**
+ * Works out the playing time and voices of a song of notes, timing ticks at the song's tempo and
+ * any tempo changes its notes carry
+ * @param s - the song
+ */
+static void measure_notes(song &s) {
+
+    tm_map tempo;
+    tm_init(&tempo, s.tempo, nullptr, 0);
+
+    uint64_t ms = 0;
+    s.voices = 1;
+
+    for (const mp_note &n : s.notes) {
+        int duration = part_length(n.instrument, n.duration);
+        int dual_duration = part_length(n.dual_instrument, n.dual_duration);
+        if (n.tempo) tm_set_tempo(&tempo, n.tempo);
+        tm_resolve(&tempo, &duration, &dual_duration);
+        ms += std::max(duration, dual_duration);
+
+        bool dual = n.dual_instrument != MP_INSTR_NONE && n.dual_instrument != MP_INSTR_REST &&
+                    !(n.dual_instrument == MP_INSTR_KEYS && !n.dual_frequency);
+        if (dual) s.voices = 2;
+    }
+
+    // a sequence that never ran out of notes loops forever
+    s.duration = s.notes.size() > MAX_SEQUENCE_NOTES ? SB_LOOPS : (uint32_t) std::min<uint64_t>(ms, SB_LOOPS - 1);
+}
+
+/**
+ * Works out the tempo, playing time, and voices of a MIDI file by reading it through the firmware's
+ * own reader, counting the notes that sound at once
+ * @param s - the song
+ */
+static void measure_smf(song &s) {
+
+    smf_player p;
+    smf_event e;
+    std::map<int, int> sounding;
+    int voices = 0, most = 0;
+    bool started = false;
+
+    if (!smf_open(&p, s.data.data(), (uint32_t) s.data.size())) throw std::runtime_error("not a Standard MIDI File");
+    s.tempo = 60000000 / (int) p.tempo;
+
+    while (smf_next(&p, &e)) {
+
+        if (e.type == SMF_TEMPO && !started) s.tempo = 60000000 / (int) e.value;
+
+        // a note on with no velocity is a note off
+        int key = e.channel * 128 + e.key;
+        if (e.type == SMF_NOTE_ON && e.value) {
+            started = true;
+            sounding[key]++;
+            voices++;
+        } else if ((e.type == SMF_NOTE_ON || e.type == SMF_NOTE_OFF) && sounding[key]) {
+            sounding[key]--;
+            voices--;
+        }
+
+        most = std::max(most, voices);
+        s.duration = (e.time_us + 500) / 1000;
+    }
+
+    s.voices = most;
+}
+
+/**
+ * Compiles one song from its file
+ * @param arg - the song as given on the command line, [ID:][NAME=]PATH
+ * @param compress - whether to compress songs of notes
+ * @return the compiled song
+ */
+static song compile(const std::string &arg, bool compress) {
+
+    // an id is digits before a colon, so paths with colons of their own are left alone
+    size_t colon = arg.find(':');
+    int id = -1;
+    std::string named = arg;
+    if (colon != std::string::npos && colon > 0 &&
+        std::all_of(arg.begin(), arg.begin() + colon, [](char c) { return isdigit((unsigned char) c); })) {
+        id = std::stoi(arg.substr(0, colon));
+        if (id >= SB_MAX_ID) throw std::runtime_error(arg + ": id is not below " + std::to_string(SB_MAX_ID));
+        named = arg.substr(colon + 1);
+    }
+
+    size_t equals = named.find('=');
+    std::string path = equals == std::string::npos ? named : named.substr(equals + 1);
+    std::string stem = path.substr(path.find_last_of("/\\") + 1);
+    std::string extension = stem.find('.') == std::string::npos ? "" : stem.substr(stem.rfind('.'));
+    stem = stem.substr(0, stem.find('.'));
+
+    song s = {equals == std::string::npos ? stem : named.substr(0, equals), SB_FORMAT_NOTES, {}, {}};
+    s.id = id;
+    if (s.name.size() > SB_NAME_LENGTH) {
+        throw std::runtime_error(path + ": name " + s.name + " is longer than " + std::to_string(SB_NAME_LENGTH));
+    }
+
+    try {
+        std::vector<uint8_t> file = read_file(path);
+
+        if (extension == ".mid" || extension == ".midi") {
+            check_smf(file);
+            s.format = SB_FORMAT_SMF;
+            s.data = file;
+        } else if (extension == ".rtttl" || extension == ".txt") {
+            compile_rtttl(std::string(file.begin(), file.end()), s);
+        } else if (extension == ".song") {
+            compile_text(std::string(file.begin(), file.end()), s);
+        } else if (extension == ".seq") {
+            compile_sequence(std::string(file.begin(), file.end()), s);
+        } else {
+            throw std::runtime_error("unknown song type " + extension);
+        }
+
+        if (s.format == SB_FORMAT_SMF) measure_smf(s);
+        else measure_notes(s);
+
+        if (s.format == SB_FORMAT_NOTES) store_notes(s, compress);
+
+    } catch (const std::exception &e) {
+        throw std::runtime_error(path + ": " + e.what());
+    }
+
+    return s;
+}
+
+/**
+ * Computes the CRC-32 of some bytes, as zlib and sb_crc do, bit by bit since speed does not matter here
+ * and song_bank.c cannot link without the .songs section
+ * @param data - the bytes
+ * @param length - the number of bytes
+ * @return the CRC
+ */
+static uint32_t crc32(const uint8_t *data, size_t length) {
+
+    uint32_t crc = 0xFFFFFFFF;
+
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+
+    return ~crc;
+}
+
+/**
+ * Gives every song without an id the lowest one that is free, and checks that no two songs share one
+ * @param songs - the songs
+ */
+static void assign_ids(std::vector<song> &songs) {
+
+    std::vector<bool> taken(SB_MAX_ID);
+
+    for (const song &s : songs) {
+        if (s.id < 0) continue;
+        if (taken[s.id]) throw std::runtime_error("two songs have the id " + std::to_string(s.id));
+        taken[s.id] = true;
+    }
+
+    int next = 0;
+    for (song &s : songs) {
+        if (s.id >= 0) continue;
+        while (next < SB_MAX_ID && taken[next]) next++;
+        if (next == SB_MAX_ID) throw std::runtime_error("no ids are left");
+        s.id = next;
+        taken[next] = true;
+    }
+}
+
+/**
+ * Lays out a bank: the header, the index, the slot table, then each song on a four byte boundary
+ * @param songs - the songs to place, with their ids assigned
+ * @return the bank
+ */
+static std::vector<uint8_t> build_bank(const std::vector<song> &songs) {
+
+    int slots = 0;
+    for (const song &s : songs) slots = std::max(slots, s.id + 1);
+
+    std::vector<uint8_t> bank;
+    size_t index = sizeof(sb_header);
+    uint32_t offset = (uint32_t) ((index + songs.size() * sizeof(sb_entry) + slots * sizeof(uint16_t) + 3) & ~3u);
+
+    put(bank, SB_MAGIC, 4);
+    put(bank, SB_VERSION, 2);
+    put(bank, (uint32_t) songs.size(), 2);
+    put(bank, 0, 4);
+    put(bank, (uint32_t) slots, 2);
+    put(bank, 0, 2);
+    put(bank, 0, 4);
+
+    for (const song &s : songs) {
+        put(bank, offset, 4);
+        put(bank, (uint32_t) s.data.size(), 4);
+        put(bank, crc32(s.data.data(), s.data.size()), 4);
+        put(bank, s.duration, 4);
+        put(bank, (uint32_t) s.id, 2);
+        put(bank, (uint32_t) s.tempo, 2);
+        put(bank, s.format, 1);
+        put(bank, (uint32_t) s.voices, 1);
+        put(bank, 0, 2);
+        for (int i = 0; i < SB_NAME_LENGTH; i++) bank.push_back(i < (int) s.name.size() ? s.name[i] : 0);
+        offset += (uint32_t) ((s.data.size() + 3) & ~3u);
+    }
+
+    std::vector<uint32_t> slot(slots, SB_NO_SONG);
+    for (size_t i = 0; i < songs.size(); i++) slot[songs[i].id] = (uint32_t) i;
+    for (uint32_t entry : slot) put(bank, entry, 2);
+
+    // patch in the CRC of the index and slot table before the padding after them
+    uint32_t crc = crc32(bank.data() + index, bank.size() - index);
+    for (int i = 0; i < 4; i++) bank[16 + i] = (uint8_t) (crc >> (8 * i));
+    while (bank.size() & 3) bank.push_back(0);
+
+    for (const song &s : songs) {
+        bank.insert(bank.end(), s.data.begin(), s.data.end());
+        while (bank.size() & 3) bank.push_back(0);
+    }
+
+    // patch in the size now the whole bank is laid out
+    for (int i = 0; i < 4; i++) bank[8 + i] = (uint8_t) (bank.size() >> (8 * i));
+
+    return bank;
+}
+
+/**
+ * Writes a bank as a C file that places it in the .songs section
+ * @param path - the file to write
+ * @param symbol - the name of the array
+ * @param bank - the bank
+ * @param songs - the songs in the bank, listed in a comment
+ */
+static void write_c(const std::string &path, const std::string &symbol, const std::vector<uint8_t> &bank,
+                    const std::vector<song> &songs) {
+
+    std::ofstream f(path);
+    if (!f) throw std::runtime_error("cannot write " + path);
+
+    std::string file = path.substr(path.find_last_of("/\\") + 1);
+
+    f << "/**\n"
+      << " * @file " << file << "\n"
+      << " * @brief a song bank generated by Tools/songc, do not edit\n"
+      << " *\n";
+    for (size_t i = 0; i < songs.size(); i++) {
+        f << " * " << songs[i].id << " - " << songs[i].name
+          << (songs[i].format == SB_FORMAT_SMF ? " (MIDI, " :
+              songs[i].format == SB_FORMAT_COMPRESSED ? " (compressed notes, " :
+              songs[i].format == SB_FORMAT_SEQUENCE ? " (sequence, " : " (notes, ")
+          << songs[i].data.size() << " bytes, " << songs[i].tempo << " bpm, " << songs[i].voices << " voices, "
+          << (songs[i].duration == SB_LOOPS ? std::string("loops") : std::to_string(songs[i].duration) + " ms")
+          << ")\n";
+    }
+    f << " */\n\n"
+      << "# include <stdint.h>\n\n"
+      << "__attribute__((section(\".songs\"), aligned(4), used))\n"
+      << "const uint8_t " << symbol << "[" << bank.size() << "] = {";
+
+    for (size_t i = 0; i < bank.size(); i++) {
+        if (i % 16 == 0) f << "\n        ";
+        char hex[8];
+        snprintf(hex, sizeof(hex), "0x%02X", bank[i]);
+        f << hex << (i + 1 < bank.size() ? (i % 16 == 15 ? "," : ", ") : "");
+    }
+
+    f << "\n};\n";
+}
+
+/**
+ * Compiles songs into a song bank
+ * @param argc - the number of arguments
+ * @param argv - [-o BANK.c] [-b BANK.bin] [-s SYMBOL] [-z] [ID:][NAME=]SONG...
+ * @return execution status
+ */
+int main(int argc, char **argv) {
+
+    std::string c_path, bin_path, symbol = "SONG_BANK";
+    std::vector<std::string> inputs;
+    bool compress = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if ((arg == "-o" || arg == "-b" || arg == "-s") && i + 1 < argc) {
+            (arg == "-o" ? c_path : arg == "-b" ? bin_path : symbol) = argv[++i];
+        } else if (arg == "-z") {
+            compress = true;
+        } else {
+            inputs.push_back(arg);
+        }
+    }
+
+    if (inputs.empty() || (c_path.empty() && bin_path.empty())) {
+        std::cerr << "usage: " << argv[0] << " [-o BANK.c] [-b BANK.bin] [-s SYMBOL] [-z] [ID:][NAME=]SONG...\n";
+        return 1;
+    }
+
+    try {
+        std::vector<song> songs;
+        for (const std::string &input : inputs) songs.push_back(compile(input, compress));
+
+        assign_ids(songs);
+        std::vector<uint8_t> bank = build_bank(songs);
+
+        if (!c_path.empty()) write_c(c_path, symbol, bank, songs);
+        if (!bin_path.empty()) {
+            std::ofstream f(bin_path, std::ios::binary);
+            if (!f) throw std::runtime_error("cannot write " + bin_path);
+            f.write((const char *) bank.data(), (std::streamsize) bank.size());
+        }
+
+        for (const song &s : songs) {
+            bool loops = s.notes.size() > MAX_SEQUENCE_NOTES;
+            std::cerr << s.id << " " << s.name << ": " << (s.format == SB_FORMAT_SMF ? "MIDI, " : loops ? "looping, " :
+                                             std::to_string(s.notes.size()) + " notes, ")
+                      << s.data.size() << " bytes";
+            if (s.format == SB_FORMAT_COMPRESSED) {
+                std::cerr << " compressed from " << s.notes.size() * SB_NOTE_SIZE;
+            } else if (s.format == SB_FORMAT_SEQUENCE && !loops) {
+                std::cerr << " played from " << s.notes.size() * SB_NOTE_SIZE << " as packed notes";
+            }
+            std::cerr << "\n";
+        }
+        std::cerr << songs.size() << " songs, " << bank.size() << " byte bank\n";
+
+    } catch (const std::exception &e) {
+        std::cerr << "songc: " << e.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}
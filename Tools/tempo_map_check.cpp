@@ -0,0 +1,131 @@
+/**
+ * @file tempo_map_check.cpp
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a host check that drums in songs written in ticks keep to the tempo map
+ *
+ * Build and run on the host from the repository root:
+ *     gcc -O2 -ITools/songc -IInc -c Src/tempo_map.c Src/song_bank.c Src/song_codec.c
+ *     g++ -std=c++17 -O2 -IInc -o tempo_map_check Tools/tempo_map_check.cpp tempo_map.o song_bank.o song_codec.o
+ *     ./tempo_map_check
+ *
+ * Plays a drum beat and then a note through the tempo map, with the tempo halved where the drum
+ * ends, as a song compiled by song_dsl.hpp and as a compressed song. The drum must last an eighth
+ * at the first tempo and move the map on, so the note lasts a quarter at the second. Prints each
+ * check and exits with the number that failed.
+ */
+
+# include <cstdio>
+
+# include "song_dsl.hpp"
+
+extern "C" {
+# include "song_codec.h"
+
+// song_bank.c walks the .songs section, which the host does not have
+extern const uint8_t _ssongs[1] = {0};
+extern const uint8_t _esongs[1] = {0};
+}
+
+using namespace song_dsl;
+
+/**
+ * A kick on its own, then a note, kept in ticks
+ */
+static constexpr auto BEAT = compile<TICKS>(
+        note(kick()),
+        note(keys("A4", quarter))
+);
+
+/**
+ * The same at a fixed tempo, whose drums keep their length in ms
+ */
+static constexpr auto BEAT_MS = compile<120>(
+        note(kick()),
+        note(keys("A4", quarter))
+);
+
+static_assert((BEAT.data[0] | (BEAT.data[1] << 8)) == MP_INSTR_KICK_TICKS, "a drum in ticks must last ticks");
+static_assert((BEAT_MS.data[0] | (BEAT_MS.data[1] << 8)) == MP_INSTR_KICK_DURATION, "a drum in ms must last ms");
+
+/**
+ * The tempo halves where the kick ends
+ */
+static const tm_change CHANGES[] = {{TM_PPQ / 2, 60}};
+
+static int failures = 0;
+
+/**
+ * Prints a check and counts it if it failed
+ * @param what - what was checked
+ * @param got - the value found
+ * @param want - the value expected
+ */
+static void check(const char *what, int got, int want) {
+    std::printf("%-40s %5d ms, want %5d ms%s\n", what, got, want, got == want ? "" : "  FAILED");
+    if (got != want) failures++;
+}
+
+/**
+ * Times two notes through a tempo map that halves the tempo where the first one ends
+ * @param what - what is being played
+ * @param first - the first note, a drum
+ * @param second - the second note
+ */
+static void check_beat(const char *what, mp_note first, mp_note second) {
+
+    tm_map tempo;
+    tm_init(&tempo, MP_TEMPO, CHANGES, 1);
+
+    tm_resolve(&tempo, &first.duration, &first.dual_duration);
+    tm_resolve(&tempo, &second.duration, &second.dual_duration);
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "%s drum", what);
+    check(name, first.duration, 60000 / MP_TEMPO / 2);
+    std::snprintf(name, sizeof(name), "%s note after the change", what);
+    check(name, second.duration, 60000 / 60);
+}
+
+/**
+ * Runs the checks
+ * @return the number of checks that failed
+ */
+int main() {
+
+    mp_note notes[2];
+
+    // a song compiled in ticks, read as mp_feed_resolved reads it
+    sb_song song = as_song(BEAT, "beat");
+    sb_reader reader;
+    sb_open(&reader, &song);
+    sb_next(&reader, &notes[0]);
+    sb_next(&reader, &notes[1]);
+    check_beat("compiled", notes[0], notes[1]);
+
+    // a song in ticks whose drum gives no length, as songc reads it, compressed and decoded
+    mp_note text[2] = {};
+    text[0].instrument = MP_INSTR_KICK;
+    text[0].duration = TM_TICKS(0);
+    text[0].dual_instrument = MP_INSTR_NONE;
+    text[1].instrument = MP_INSTR_KEYS;
+    text[1].duration = TM_QUARTER;
+    text[1].frequency = 440;
+    text[1].dual_instrument = MP_INSTR_NONE;
+
+    uint8_t data[64];
+    sb_song compressed = {};
+    compressed.data = data;
+    compressed.length = (uint32_t) sc_encode(text, 2, data, sizeof(data));
+    compressed.format = SB_FORMAT_COMPRESSED;
+
+    sc_decoder decoder;
+    sc_open(&decoder, &compressed);
+    sc_next(&decoder, &notes[0]);
+    sc_next(&decoder, &notes[1]);
+    check_beat("compressed", notes[0], notes[1]);
+
+    std::printf("%d failed\n", failures);
+    return failures;
+}
@@ -0,0 +1,121 @@
+/**
+ * @file tuning_gen.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a host tool that generates the tuning tables in Src/tuning_table.c
+ *
+ * Build and run on the host:
+ *     gcc -O2 -o tuning_gen Tools/tuning_gen.c -lm
+ *     ./tuning_gen [-a A4] [C C# D D# E F F# G G# A A# B] > Src/tuning_table.c
+ *
+ * Writes a table for each temperament in Inc/tuning.h, with A4 at 440 Hz unless -a gives another
+ * frequency. Twelve numbers of cents above C, one for each note of the octave, add the custom
+ * temperament, which builds with -DTN_TEMPERAMENT=TN_CUSTOM.
+ */
+
+# include <math.h>
+# include <stdio.h>
+# include <stdlib.h>
+
+# define TN_NOTES 128
+
+/**
+ * Temperaments, as the cents above C of each note of the octave
+ */
+static struct {
+    const char *define;
+    const char *description;
+    double cents[12];
+} temperaments[] = {
+        {"TN_EQUAL", "twelve tone equal temperament",
+         {0, 100, 200, 300, 400, 500, 600, 700, 800, 900, 1000, 1100}},
+        {"TN_JUST", "five limit just intonation in C",
+         {0, 111.731, 203.910, 315.641, 386.314, 498.045, 590.224, 701.955, 813.686, 884.359, 1017.596, 1088.269}},
+        {"TN_PYTHAGOREAN", "Pythagorean tuning in C, from Eb to G#",
+         {0, 90.225, 203.910, 294.135, 407.820, 498.045, 611.730, 701.955, 792.180, 905.865, 996.090, 1109.775}},
+        {"TN_MEANTONE", "quarter comma meantone in C, from Eb to G#",
+         {0, 76.049, 193.157, 310.265, 386.314, 503.422, 579.471, 696.578, 772.627, 889.735, 1006.843, 1082.892}},
+        {"TN_WERCKMEISTER", "Werckmeister III",
+         {0, 90.225, 192.180, 294.135, 390.225, 498.045, 588.270, 696.090, 792.180, 888.270, 996.090, 1092.180}},
+        {"TN_CUSTOM", "a custom temperament", {0}}
+};
+
+# define TEMPERAMENT_COUNT (int) (sizeof(temperaments) / sizeof(temperaments[0]))
+
+/**
+ * Writes the table of one temperament
+ * @param cents - the cents above C of each note of the octave
+ * @param a4 - the frequency of A4 in Hz
+ */
+static void print_table(const double *cents, double a4) {
+
+    printf("const uint32_t TN_TABLE[TN_NOTES] = {\n");
+
+    for (int note = 0; note < TN_NOTES; note++) {
+
+        // each temperament is tuned so that its A4 is the reference
+        int octave = note / 12 - 1;
+        double hz = a4 * pow(2.0, octave - 4 + (cents[note % 12] - cents[9]) / 1200.0);
+
+        if (note % 6 == 0) printf("       ");
+        printf(" %10u%s", (unsigned) llround(hz * 65536.0), note == TN_NOTES - 1 ? "" : ",");
+        if (note % 6 == 5 || note == TN_NOTES - 1) printf("\n");
+    }
+
+    printf("};\n");
+}
+
+/**
+ * Generates Src/tuning_table.c on stdout
+ * @param argc - the number of arguments
+ * @param argv - [-a A4] [twelve cents above C]
+ * @return execution status
+ */
+int main(int argc, char **argv) {
+
+    double a4 = 440.0;
+    int custom = 0;
+    int arg = 1;
+
+    if (arg + 1 < argc && argv[arg][0] == '-' && argv[arg][1] == 'a') {
+        a4 = atof(argv[arg + 1]);
+        arg += 2;
+    }
+
+    if (argc - arg == 12) {
+        for (int i = 0; i < 12; i++) temperaments[TEMPERAMENT_COUNT - 1].cents[i] = atof(argv[arg + i]);
+        custom = 1;
+    } else if (argc != arg || a4 <= 0) {
+        fprintf(stderr, "usage: %s [-a A4] [C C# D D# E F F# G G# A A# B] > Src/tuning_table.c\n", argv[0]);
+        return 1;
+    }
+
+    printf("/**\n");
+    printf(" * @file tuning_table.c\n");
+    printf(" * @brief the frequency of every MIDI note in Q16.16 Hz, with A4 at %g Hz, for the temperament\n", a4);
+    printf(" * chosen by TN_TEMPERAMENT, generated by Tools/tuning_gen.c (do not edit)\n");
+    printf(" */\n\n");
+    printf("# include \"tuning.h\"\n\n");
+
+    for (int i = 0; i < TEMPERAMENT_COUNT - !custom; i++) {
+        printf("# %s TN_TEMPERAMENT == %s\n\n", i ? "elif" : "if", temperaments[i].define);
+        printf("// %s\n", temperaments[i].description);
+        print_table(temperaments[i].cents, a4);
+        printf("\n");
+    }
+
+    printf("# else\n");
+    printf("# error \"no tuning table for TN_TEMPERAMENT, regenerate Src/tuning_table.c with Tools/tuning_gen.c\"\n");
+    printf("# endif\n\n");
+
+    printf("const uint16_t TN_CENTS_RATIO[128] = {\n");
+    for (int i = 0; i < 128; i++) {
+        if (i % 8 == 0) printf("       ");
+        printf(" %5u%s", (unsigned) lround(32768.0 * pow(2.0, (i - 64) / 1200.0)), i == 127 ? "" : ",");
+        if (i % 8 == 7) printf("\n");
+    }
+    printf("};\n");
+
+    return 0;
+}
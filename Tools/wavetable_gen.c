@@ -0,0 +1,116 @@
+/**
+ * @file wavetable_gen.c
+ * @author Grant Wilk
+ * @created 10/19/2026
+ * @modified 10/19/2026
+ * @brief a host tool that generates the band-limited wavetables in Src/wavetables.c
+ *
+ * Build and run on the host:
+ *     gcc -O2 -o wavetable_gen Tools/wavetable_gen.c -lm
+ *     ./wavetable_gen > Src/wavetables.c
+ *
+ * The constants below must match Inc/wavetable.h.
+ */
+
+# include <math.h>
+# include <stdio.h>
+
+# define WT_SIZE 256
+# define WT_LEVELS 8
+# define WT_PEAK 32000.0
+
+/**
+ * Waveforms, as additive series
+ */
+typedef enum {
+    SQUARE,
+    SAW
+} waveform;
+
+/**
+ * Computes the number of harmonics a mip level can hold without aliasing
+ * Level k plays fundamentals below (rate / WT_SIZE) * 2^k, so its harmonics must stay below
+ * the Nyquist frequency, rate / 2 = (rate / WT_SIZE) * 2^7
+ * @param level - the mip level
+ * @return the highest harmonic of the level
+ */
+static int harmonics(int level) {
+    int h = (WT_SIZE / 2) >> level;
+    return h < WT_SIZE / 2 ? h : WT_SIZE / 2 - 1;
+}
+
+/**
+ * Evaluates a band-limited waveform
+ * @param wave - the waveform
+ * @param level - the mip level, which sets the band limit
+ * @param x - the phase in radians
+ * @return the unnormalized sample
+ */
+static double evaluate(waveform wave, int level, double x) {
+
+    double sum = 0;
+
+    for (int h = 1; h <= harmonics(level); h++) {
+        if (wave == SQUARE && (h % 2) == 1) sum += sin(h * x) / h;
+        if (wave == SAW) sum += ((h % 2) ? 1.0 : -1.0) * sin(h * x) / h;
+    }
+
+    return sum;
+}
+
+/**
+ * Prints every mip level of a waveform as a C array
+ * Every level shares one scale factor so the loudness does not jump between octaves
+ * @param wave - the waveform
+ * @param name - the name of the array
+ */
+static void emit(waveform wave, const char *name) {
+
+    double peak = 0;
+    for (int level = 0; level < WT_LEVELS; level++) {
+        for (int i = 0; i < WT_SIZE; i++) {
+            double s = fabs(evaluate(wave, level, 2 * M_PI * i / WT_SIZE));
+            if (s > peak) peak = s;
+        }
+    }
+
+    printf("const int16_t %s[WT_LEVELS][WT_SIZE + 1] = {\n", name);
+
+    for (int level = 0; level < WT_LEVELS; level++) {
+
+        printf("        {\n");
+
+        // the extra guard sample repeats the first so interpolation never wraps
+        for (int i = 0; i <= WT_SIZE; i++) {
+            double s = evaluate(wave, level, 2 * M_PI * (i % WT_SIZE) / WT_SIZE);
+            if (i % 12 == 0) printf("               ");
+            printf("%7ld%s", lround(s * WT_PEAK / peak), i == WT_SIZE ? "" : ",");
+            if (i % 12 == 11 || i == WT_SIZE) printf("\n");
+        }
+
+        printf("        }%s\n", level == WT_LEVELS - 1 ? "" : ",");
+    }
+
+    printf("};\n");
+}
+
+/**
+ * Generates Src/wavetables.c on stdout
+ * @return execution status
+ */
+int main(void) {
+
+    printf("/**\n");
+    printf(" * @file wavetables.c\n");
+    printf(" * @brief band-limited wavetables, generated by Tools/wavetable_gen.c (do not edit)\n");
+    printf(" */\n\n");
+    printf("# include \"wavetable.h\"\n\n");
+
+    printf("/**\n * Band-limited square wave, one table per octave\n */\n");
+    emit(SQUARE, "WT_SQUARE");
+
+    printf("\n/**\n * Band-limited sawtooth wave, one table per octave\n */\n");
+    emit(SAW, "WT_SAW");
+
+    return 0;
+}